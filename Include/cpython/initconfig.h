@@ -187,6 +187,7 @@ typedef struct PyConfig {
 #endif
 
     int cpu_count;
+    int type_cache_size;
 #ifdef Py_GIL_DISABLED
     int enable_gil;
     int tlbc_enabled;
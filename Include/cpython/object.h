@@ -260,6 +260,10 @@ struct _specialization_cache {
     PyObject *getitem;
     uint32_t getitem_version;
     PyObject *init;
+    // - If setitem is non-NULL, then it is the same Python function that
+    //   PyType_Lookup(cls, "__setitem__") would return
+    //   (as required by STORE_SUBSCR_PY_SETITEM).
+    PyObject *setitem;
 };
 
 /* The *real* layout of a type object when allocated on the heap */
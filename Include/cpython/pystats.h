@@ -97,6 +97,12 @@ typedef struct _object_stats {
     uint64_t type_cache_dunder_hits;
     uint64_t type_cache_dunder_misses;
     uint64_t type_cache_collisions;
+    /* Free-threaded build: objects queued to their owning thread to have
+       their reference count fields merged (biased reference counting) */
+    uint64_t brc_queued;
+    /* Free-threaded build: frees deferred until QSBR says no thread can
+       still be reading the memory */
+    uint64_t qsbr_deferred;
     /* Temporary value used during GC */
     uint64_t object_visits;
 } ObjectStats;
@@ -168,12 +174,40 @@ typedef struct _rare_event_stats {
     uint64_t watched_globals_modification;
 } RareEventStats;
 
+typedef struct _lock_stats {
+    /* PyMutex acquisitions that found the mutex locked and had to wait */
+    uint64_t slow_path;
+    /* Spin iterations before parking */
+    uint64_t spins;
+    /* Times a waiter was parked */
+    uint64_t parks;
+    /* Times ownership was handed off directly to a parked waiter */
+    uint64_t handoffs;
+    /* Total time spent parked, in nanoseconds */
+    uint64_t park_ns;
+} LockStats;
+
+typedef struct _gil_stats {
+    /* take_gil() calls that found the GIL held and had to wait */
+    uint64_t contended;
+    /* Total time spent waiting in take_gil(), in nanoseconds */
+    uint64_t wait_ns;
+    /* Drop requests sent after waiting a full switch interval */
+    uint64_t drop_requests;
+    /* Times the GIL changed hands to a different thread */
+    uint64_t switches;
+    /* Times drop_gil() waited for another thread to take the GIL */
+    uint64_t forced_switches;
+} GILStats;
+
 typedef struct _stats {
     OpcodeStats opcode_stats[256];
     CallStats call_stats;
     ObjectStats object_stats;
     OptimizationStats optimization_stats;
     RareEventStats rare_event_stats;
+    LockStats lock_stats;
+    GILStats gil_stats;
     GCStats *gc_stats;
 } PyStats;
 
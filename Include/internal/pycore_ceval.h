@@ -106,9 +106,17 @@ extern int _PyPerfTrampoline_Fini(void);
 extern void _PyPerfTrampoline_FreeArenas(void);
 extern int _PyIsPerfTrampolineActive(void);
 extern PyStatus _PyPerfTrampoline_AfterFork_Child(void);
+// Register code which is not a trampoline, like the machine code of a JIT
+// executor, with the active perf map or jitdump backend.
+extern void _PyPerfTrampoline_WriteNamedEntry(const void *code_addr,
+                                              unsigned int code_size,
+                                              const char *name);
 #ifdef PY_HAVE_PERF_TRAMPOLINE
 extern _PyPerf_Callbacks _Py_perfmap_callbacks;
 extern _PyPerf_Callbacks _Py_perfmap_jit_callbacks;
+extern void _PyPerfJit_WriteNamedEntry(const void *code_addr,
+                                       unsigned int code_size,
+                                       const char *name);
 #endif
 
 static inline PyObject*
@@ -293,6 +301,7 @@ PyAPI_FUNC(PyObject *) _PyEval_GetANext(PyObject *aiter);
 PyAPI_FUNC(void) _PyEval_LoadGlobalStackRef(PyObject *globals, PyObject *builtins, PyObject *name, _PyStackRef *writeto);
 PyAPI_FUNC(PyObject *) _PyEval_GetAwaitable(PyObject *iterable, int oparg);
 PyAPI_FUNC(PyObject *) _PyEval_LoadName(PyThreadState *tstate, _PyInterpreterFrame *frame, PyObject *name);
+PyAPI_FUNC(PyObject *) _PyEval_BinarySlice(PyObject *container, PyObject *start, PyObject *stop);
 PyAPI_FUNC(int)
 _Py_Check_ArgsIterable(PyThreadState *tstate, PyObject *func, PyObject *args);
 
@@ -115,8 +115,17 @@ typedef struct {
     uint16_t descr[4];
 } _PyLoadMethodCache;
 
+/* Used by LOAD_ATTR_INSTANCE_VALUE_POLY: two type versions, and the two
+ * matching value offsets packed into the low and high halves of offsets. */
+typedef struct {
+    _Py_BackoffCounter counter;
+    uint16_t type_version[2];
+    uint16_t type_version2[2];
+    uint16_t offsets[2];
+} _PyAttrPolyCache;
+
 
-// MUST be the max(_PyAttrCache, _PyLoadMethodCache)
+// MUST be the max(_PyAttrCache, _PyLoadMethodCache, _PyAttrPolyCache)
 #define INLINE_CACHE_ENTRIES_LOAD_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
 #define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyAttrCache)
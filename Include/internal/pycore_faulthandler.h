@@ -46,6 +46,32 @@ struct faulthandler_user_signal {
 #endif /* FAULTHANDLER_USER */
 
 
+/* Deadline of a slow section, see faulthandler.start_slow_section() */
+struct _faulthandler_slow_section {
+    struct _faulthandler_slow_section *next;
+    PyInterpreterState *interp;
+    PyThreadState *tstate;
+    unsigned long thread_id;
+    PyTime_t start;
+    PyTime_t timeout;
+    PyTime_t deadline;
+    int repeat;
+    /* number of tracebacks recorded for this section */
+    int nrecorded;
+};
+
+/* Traceback recorded by the watchdog when a deadline expired */
+struct _faulthandler_slow_record {
+    unsigned long thread_id;
+    PyTime_t elapsed;
+    char *traceback;
+    size_t size;
+};
+
+/* Size of the ring buffer of recorded tracebacks */
+#define _Py_FAULTHANDLER_SLOW_RECORDS 32
+
+
 struct _faulthandler_runtime_state {
     struct {
         int enabled;
@@ -76,6 +102,26 @@ struct _faulthandler_runtime_state {
         PyThread_type_lock running;
     } thread;
 
+    struct {
+        /* protects the fields below */
+        PyMutex mutex;
+        /* incremented to wake up the watchdog thread */
+        int wakeup;
+        int stop;
+#ifdef HAVE_FORK
+        /* process which started the watchdog thread */
+        pid_t pid;
+#endif
+        /* file used to format the tracebacks, created by the watchdog */
+        int fd;
+        struct _faulthandler_slow_section *sections;
+        struct _faulthandler_slow_record records[_Py_FAULTHANDLER_SLOW_RECORDS];
+        /* total number of recorded tracebacks */
+        size_t nrecords;
+        /* released by the watchdog thread when it exits */
+        PyThread_type_lock running;
+    } slow;
+
 #ifdef FAULTHANDLER_USER
     struct faulthandler_user_signal *user_signals;
 #endif
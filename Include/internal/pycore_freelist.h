@@ -90,6 +90,9 @@ _PyFreeList_Pop(struct _Py_freelist *fl)
         OBJECT_STAT_INC(from_freelist);
         _Py_NewReference(op);
     }
+    else if (LITE_STATS_ON()) {
+        _Py_LiteStats_FreeListMiss(fl);
+    }
     return op;
 }
 
@@ -100,6 +103,9 @@ _PyFreeList_PopMem(struct _Py_freelist *fl)
     if (op != NULL) {
         OBJECT_STAT_INC(from_freelist);
     }
+    else if (LITE_STATS_ON()) {
+        _Py_LiteStats_FreeListMiss(fl);
+    }
     return op;
 }
 
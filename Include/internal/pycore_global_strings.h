@@ -694,6 +694,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(reverse)
         STRUCT_FOR_ID(reversed)
         STRUCT_FOR_ID(salt)
+        STRUCT_FOR_ID(sample_rate_bytes)
         STRUCT_FOR_ID(sched_priority)
         STRUCT_FOR_ID(scheduler)
         STRUCT_FOR_ID(script)
@@ -785,6 +786,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(unraisablehook)
         STRUCT_FOR_ID(uri)
         STRUCT_FOR_ID(usedforsecurity)
+        STRUCT_FOR_ID(utcoffset)
         STRUCT_FOR_ID(value)
         STRUCT_FOR_ID(values)
         STRUCT_FOR_ID(version)
@@ -77,6 +77,12 @@ PyHamtObject * _PyHamt_New(void);
    key/val pair. */
 PyHamtObject * _PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val);
 
+/* Like _PyHamt_Assoc(), but if "o" is not shared it is updated in place
+   and a new reference to it is returned.  The caller must own a reference
+   to "o" and must not rely on its old contents afterwards. */
+PyHamtObject * _PyHamt_AssocInPlace(PyHamtObject *o, PyObject *key,
+                                    PyObject *val);
+
 /* Return a new collection based on "o", but without "key". */
 PyHamtObject * _PyHamt_Without(PyHamtObject *o, PyObject *key);
 
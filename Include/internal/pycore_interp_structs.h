@@ -181,6 +181,8 @@ struct gc_collection_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* time spent in the collection, in seconds */
+    double duration;
 };
 
 /* Running stats per generation */
@@ -191,6 +193,8 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total time spent collecting this generation, in seconds */
+    double duration;
 };
 
 enum _GCPhase {
@@ -393,6 +397,24 @@ typedef struct _rare_events {
     uint8_t func_modification;
 } _rare_events;
 
+/* Why an executor stopped being valid, see sys._jit.get_invalidations() */
+typedef enum {
+    /* Its code object was freed, or it was garbage collected */
+    _Py_EXECUTOR_FREED = 0,
+    /* A dict, type or code object it depends on was modified */
+    _Py_EXECUTOR_INVALIDATED_DICT,
+    _Py_EXECUTOR_INVALIDATED_TYPE,
+    _Py_EXECUTOR_INVALIDATED_CODE,
+    _Py_EXECUTOR_INVALIDATED_OTHER,
+    /* All executors were invalidated, e.g. by sys.monitoring */
+    _Py_EXECUTOR_INVALIDATED_ALL,
+    /* It was not run since the last check for cold executors */
+    _Py_EXECUTOR_INVALIDATED_COLD,
+    /* All executors were cleared, e.g. by sys._clear_internal_caches() */
+    _Py_EXECUTOR_CLEARED,
+    _Py_EXECUTOR_INVALIDATION_REASONS
+} _PyExecutorInvalidationReason;
+
 struct
 Bigint {
     struct Bigint *next;
@@ -498,10 +520,21 @@ struct type_cache_entry {
     PyObject *value;       // borrowed reference or NULL
 };
 
+// Default number of entries, see PyConfig.type_cache_size
 #define MCACHE_SIZE_EXP 12
+#define MCACHE_MIN_SIZE (1 << 8)
+#define MCACHE_MAX_SIZE (1 << 24)
+// The cache is set-associative: a (type version, name) pair can be stored
+// in any of the MCACHE_WAYS consecutive entries of its set.
+#define MCACHE_WAYS 2
 
 struct type_cache {
-    struct type_cache_entry hashtable[1 << MCACHE_SIZE_EXP];
+    // Points to 'initial', or to a heap array if PyConfig.type_cache_size
+    // is not the default
+    struct type_cache_entry *hashtable;
+    // Number of sets minus one
+    unsigned int mask;
+    struct type_cache_entry initial[1 << MCACHE_SIZE_EXP];
 };
 
 typedef struct {
@@ -945,8 +978,11 @@ struct _is {
     struct _PyExecutorObject *executor_list_head;
     struct _PyExecutorObject *executor_deletion_list_head;
     int executor_deletion_list_remaining_capacity;
+    uint64_t executor_invalidations[_Py_EXECUTOR_INVALIDATION_REASONS];
     size_t trace_run_counter;
     _rare_events rare_events;
+    // Lightweight statistics of the deleted thread states (see pycore_stats.h)
+    struct _PyLiteStats *lite_stats;
     PyDict_WatchCallback builtins_dict_watcher;
 
     _Py_GlobalMonitors monitors;
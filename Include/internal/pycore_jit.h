@@ -19,6 +19,7 @@ typedef _Py_CODEUNIT *(*jit_func)(_PyInterpreterFrame *frame, _PyStackRef *stack
 
 int _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction *trace, size_t length);
 void _PyJIT_Free(_PyExecutorObject *executor);
+void _PyJIT_WritePerfEntries(_PyExecutorObject *executor, PyCodeObject *code);
 
 #endif  // _Py_JIT
 
@@ -206,12 +206,18 @@ typedef unsigned int pymem_uint;  /* assuming >= 16 bits */
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * The arena size can be overridden with -DARENA_BITS=21.  Arenas of 2 MiB
+ * or more are aligned on their size and, where madvise(MADV_HUGEPAGE) is
+ * available, can be backed by transparent huge pages.
  */
+#ifndef ARENA_BITS
 #ifdef USE_LARGE_ARENAS
 #define ARENA_BITS              20                    /* 1 MiB */
 #else
 #define ARENA_BITS              18                    /* 256 KiB */
 #endif
+#endif
 #define ARENA_SIZE              (1 << ARENA_BITS)
 #define ARENA_SIZE_MASK         (ARENA_SIZE - 1)
 
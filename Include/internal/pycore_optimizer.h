@@ -35,6 +35,7 @@ typedef struct {
     uint8_t linked:1;
     uint8_t chain_depth:6;  // Must be big enough for MAX_CHAIN_DEPTH - 1.
     bool warm;
+    uint8_t invalidation_reason;  // _PyExecutorInvalidationReason, once invalid
     int index;           // Index of ENTER_EXECUTOR (if code isn't NULL, below).
     _PyBloomFilter bloom;
     _PyExecutorLinkListNode links;
@@ -364,6 +365,9 @@ static inline int is_terminator(const _PyUOpInstruction *uop)
 }
 
 PyAPI_FUNC(int) _PyDumpExecutors(FILE *out);
+// Used by sys._jit.get_executors() and sys._jit.get_invalidations()
+extern PyObject* _Py_GetExecutorsInfo(PyCodeObject *code);
+extern PyObject* _Py_GetExecutorInvalidations(PyInterpreterState *interp);
 #ifdef _Py_TIER2
 extern void _Py_ClearExecutorDeletionList(PyInterpreterState *interp);
 #endif
@@ -15,6 +15,12 @@ extern void _Py_StatsClear(void);
 extern int _Py_PrintSpecializationStats(int to_file);
 #endif
 
+// Lightweight statistics, available in all builds (see pycore_stats.h)
+extern void _Py_LiteStatsOn(void);
+extern void _Py_LiteStatsOff(void);
+extern void _Py_LiteStatsClear(void);
+extern PyObject* _Py_GetLiteStats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1201,6 +1201,7 @@ extern "C" {
     INIT_ID(reverse), \
     INIT_ID(reversed), \
     INIT_ID(salt), \
+    INIT_ID(sample_rate_bytes), \
     INIT_ID(sched_priority), \
     INIT_ID(scheduler), \
     INIT_ID(script), \
@@ -1292,6 +1293,7 @@ extern "C" {
     INIT_ID(unraisablehook), \
     INIT_ID(uri), \
     INIT_ID(usedforsecurity), \
+    INIT_ID(utcoffset), \
     INIT_ID(value), \
     INIT_ID(values), \
     INIT_ID(version), \
@@ -8,6 +8,8 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
+#include "pycore_freelist_state.h"  // struct _Py_freelists
+#include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_INT_RELAXED()
 #include "pycore_structs.h"     //
 
 
@@ -47,6 +49,23 @@ extern "C" {
         } \
     } while (0)
 #define RARE_EVENT_STAT_INC(name) do { if (_Py_stats) _Py_stats->rare_event_stats.name++; } while (0)
+// PyMutex is used without the GIL (and by threads without a thread state),
+// so lock stats are updated atomically.
+#define LOCK_STAT_INC(name) LOCK_STAT_ADD(name, 1)
+#define LOCK_STAT_ADD(name, n) \
+    do { \
+        if (_Py_stats) { \
+            _Py_atomic_add_uint64(&_Py_stats->lock_stats.name, (uint64_t)(n)); \
+        } \
+    } while (0)
+// Each interpreter can have its own GIL, so GIL stats are updated atomically.
+#define GIL_STAT_INC(name) GIL_STAT_ADD(name, 1)
+#define GIL_STAT_ADD(name, n) \
+    do { \
+        if (_Py_stats) { \
+            _Py_atomic_add_uint64(&_Py_stats->gil_stats.name, (uint64_t)(n)); \
+        } \
+    } while (0)
 #define OPCODE_DEFERRED_INC(opname) do { if (_Py_stats && opcode == opname) _Py_stats->opcode_stats[opname].specialization.deferred++; } while (0)
 
 // Export for '_opcode' shared extension
@@ -70,10 +89,71 @@ PyAPI_FUNC(PyObject*) _Py_GetSpecializationStats(void);
 #define OPT_ERROR_IN_OPCODE(opname) ((void)0)
 #define OPT_HIST(length, name) ((void)0)
 #define RARE_EVENT_STAT_INC(name) ((void)0)
+#define LOCK_STAT_INC(name) ((void)0)
+#define LOCK_STAT_ADD(name, n) ((void)0)
+#define GIL_STAT_INC(name) ((void)0)
+#define GIL_STAT_ADD(name, n) ((void)0)
 #define OPCODE_DEFERRED_INC(opname) ((void)0)
 #endif  // !Py_STATS
 
 
+// Lightweight statistics, available in all builds.
+//
+// A small subset of the Py_STATS counters that is cheap enough for
+// production use: deoptimizations of specialized instructions, the reasons
+// why instructions failed to specialize, executor invalidations, freelist
+// and type attribute cache misses. They are turned on and off by
+// sys._stats_on() and sys._stats_off(), and read by sys._stats_get().
+// Counters are only updated on slow paths: a deoptimization is counted when
+// the instruction is respecialized, and hits are not counted at all.
+//
+// The counters are kept per thread, allocated on first use, and added to
+// the interpreter's totals when the thread state is deleted. They are
+// updated without atomics, so readers stop the world.
+
+// Number of families of specializable instructions that are counted.
+#define _Py_LITE_STATS_FAMILIES 16
+// Same as SPECIALIZATION_FAILURE_KINDS in Include/cpython/pystats.h
+#define _Py_LITE_STATS_FAILURE_KINDS 60
+#define _Py_LITE_STATS_FREELISTS \
+    (sizeof(struct _Py_freelists) / sizeof(struct _Py_freelist))
+
+typedef struct _PyLiteStats {
+    // Indexed by the specialized opcode which was respecialized
+    uint64_t deopts[256];
+    // Indexed by family (see _Py_LiteStats_SpecializationFail()) and kind
+    uint64_t specialization_failures[_Py_LITE_STATS_FAMILIES][_Py_LITE_STATS_FAILURE_KINDS];
+    uint64_t executors_invalidated;
+    // Indexed by the position of the freelist in struct _Py_freelists
+    uint64_t freelist_misses[_Py_LITE_STATS_FREELISTS];
+    // Type attribute cache, see _PyType_Lookup()
+    uint64_t type_cache_misses;
+    uint64_t type_cache_evictions;
+} _PyLiteStats;
+
+// Export for shared extensions using freelists
+PyAPI_DATA(int) _Py_lite_stats_on;
+
+// Return the counters of the current thread, or NULL on memory error.
+extern _PyLiteStats* _Py_LiteStats_Get(void);
+// Add *src* to the counters of *interp* and free it. Called with HEAD_LOCK.
+extern void _Py_LiteStats_Merge(PyInterpreterState *interp, _PyLiteStats *src);
+extern void _Py_LiteStats_SpecializationFail(int opcode, int kind);
+// Export for shared extensions using freelists
+PyAPI_FUNC(void) _Py_LiteStats_FreeListMiss(struct _Py_freelist *fl);
+
+#define LITE_STATS_ON() FT_ATOMIC_LOAD_INT_RELAXED(_Py_lite_stats_on)
+#define LITE_STAT_INC(name) \
+    do { \
+        if (LITE_STATS_ON()) { \
+            _PyLiteStats *_lite_stats = _Py_LiteStats_Get(); \
+            if (_lite_stats != NULL) { \
+                _lite_stats->name++; \
+            } \
+        } \
+    } while (0)
+
+
 #define RARE_EVENT_INTERP_INC(interp, name) \
     do { \
         /* saturating add */ \
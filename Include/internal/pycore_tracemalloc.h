@@ -27,6 +27,10 @@ struct _PyTraceMalloc_Config {
     /* limit of the number of frames in a traceback, 1 by default.
        Variable protected by the GIL. */
     int max_nframe;
+
+    /* Mean number of bytes between two sampled allocations, or 0 to trace
+       all allocations. Only modified while the hooks are not installed. */
+    size_t sample_rate;
 };
 
 
@@ -106,6 +110,7 @@ struct _tracemalloc_runtime_state {
             .initialized = TRACEMALLOC_NOT_INITIALIZED, \
             .tracing = 0, \
             .max_nframe = 1, \
+            .sample_rate = 0, \
         }, \
         .reentrant_key = Py_tss_NEEDS_INIT, \
     }
@@ -141,7 +146,7 @@ extern PyObject* _PyTraceMalloc_GetObjectTraceback(PyObject *obj);
 extern PyStatus _PyTraceMalloc_Init(void);
 
 /* Start tracemalloc */
-extern int _PyTraceMalloc_Start(int max_nframe);
+extern int _PyTraceMalloc_Start(int max_nframe, size_t sample_rate);
 
 /* Stop tracemalloc */
 extern void _PyTraceMalloc_Stop(void);
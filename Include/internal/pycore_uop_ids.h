@@ -47,133 +47,135 @@ extern "C" {
 #define _CALL_INTRINSIC_1 CALL_INTRINSIC_1
 #define _CALL_INTRINSIC_2 CALL_INTRINSIC_2
 #define _CALL_ISINSTANCE 327
-#define _CALL_KW_NON_PY 328
-#define _CALL_LEN 329
-#define _CALL_LIST_APPEND 330
-#define _CALL_METHOD_DESCRIPTOR_FAST 331
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 332
-#define _CALL_METHOD_DESCRIPTOR_NOARGS 333
-#define _CALL_METHOD_DESCRIPTOR_O 334
-#define _CALL_NON_PY_GENERAL 335
-#define _CALL_STR_1 336
-#define _CALL_TUPLE_1 337
-#define _CALL_TYPE_1 338
-#define _CHECK_AND_ALLOCATE_OBJECT 339
-#define _CHECK_ATTR_CLASS 340
-#define _CHECK_ATTR_METHOD_LAZY_DICT 341
-#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 342
+#define _CALL_KW_BUILTIN_FAST_WITH_KEYWORDS 328
+#define _CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 329
+#define _CALL_KW_NON_PY 330
+#define _CALL_LEN 331
+#define _CALL_LIST_APPEND 332
+#define _CALL_METHOD_DESCRIPTOR_FAST 333
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 334
+#define _CALL_METHOD_DESCRIPTOR_NOARGS 335
+#define _CALL_METHOD_DESCRIPTOR_O 336
+#define _CALL_NON_PY_GENERAL 337
+#define _CALL_STR_1 338
+#define _CALL_TUPLE_1 339
+#define _CALL_TYPE_1 340
+#define _CHECK_AND_ALLOCATE_OBJECT 341
+#define _CHECK_ATTR_CLASS 342
+#define _CHECK_ATTR_METHOD_LAZY_DICT 343
+#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 344
 #define _CHECK_EG_MATCH CHECK_EG_MATCH
 #define _CHECK_EXC_MATCH CHECK_EXC_MATCH
-#define _CHECK_FUNCTION 343
-#define _CHECK_FUNCTION_EXACT_ARGS 344
-#define _CHECK_FUNCTION_VERSION 345
-#define _CHECK_FUNCTION_VERSION_INLINE 346
-#define _CHECK_FUNCTION_VERSION_KW 347
-#define _CHECK_IS_NOT_PY_CALLABLE 348
-#define _CHECK_IS_NOT_PY_CALLABLE_KW 349
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES 350
-#define _CHECK_METHOD_VERSION 351
-#define _CHECK_METHOD_VERSION_KW 352
-#define _CHECK_PEP_523 353
-#define _CHECK_PERIODIC 354
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 355
-#define _CHECK_RECURSION_REMAINING 356
-#define _CHECK_STACK_SPACE 357
-#define _CHECK_STACK_SPACE_OPERAND 358
-#define _CHECK_VALIDITY 359
-#define _COMPARE_OP 360
-#define _COMPARE_OP_FLOAT 361
-#define _COMPARE_OP_INT 362
-#define _COMPARE_OP_STR 363
-#define _CONTAINS_OP 364
-#define _CONTAINS_OP_DICT 365
-#define _CONTAINS_OP_SET 366
+#define _CHECK_FUNCTION 345
+#define _CHECK_FUNCTION_EXACT_ARGS 346
+#define _CHECK_FUNCTION_VERSION 347
+#define _CHECK_FUNCTION_VERSION_INLINE 348
+#define _CHECK_FUNCTION_VERSION_KW 349
+#define _CHECK_IS_NOT_PY_CALLABLE 350
+#define _CHECK_IS_NOT_PY_CALLABLE_KW 351
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES 352
+#define _CHECK_METHOD_VERSION 353
+#define _CHECK_METHOD_VERSION_KW 354
+#define _CHECK_PEP_523 355
+#define _CHECK_PERIODIC 356
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 357
+#define _CHECK_RECURSION_REMAINING 358
+#define _CHECK_STACK_SPACE 359
+#define _CHECK_STACK_SPACE_OPERAND 360
+#define _CHECK_VALIDITY 361
+#define _COMPARE_OP 362
+#define _COMPARE_OP_FLOAT 363
+#define _COMPARE_OP_INT 364
+#define _COMPARE_OP_STR 365
+#define _CONTAINS_OP 366
+#define _CONTAINS_OP_DICT 367
+#define _CONTAINS_OP_SET 368
 #define _CONVERT_VALUE CONVERT_VALUE
-#define _COPY 367
-#define _COPY_1 368
-#define _COPY_2 369
-#define _COPY_3 370
+#define _COPY 369
+#define _COPY_1 370
+#define _COPY_2 371
+#define _COPY_3 372
 #define _COPY_FREE_VARS COPY_FREE_VARS
-#define _CREATE_INIT_FRAME 371
+#define _CREATE_INIT_FRAME 373
 #define _DELETE_ATTR DELETE_ATTR
 #define _DELETE_DEREF DELETE_DEREF
 #define _DELETE_FAST DELETE_FAST
 #define _DELETE_GLOBAL DELETE_GLOBAL
 #define _DELETE_NAME DELETE_NAME
 #define _DELETE_SUBSCR DELETE_SUBSCR
-#define _DEOPT 372
+#define _DEOPT 374
 #define _DICT_MERGE DICT_MERGE
 #define _DICT_UPDATE DICT_UPDATE
-#define _DO_CALL 373
-#define _DO_CALL_FUNCTION_EX 374
-#define _DO_CALL_KW 375
+#define _DO_CALL 375
+#define _DO_CALL_FUNCTION_EX 376
+#define _DO_CALL_KW 377
 #define _END_FOR END_FOR
 #define _END_SEND END_SEND
-#define _ERROR_POP_N 376
+#define _ERROR_POP_N 378
 #define _EXIT_INIT_CHECK EXIT_INIT_CHECK
-#define _EXPAND_METHOD 377
-#define _EXPAND_METHOD_KW 378
-#define _FATAL_ERROR 379
+#define _EXPAND_METHOD 379
+#define _EXPAND_METHOD_KW 380
+#define _FATAL_ERROR 381
 #define _FORMAT_SIMPLE FORMAT_SIMPLE
 #define _FORMAT_WITH_SPEC FORMAT_WITH_SPEC
-#define _FOR_ITER 380
-#define _FOR_ITER_GEN_FRAME 381
-#define _FOR_ITER_TIER_TWO 382
+#define _FOR_ITER 382
+#define _FOR_ITER_GEN_FRAME 383
+#define _FOR_ITER_TIER_TWO 384
 #define _GET_AITER GET_AITER
 #define _GET_ANEXT GET_ANEXT
 #define _GET_AWAITABLE GET_AWAITABLE
 #define _GET_ITER GET_ITER
 #define _GET_LEN GET_LEN
 #define _GET_YIELD_FROM_ITER GET_YIELD_FROM_ITER
-#define _GUARD_BINARY_OP_EXTEND 383
-#define _GUARD_CALLABLE_ISINSTANCE 384
-#define _GUARD_CALLABLE_LEN 385
-#define _GUARD_CALLABLE_LIST_APPEND 386
-#define _GUARD_CALLABLE_STR_1 387
-#define _GUARD_CALLABLE_TUPLE_1 388
-#define _GUARD_CALLABLE_TYPE_1 389
-#define _GUARD_DORV_NO_DICT 390
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 391
-#define _GUARD_GLOBALS_VERSION 392
-#define _GUARD_IS_FALSE_POP 393
-#define _GUARD_IS_NONE_POP 394
-#define _GUARD_IS_NOT_NONE_POP 395
-#define _GUARD_IS_TRUE_POP 396
-#define _GUARD_KEYS_VERSION 397
-#define _GUARD_NOS_DICT 398
-#define _GUARD_NOS_FLOAT 399
-#define _GUARD_NOS_INT 400
-#define _GUARD_NOS_LIST 401
-#define _GUARD_NOS_NOT_NULL 402
-#define _GUARD_NOS_NULL 403
-#define _GUARD_NOS_OVERFLOWED 404
-#define _GUARD_NOS_TUPLE 405
-#define _GUARD_NOS_UNICODE 406
-#define _GUARD_NOT_EXHAUSTED_LIST 407
-#define _GUARD_NOT_EXHAUSTED_RANGE 408
-#define _GUARD_NOT_EXHAUSTED_TUPLE 409
-#define _GUARD_THIRD_NULL 410
-#define _GUARD_TOS_ANY_SET 411
-#define _GUARD_TOS_DICT 412
-#define _GUARD_TOS_FLOAT 413
-#define _GUARD_TOS_INT 414
-#define _GUARD_TOS_LIST 415
-#define _GUARD_TOS_OVERFLOWED 416
-#define _GUARD_TOS_SLICE 417
-#define _GUARD_TOS_TUPLE 418
-#define _GUARD_TOS_UNICODE 419
-#define _GUARD_TYPE_VERSION 420
-#define _GUARD_TYPE_VERSION_AND_LOCK 421
+#define _GUARD_BINARY_OP_EXTEND 385
+#define _GUARD_CALLABLE_ISINSTANCE 386
+#define _GUARD_CALLABLE_LEN 387
+#define _GUARD_CALLABLE_LIST_APPEND 388
+#define _GUARD_CALLABLE_STR_1 389
+#define _GUARD_CALLABLE_TUPLE_1 390
+#define _GUARD_CALLABLE_TYPE_1 391
+#define _GUARD_DORV_NO_DICT 392
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 393
+#define _GUARD_GLOBALS_VERSION 394
+#define _GUARD_IS_FALSE_POP 395
+#define _GUARD_IS_NONE_POP 396
+#define _GUARD_IS_NOT_NONE_POP 397
+#define _GUARD_IS_TRUE_POP 398
+#define _GUARD_KEYS_VERSION 399
+#define _GUARD_NOS_DICT 400
+#define _GUARD_NOS_FLOAT 401
+#define _GUARD_NOS_INT 402
+#define _GUARD_NOS_LIST 403
+#define _GUARD_NOS_NOT_NULL 404
+#define _GUARD_NOS_NULL 405
+#define _GUARD_NOS_OVERFLOWED 406
+#define _GUARD_NOS_TUPLE 407
+#define _GUARD_NOS_UNICODE 408
+#define _GUARD_NOT_EXHAUSTED_LIST 409
+#define _GUARD_NOT_EXHAUSTED_RANGE 410
+#define _GUARD_NOT_EXHAUSTED_TUPLE 411
+#define _GUARD_THIRD_NULL 412
+#define _GUARD_TOS_ANY_SET 413
+#define _GUARD_TOS_DICT 414
+#define _GUARD_TOS_FLOAT 415
+#define _GUARD_TOS_INT 416
+#define _GUARD_TOS_LIST 417
+#define _GUARD_TOS_OVERFLOWED 418
+#define _GUARD_TOS_SLICE 419
+#define _GUARD_TOS_TUPLE 420
+#define _GUARD_TOS_UNICODE 421
+#define _GUARD_TYPE_VERSION 422
+#define _GUARD_TYPE_VERSION_AND_LOCK 423
 #define _IMPORT_FROM IMPORT_FROM
 #define _IMPORT_NAME IMPORT_NAME
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 422
-#define _INIT_CALL_PY_EXACT_ARGS 423
-#define _INIT_CALL_PY_EXACT_ARGS_0 424
-#define _INIT_CALL_PY_EXACT_ARGS_1 425
-#define _INIT_CALL_PY_EXACT_ARGS_2 426
-#define _INIT_CALL_PY_EXACT_ARGS_3 427
-#define _INIT_CALL_PY_EXACT_ARGS_4 428
-#define _INSERT_NULL 429
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 424
+#define _INIT_CALL_PY_EXACT_ARGS 425
+#define _INIT_CALL_PY_EXACT_ARGS_0 426
+#define _INIT_CALL_PY_EXACT_ARGS_1 427
+#define _INIT_CALL_PY_EXACT_ARGS_2 428
+#define _INIT_CALL_PY_EXACT_ARGS_3 429
+#define _INIT_CALL_PY_EXACT_ARGS_4 430
+#define _INSERT_NULL 431
 #define _INSTRUMENTED_FOR_ITER INSTRUMENTED_FOR_ITER
 #define _INSTRUMENTED_INSTRUCTION INSTRUMENTED_INSTRUCTION
 #define _INSTRUMENTED_JUMP_FORWARD INSTRUMENTED_JUMP_FORWARD
@@ -183,177 +185,178 @@ extern "C" {
 #define _INSTRUMENTED_POP_JUMP_IF_NONE INSTRUMENTED_POP_JUMP_IF_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE INSTRUMENTED_POP_JUMP_IF_NOT_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_TRUE INSTRUMENTED_POP_JUMP_IF_TRUE
-#define _IS_NONE 430
+#define _IS_NONE 432
 #define _IS_OP IS_OP
-#define _ITER_CHECK_LIST 431
-#define _ITER_CHECK_RANGE 432
-#define _ITER_CHECK_TUPLE 433
-#define _ITER_JUMP_LIST 434
-#define _ITER_JUMP_RANGE 435
-#define _ITER_JUMP_TUPLE 436
-#define _ITER_NEXT_LIST 437
-#define _ITER_NEXT_LIST_TIER_TWO 438
-#define _ITER_NEXT_RANGE 439
-#define _ITER_NEXT_TUPLE 440
-#define _JUMP_TO_TOP 441
+#define _ITER_CHECK_LIST 433
+#define _ITER_CHECK_RANGE 434
+#define _ITER_CHECK_TUPLE 435
+#define _ITER_JUMP_LIST 436
+#define _ITER_JUMP_RANGE 437
+#define _ITER_JUMP_TUPLE 438
+#define _ITER_NEXT_LIST 439
+#define _ITER_NEXT_LIST_TIER_TWO 440
+#define _ITER_NEXT_RANGE 441
+#define _ITER_NEXT_TUPLE 442
+#define _JUMP_TO_TOP 443
 #define _LIST_APPEND LIST_APPEND
 #define _LIST_EXTEND LIST_EXTEND
-#define _LOAD_ATTR 442
-#define _LOAD_ATTR_CLASS 443
+#define _LOAD_ATTR 444
+#define _LOAD_ATTR_CLASS 445
 #define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN
-#define _LOAD_ATTR_INSTANCE_VALUE 444
-#define _LOAD_ATTR_METHOD_LAZY_DICT 445
-#define _LOAD_ATTR_METHOD_NO_DICT 446
-#define _LOAD_ATTR_METHOD_WITH_VALUES 447
-#define _LOAD_ATTR_MODULE 448
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 449
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 450
-#define _LOAD_ATTR_PROPERTY_FRAME 451
-#define _LOAD_ATTR_SLOT 452
-#define _LOAD_ATTR_WITH_HINT 453
+#define _LOAD_ATTR_INSTANCE_VALUE 446
+#define _LOAD_ATTR_METHOD_LAZY_DICT 447
+#define _LOAD_ATTR_METHOD_NO_DICT 448
+#define _LOAD_ATTR_METHOD_WITH_VALUES 449
+#define _LOAD_ATTR_MODULE 450
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 451
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 452
+#define _LOAD_ATTR_PROPERTY_FRAME 453
+#define _LOAD_ATTR_SLOT 454
+#define _LOAD_ATTR_WITH_HINT 455
 #define _LOAD_BUILD_CLASS LOAD_BUILD_CLASS
-#define _LOAD_BYTECODE 454
+#define _LOAD_BYTECODE 456
 #define _LOAD_COMMON_CONSTANT LOAD_COMMON_CONSTANT
 #define _LOAD_CONST LOAD_CONST
-#define _LOAD_CONST_INLINE 455
-#define _LOAD_CONST_INLINE_BORROW 456
-#define _LOAD_CONST_UNDER_INLINE 457
-#define _LOAD_CONST_UNDER_INLINE_BORROW 458
+#define _LOAD_CONST_INLINE 457
+#define _LOAD_CONST_INLINE_BORROW 458
+#define _LOAD_CONST_UNDER_INLINE 459
+#define _LOAD_CONST_UNDER_INLINE_BORROW 460
 #define _LOAD_DEREF LOAD_DEREF
-#define _LOAD_FAST 459
-#define _LOAD_FAST_0 460
-#define _LOAD_FAST_1 461
-#define _LOAD_FAST_2 462
-#define _LOAD_FAST_3 463
-#define _LOAD_FAST_4 464
-#define _LOAD_FAST_5 465
-#define _LOAD_FAST_6 466
-#define _LOAD_FAST_7 467
+#define _LOAD_FAST 461
+#define _LOAD_FAST_0 462
+#define _LOAD_FAST_1 463
+#define _LOAD_FAST_2 464
+#define _LOAD_FAST_3 465
+#define _LOAD_FAST_4 466
+#define _LOAD_FAST_5 467
+#define _LOAD_FAST_6 468
+#define _LOAD_FAST_7 469
 #define _LOAD_FAST_AND_CLEAR LOAD_FAST_AND_CLEAR
-#define _LOAD_FAST_BORROW 468
-#define _LOAD_FAST_BORROW_0 469
-#define _LOAD_FAST_BORROW_1 470
-#define _LOAD_FAST_BORROW_2 471
-#define _LOAD_FAST_BORROW_3 472
-#define _LOAD_FAST_BORROW_4 473
-#define _LOAD_FAST_BORROW_5 474
-#define _LOAD_FAST_BORROW_6 475
-#define _LOAD_FAST_BORROW_7 476
+#define _LOAD_FAST_BORROW 470
+#define _LOAD_FAST_BORROW_0 471
+#define _LOAD_FAST_BORROW_1 472
+#define _LOAD_FAST_BORROW_2 473
+#define _LOAD_FAST_BORROW_3 474
+#define _LOAD_FAST_BORROW_4 475
+#define _LOAD_FAST_BORROW_5 476
+#define _LOAD_FAST_BORROW_6 477
+#define _LOAD_FAST_BORROW_7 478
 #define _LOAD_FAST_BORROW_LOAD_FAST_BORROW LOAD_FAST_BORROW_LOAD_FAST_BORROW
 #define _LOAD_FAST_CHECK LOAD_FAST_CHECK
 #define _LOAD_FAST_LOAD_FAST LOAD_FAST_LOAD_FAST
 #define _LOAD_FROM_DICT_OR_DEREF LOAD_FROM_DICT_OR_DEREF
 #define _LOAD_FROM_DICT_OR_GLOBALS LOAD_FROM_DICT_OR_GLOBALS
-#define _LOAD_GLOBAL 477
-#define _LOAD_GLOBAL_BUILTINS 478
-#define _LOAD_GLOBAL_MODULE 479
+#define _LOAD_GLOBAL 479
+#define _LOAD_GLOBAL_BUILTINS 480
+#define _LOAD_GLOBAL_MODULE 481
 #define _LOAD_LOCALS LOAD_LOCALS
 #define _LOAD_NAME LOAD_NAME
-#define _LOAD_SMALL_INT 480
-#define _LOAD_SMALL_INT_0 481
-#define _LOAD_SMALL_INT_1 482
-#define _LOAD_SMALL_INT_2 483
-#define _LOAD_SMALL_INT_3 484
-#define _LOAD_SPECIAL 485
+#define _LOAD_SMALL_INT 482
+#define _LOAD_SMALL_INT_0 483
+#define _LOAD_SMALL_INT_1 484
+#define _LOAD_SMALL_INT_2 485
+#define _LOAD_SMALL_INT_3 486
+#define _LOAD_SPECIAL 487
 #define _LOAD_SUPER_ATTR_ATTR LOAD_SUPER_ATTR_ATTR
 #define _LOAD_SUPER_ATTR_METHOD LOAD_SUPER_ATTR_METHOD
-#define _MAKE_CALLARGS_A_TUPLE 486
+#define _MAKE_CALLARGS_A_TUPLE 488
 #define _MAKE_CELL MAKE_CELL
 #define _MAKE_FUNCTION MAKE_FUNCTION
-#define _MAKE_WARM 487
+#define _MAKE_WARM 489
 #define _MAP_ADD MAP_ADD
 #define _MATCH_CLASS MATCH_CLASS
 #define _MATCH_KEYS MATCH_KEYS
 #define _MATCH_MAPPING MATCH_MAPPING
 #define _MATCH_SEQUENCE MATCH_SEQUENCE
-#define _MAYBE_EXPAND_METHOD 488
-#define _MAYBE_EXPAND_METHOD_KW 489
-#define _MONITOR_CALL 490
-#define _MONITOR_CALL_KW 491
-#define _MONITOR_JUMP_BACKWARD 492
-#define _MONITOR_RESUME 493
+#define _MAYBE_EXPAND_METHOD 490
+#define _MAYBE_EXPAND_METHOD_KW 491
+#define _MONITOR_CALL 492
+#define _MONITOR_CALL_KW 493
+#define _MONITOR_JUMP_BACKWARD 494
+#define _MONITOR_RESUME 495
 #define _NOP NOP
-#define _POP_CALL 494
-#define _POP_CALL_LOAD_CONST_INLINE_BORROW 495
-#define _POP_CALL_ONE 496
-#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW 497
-#define _POP_CALL_TWO 498
-#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW 499
+#define _POP_CALL 496
+#define _POP_CALL_LOAD_CONST_INLINE_BORROW 497
+#define _POP_CALL_ONE 498
+#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW 499
+#define _POP_CALL_TWO 500
+#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW 501
 #define _POP_EXCEPT POP_EXCEPT
 #define _POP_ITER POP_ITER
-#define _POP_JUMP_IF_FALSE 500
-#define _POP_JUMP_IF_TRUE 501
+#define _POP_JUMP_IF_FALSE 502
+#define _POP_JUMP_IF_TRUE 503
 #define _POP_TOP POP_TOP
-#define _POP_TOP_FLOAT 502
-#define _POP_TOP_INT 503
-#define _POP_TOP_LOAD_CONST_INLINE 504
-#define _POP_TOP_LOAD_CONST_INLINE_BORROW 505
-#define _POP_TOP_NOP 506
-#define _POP_TOP_UNICODE 507
-#define _POP_TWO 508
-#define _POP_TWO_LOAD_CONST_INLINE_BORROW 509
+#define _POP_TOP_FLOAT 504
+#define _POP_TOP_INT 505
+#define _POP_TOP_LOAD_CONST_INLINE 506
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW 507
+#define _POP_TOP_NOP 508
+#define _POP_TOP_UNICODE 509
+#define _POP_TWO 510
+#define _POP_TWO_LOAD_CONST_INLINE_BORROW 511
 #define _PUSH_EXC_INFO PUSH_EXC_INFO
-#define _PUSH_FRAME 510
+#define _PUSH_FRAME 512
 #define _PUSH_NULL PUSH_NULL
-#define _PUSH_NULL_CONDITIONAL 511
-#define _PY_FRAME_GENERAL 512
-#define _PY_FRAME_KW 513
-#define _QUICKEN_RESUME 514
-#define _REPLACE_WITH_TRUE 515
+#define _PUSH_NULL_CONDITIONAL 513
+#define _PY_FRAME_GENERAL 514
+#define _PY_FRAME_KW 515
+#define _QUICKEN_RESUME 516
+#define _REPLACE_WITH_TRUE 517
 #define _RESUME_CHECK RESUME_CHECK
 #define _RETURN_GENERATOR RETURN_GENERATOR
 #define _RETURN_VALUE RETURN_VALUE
-#define _SAVE_RETURN_OFFSET 516
-#define _SEND 517
-#define _SEND_GEN_FRAME 518
+#define _SAVE_RETURN_OFFSET 518
+#define _SEND 519
+#define _SEND_GEN_FRAME 520
 #define _SETUP_ANNOTATIONS SETUP_ANNOTATIONS
 #define _SET_ADD SET_ADD
 #define _SET_FUNCTION_ATTRIBUTE SET_FUNCTION_ATTRIBUTE
 #define _SET_UPDATE SET_UPDATE
-#define _START_EXECUTOR 519
-#define _STORE_ATTR 520
-#define _STORE_ATTR_INSTANCE_VALUE 521
-#define _STORE_ATTR_SLOT 522
-#define _STORE_ATTR_WITH_HINT 523
+#define _START_EXECUTOR 521
+#define _STORE_ATTR 522
+#define _STORE_ATTR_INSTANCE_VALUE 523
+#define _STORE_ATTR_SLOT 524
+#define _STORE_ATTR_WITH_HINT 525
 #define _STORE_DEREF STORE_DEREF
-#define _STORE_FAST 524
-#define _STORE_FAST_0 525
-#define _STORE_FAST_1 526
-#define _STORE_FAST_2 527
-#define _STORE_FAST_3 528
-#define _STORE_FAST_4 529
-#define _STORE_FAST_5 530
-#define _STORE_FAST_6 531
-#define _STORE_FAST_7 532
+#define _STORE_FAST 526
+#define _STORE_FAST_0 527
+#define _STORE_FAST_1 528
+#define _STORE_FAST_2 529
+#define _STORE_FAST_3 530
+#define _STORE_FAST_4 531
+#define _STORE_FAST_5 532
+#define _STORE_FAST_6 533
+#define _STORE_FAST_7 534
 #define _STORE_FAST_LOAD_FAST STORE_FAST_LOAD_FAST
 #define _STORE_FAST_STORE_FAST STORE_FAST_STORE_FAST
 #define _STORE_GLOBAL STORE_GLOBAL
 #define _STORE_NAME STORE_NAME
-#define _STORE_SLICE 533
-#define _STORE_SUBSCR 534
-#define _STORE_SUBSCR_DICT 535
-#define _STORE_SUBSCR_LIST_INT 536
-#define _SWAP 537
-#define _SWAP_2 538
-#define _SWAP_3 539
-#define _TIER2_RESUME_CHECK 540
-#define _TO_BOOL 541
+#define _STORE_SLICE 535
+#define _STORE_SUBSCR 536
+#define _STORE_SUBSCR_DICT 537
+#define _STORE_SUBSCR_LIST_INT 538
+#define _STORE_SUBSCR_PY_SETITEM 539
+#define _SWAP 540
+#define _SWAP_2 541
+#define _SWAP_3 542
+#define _TIER2_RESUME_CHECK 543
+#define _TO_BOOL 544
 #define _TO_BOOL_BOOL TO_BOOL_BOOL
 #define _TO_BOOL_INT TO_BOOL_INT
-#define _TO_BOOL_LIST 542
+#define _TO_BOOL_LIST 545
 #define _TO_BOOL_NONE TO_BOOL_NONE
-#define _TO_BOOL_STR 543
+#define _TO_BOOL_STR 546
 #define _UNARY_INVERT UNARY_INVERT
 #define _UNARY_NEGATIVE UNARY_NEGATIVE
 #define _UNARY_NOT UNARY_NOT
 #define _UNPACK_EX UNPACK_EX
-#define _UNPACK_SEQUENCE 544
-#define _UNPACK_SEQUENCE_LIST 545
-#define _UNPACK_SEQUENCE_TUPLE 546
-#define _UNPACK_SEQUENCE_TWO_TUPLE 547
+#define _UNPACK_SEQUENCE 547
+#define _UNPACK_SEQUENCE_LIST 548
+#define _UNPACK_SEQUENCE_TUPLE 549
+#define _UNPACK_SEQUENCE_TWO_TUPLE 550
 #define _WITH_EXCEPT_START WITH_EXCEPT_START
 #define _YIELD_VALUE YIELD_VALUE
-#define MAX_UOP_ID 547
+#define MAX_UOP_ID 550
 
 #ifdef __cplusplus
 }
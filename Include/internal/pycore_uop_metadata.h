@@ -125,6 +125,7 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_STORE_SUBSCR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_SUBSCR_LIST_INT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_SUBSCR_DICT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_STORE_SUBSCR_PY_SETITEM] = HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_DELETE_SUBSCR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CALL_INTRINSIC_1] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CALL_INTRINSIC_2] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -290,6 +291,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_EXPAND_METHOD_KW] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_KW_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_CALLARGS_A_TUPLE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_FUNCTION] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_SET_FUNCTION_ATTRIBUTE] = HAS_ARG_FLAG,
@@ -385,6 +388,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CALL_INTRINSIC_1] = "_CALL_INTRINSIC_1",
     [_CALL_INTRINSIC_2] = "_CALL_INTRINSIC_2",
     [_CALL_ISINSTANCE] = "_CALL_ISINSTANCE",
+    [_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS] = "_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS",
+    [_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = "_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS",
     [_CALL_KW_NON_PY] = "_CALL_KW_NON_PY",
     [_CALL_LEN] = "_CALL_LEN",
     [_CALL_LIST_APPEND] = "_CALL_LIST_APPEND",
@@ -645,6 +650,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_STORE_SUBSCR] = "_STORE_SUBSCR",
     [_STORE_SUBSCR_DICT] = "_STORE_SUBSCR_DICT",
     [_STORE_SUBSCR_LIST_INT] = "_STORE_SUBSCR_LIST_INT",
+    [_STORE_SUBSCR_PY_SETITEM] = "_STORE_SUBSCR_PY_SETITEM",
     [_SWAP] = "_SWAP",
     [_SWAP_2] = "_SWAP_2",
     [_SWAP_3] = "_SWAP_3",
@@ -879,6 +885,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 3;
         case _STORE_SUBSCR_DICT:
             return 3;
+        case _STORE_SUBSCR_PY_SETITEM:
+            return 3;
         case _DELETE_SUBSCR:
             return 2;
         case _CALL_INTRINSIC_1:
@@ -1209,6 +1217,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _CALL_KW_NON_PY:
             return 3 + oparg;
+        case _CALL_KW_BUILTIN_FAST_WITH_KEYWORDS:
+            return 3 + oparg;
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS:
+            return 3 + oparg;
         case _MAKE_CALLARGS_A_TUPLE:
             return 0;
         case _MAKE_FUNCTION:
@@ -37,6 +37,18 @@ static inline void PyDTrace_INSTANCE_DELETE_DONE(int arg0) {}
 static inline void PyDTrace_IMPORT_FIND_LOAD_START(const char *arg0) {}
 static inline void PyDTrace_IMPORT_FIND_LOAD_DONE(const char *arg0, int arg1) {}
 static inline void PyDTrace_AUDIT(const char *arg0, void *arg1) {}
+static inline void PyDTrace_GIL_ACQUIRE_START(unsigned long arg0) {}
+static inline void PyDTrace_GIL_ACQUIRE_DONE(unsigned long arg0) {}
+static inline void PyDTrace_GIL_RELEASE(unsigned long arg0) {}
+static inline void PyDTrace_THREAD_ATTACH(unsigned long arg0) {}
+static inline void PyDTrace_THREAD_DETACH(unsigned long arg0) {}
+static inline void PyDTrace_MUTEX_PARK_START(void *arg0) {}
+static inline void PyDTrace_MUTEX_PARK_DONE(void *arg0, int arg1) {}
+static inline void PyDTrace_EXECUTOR_CREATE(void *arg0, const char *arg1, const char *arg2, int arg3, int arg4) {}
+static inline void PyDTrace_EXECUTOR_INVALIDATE(void *arg0) {}
+static inline void PyDTrace_OBMALLOC_ARENA_NEW(void *arg0) {}
+static inline void PyDTrace_OBMALLOC_ARENA_FREE(void *arg0) {}
+static inline void PyDTrace_OBMALLOC_POOL_NEW(unsigned int arg0) {}
 
 static inline int PyDTrace_LINE_ENABLED(void) { return 0; }
 static inline int PyDTrace_FUNCTION_ENTRY_ENABLED(void) { return 0; }
@@ -50,6 +62,18 @@ static inline int PyDTrace_INSTANCE_DELETE_DONE_ENABLED(void) { return 0; }
 static inline int PyDTrace_IMPORT_FIND_LOAD_START_ENABLED(void) { return 0; }
 static inline int PyDTrace_IMPORT_FIND_LOAD_DONE_ENABLED(void) { return 0; }
 static inline int PyDTrace_AUDIT_ENABLED(void) { return 0; }
+static inline int PyDTrace_GIL_ACQUIRE_START_ENABLED(void) { return 0; }
+static inline int PyDTrace_GIL_ACQUIRE_DONE_ENABLED(void) { return 0; }
+static inline int PyDTrace_GIL_RELEASE_ENABLED(void) { return 0; }
+static inline int PyDTrace_THREAD_ATTACH_ENABLED(void) { return 0; }
+static inline int PyDTrace_THREAD_DETACH_ENABLED(void) { return 0; }
+static inline int PyDTrace_MUTEX_PARK_START_ENABLED(void) { return 0; }
+static inline int PyDTrace_MUTEX_PARK_DONE_ENABLED(void) { return 0; }
+static inline int PyDTrace_EXECUTOR_CREATE_ENABLED(void) { return 0; }
+static inline int PyDTrace_EXECUTOR_INVALIDATE_ENABLED(void) { return 0; }
+static inline int PyDTrace_OBMALLOC_ARENA_NEW_ENABLED(void) { return 0; }
+static inline int PyDTrace_OBMALLOC_ARENA_FREE_ENABLED(void) { return 0; }
+static inline int PyDTrace_OBMALLOC_POOL_NEW_ENABLED(void) { return 0; }
 
 #endif /* !WITH_DTRACE */
 
@@ -825,9 +825,13 @@ def call_soon(self, callback, *args, context=None):
         the callback when it is called.
         """
         self._check_closed()
-        if self._debug:
-            self._check_thread()
-            self._check_callback(callback, 'call_soon')
+        if not self._debug:
+            # Fast path: no checks and no source traceback to trim.
+            handle = events.Handle(callback, args, self, context)
+            self._ready.append(handle)
+            return handle
+        self._check_thread()
+        self._check_callback(callback, 'call_soon')
         handle = self._call_soon(callback, args, context)
         if handle._source_traceback:
             del handle._source_traceback[-1]
@@ -2027,11 +2031,12 @@ def _run_once(self):
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
         ntodo = len(self._ready)
-        for i in range(ntodo):
-            handle = self._ready.popleft()
-            if handle._cancelled:
-                continue
-            if self._debug:
+        popleft = self._ready.popleft
+        if self._debug:
+            for i in range(ntodo):
+                handle = popleft()
+                if handle._cancelled:
+                    continue
                 try:
                     self._current_handle = handle
                     t0 = self.time()
@@ -2042,8 +2047,11 @@ def _run_once(self):
                                        _format_handle(handle), dt)
                 finally:
                     self._current_handle = None
-            else:
-                handle._run()
+        else:
+            for i in range(ntodo):
+                handle = popleft()
+                if not handle._cancelled:
+                    handle._run()
         handle = None  # Needed to break cycles when an exception occurs.
 
     def _set_coroutine_origin_tracking(self, enabled):
@@ -50,6 +50,12 @@ def _test_selector_event(selector, fd, event):
         return bool(key.events & event)
 
 
+# Readiness-based I/O costs one selector wakeup plus one recv()/send() per
+# operation.  The transports already keep that down: write() sends
+# immediately when nothing is buffered, buffered data goes out in a single
+# sendmsg() call, and reads use max_size (256 KiB) buffers.  A completion-based
+# loop (for example on Linux io_uring) would need a new extension module and
+# a proactor-style loop; proactor_events.py shows the shape that would take.
 class BaseSelectorEventLoop(base_events.BaseEventLoop):
     """Selector event loop.
 
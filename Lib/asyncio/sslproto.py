@@ -759,6 +759,8 @@ def _do_read__buffered(self):
             if count > 0:
                 offset = count
                 while offset < wants:
+                    if self._nothing_to_read():
+                        break
                     count = self._sslobj.read(wants - offset, buf[offset:])
                     if count > 0:
                         offset += count
@@ -794,6 +796,8 @@ def _do_read__copied(self):
                     data = [first, chunk]
                 else:
                     data.append(chunk)
+                if self._nothing_to_read():
+                    break
         except SSLAgainErrors:
             pass
         if one:
@@ -805,6 +809,13 @@ def _do_read__copied(self):
             self._call_eof_received()
             self._start_shutdown()
 
+    def _nothing_to_read(self):
+        # Read-ahead is off, so OpenSSL does not hold back whole records
+        # once it returned data: if neither the incoming BIO nor the
+        # SSL object has anything left, another read() would only raise
+        # SSLWantReadError, which is comparatively expensive.
+        return not self._incoming.pending and not self._sslobj.pending()
+
     def _call_eof_received(self):
         try:
             if self._app_state == AppProtocolState.STATE_CON_MADE:
@@ -612,6 +612,17 @@ async def readuntil(self, separator=b'\n'):
         if self._exception is not None:
             raise self._exception
 
+        if len(separator) == 1:
+            # Fast path: a single separator and the data it terminates is
+            # already buffered, as when parsing a batch of header lines.
+            isep = self._buffer.find(separator[0])
+            if 0 <= isep <= self._limit:
+                end = isep + min_seplen
+                chunk = bytes(self._buffer[:end])
+                del self._buffer[:end]
+                self._maybe_resume_transport()
+                return chunk
+
         # Consume whole buffer except last bytes, which length is
         # one less than max_seplen. Let's check corner cases with
         # separator[-1]='SEPARATOR':
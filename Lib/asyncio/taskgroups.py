@@ -195,6 +195,12 @@ def create_task(self, coro, **kwargs):
             raise RuntimeError(f"TaskGroup {self!r} is shutting down")
         task = self._loop.create_task(coro, **kwargs)
 
+        # A task that already finished without an error (the coro completed
+        # eagerly) has nothing left for _on_task_done() to do, so skip the
+        # bookkeeping and the callback scheduled through the event loop.
+        if task.done() and (task.cancelled() or task.exception() is None):
+            return task
+
         futures.future_add_to_awaited_by(task, self._parent_task)
 
         # Always schedule the done callback even if the task is
@@ -543,8 +543,23 @@ def _count_elements(mapping, iterable):
     for elem in iterable:
         mapping[elem] = mapping_get(elem, 0) + 1
 
-try:                                    # Load C helper function if available
-    from _collections import _count_elements
+def _count_mapping(mapping, other):
+    'Add the counts from the other mapping.'
+    mapping_get = mapping.get
+    for elem, count in other.items():
+        mapping[elem] = count + mapping_get(elem, 0)
+
+def _most_common(mapping, n):
+    'List the n items with the largest counts, largest first.'
+    # Lazy import to speedup Python startup time
+    global heapq
+    if heapq is None:
+        import heapq
+
+    return heapq.nlargest(n, mapping.items(), key=_itemgetter(1))
+
+try:                                    # Load C helper functions if available
+    from _collections import _count_elements, _count_mapping, _most_common
 except ImportError:
     pass
 
@@ -633,13 +648,7 @@ def most_common(self, n=None):
         # Emulate Bag.sortedByCount from Smalltalk
         if n is None:
             return sorted(self.items(), key=_itemgetter(1), reverse=True)
-
-        # Lazy import to speedup Python startup time
-        global heapq
-        if heapq is None:
-            import heapq
-
-        return heapq.nlargest(n, self.items(), key=_itemgetter(1))
+        return _most_common(self, n)
 
     def elements(self):
         '''Iterator over elements repeating each as many times as its count.
@@ -699,9 +708,7 @@ def update(self, iterable=None, /, **kwds):
         if iterable is not None:
             if isinstance(iterable, _collections_abc.Mapping):
                 if self:
-                    self_get = self.get
-                    for elem, count in iterable.items():
-                        self[elem] = count + self_get(elem, 0)
+                    _count_mapping(self, iterable)
                 else:
                     # fast path when counter is empty
                     super().update(iterable)
@@ -48,7 +48,8 @@ def _walk_dir(dir, maxlevels, quiet=0):
 def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                 rx=None, quiet=0, legacy=False, optimize=-1, workers=1,
                 invalidation_mode=None, *, stripdir=None,
-                prependdir=None, limit_sl_dest=None, hardlink_dupes=False):
+                prependdir=None, limit_sl_dest=None, hardlink_dupes=False,
+                interpreters=False):
     """Byte-compile all modules in the given directory tree.
 
     Arguments (only dir is required):
@@ -72,6 +73,8 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
     limit_sl_dest: ignore symlinks if they are pointing outside of
                    the defined path
     hardlink_dupes: hardlink duplicated pyc files
+    interpreters: if True, run the parallel workers in subinterpreters of
+                  this process instead of in separate processes
     """
     ProcessPoolExecutor = None
     if ddir is not None and (stripdir is not None or prependdir is not None):
@@ -83,7 +86,13 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
         ddir = None
     if workers < 0:
         raise ValueError('workers must be greater or equal to 0')
-    if workers != 1:
+    if workers != 1 and interpreters:
+        try:
+            from concurrent.futures import InterpreterPoolExecutor
+        except ImportError:
+            # Subinterpreters are not available, use processes instead.
+            interpreters = False
+    if workers != 1 and not interpreters:
         # Check if this is a system where ProcessPoolExecutor can function.
         from concurrent.futures.process import _check_system_limits
         try:
@@ -96,16 +105,20 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
         maxlevels = sys.getrecursionlimit()
     files = _walk_dir(dir, quiet=quiet, maxlevels=maxlevels)
     success = True
-    if workers != 1 and ProcessPoolExecutor is not None:
-        import multiprocessing
-        if multiprocessing.get_start_method() == 'fork':
-            mp_context = multiprocessing.get_context('forkserver')
-        else:
-            mp_context = None
-        # If workers == 0, let ProcessPoolExecutor choose
+    if workers != 1 and (interpreters or ProcessPoolExecutor is not None):
+        # If workers == 0, let the executor choose
         workers = workers or None
-        with ProcessPoolExecutor(max_workers=workers,
-                                 mp_context=mp_context) as executor:
+        if interpreters:
+            executor = InterpreterPoolExecutor(max_workers=workers)
+        else:
+            import multiprocessing
+            if multiprocessing.get_start_method() == 'fork':
+                mp_context = multiprocessing.get_context('forkserver')
+            else:
+                mp_context = None
+            executor = ProcessPoolExecutor(max_workers=workers,
+                                           mp_context=mp_context)
+        with executor:
             results = executor.map(partial(compile_file,
                                            ddir=ddir, force=force,
                                            rx=rx, quiet=quiet,
@@ -367,6 +380,10 @@ def main():
                               'to the equivalent of -l sys.path'))
     parser.add_argument('-j', '--workers', default=1,
                         type=int, help='Run compileall concurrently')
+    parser.add_argument('--interpreters', action='store_true',
+                        help=('run the -j workers in subinterpreters of a '
+                              'single process instead of in separate '
+                              'processes'))
     invalidation_modes = [mode.name.lower().replace('_', '-')
                           for mode in py_compile.PycInvalidationMode]
     parser.add_argument('--invalidation-mode',
@@ -453,7 +470,8 @@ def main():
                                        prependdir=args.prependdir,
                                        optimize=args.opt_levels,
                                        limit_sl_dest=args.limit_sl_dest,
-                                       hardlink_dupes=args.hardlink_dupes):
+                                       hardlink_dupes=args.hardlink_dupes,
+                                       interpreters=args.interpreters):
                         success = False
             return success
         else:
@@ -1,7 +1,6 @@
 """Cross-interpreter Queues High Level Module."""
 
 import queue
-import time
 import weakref
 import _interpqueues as _queues
 from . import _crossinterp
@@ -172,7 +171,6 @@ def qsize(self):
 
     def put(self, obj, timeout=None, *,
             unbounditems=None,
-            _delay=10 / 1000,  # 10 milliseconds
             ):
         """Add the object to the queue.
 
@@ -217,16 +215,7 @@ def put(self, obj, timeout=None, *,
             timeout = int(timeout)
             if timeout < 0:
                 raise ValueError(f'timeout value must be non-negative')
-            end = time.time() + timeout
-        while True:
-            try:
-                _queues.put(self._id, obj, unboundop)
-            except QueueFull as exc:
-                if timeout is not None and time.time() >= end:
-                    raise  # re-raise
-                time.sleep(_delay)
-            else:
-                break
+        _queues.put(self._id, obj, unboundop, blocking=True, timeout=timeout)
 
     def put_nowait(self, obj, *, unbounditems=None):
         if unbounditems is None:
@@ -235,9 +224,7 @@ def put_nowait(self, obj, *, unbounditems=None):
             unboundop, = _serialize_unbound(unbounditems)
         _queues.put(self._id, obj, unboundop)
 
-    def get(self, timeout=None, *,
-            _delay=10 / 1000,  # 10 milliseconds
-            ):
+    def get(self, timeout=None):
         """Return the next object from the queue.
 
         This blocks while the queue is empty.
@@ -250,16 +237,7 @@ def get(self, timeout=None, *,
             timeout = int(timeout)
             if timeout < 0:
                 raise ValueError(f'timeout value must be non-negative')
-            end = time.time() + timeout
-        while True:
-            try:
-                obj, unboundop = _queues.get(self._id)
-            except QueueEmpty as exc:
-                if timeout is not None and time.time() >= end:
-                    raise  # re-raise
-                time.sleep(_delay)
-            else:
-                break
+        obj, unboundop = _queues.get(self._id, blocking=True, timeout=timeout)
         if unboundop is not None:
             assert obj is None, repr(obj)
             return _resolve_unbound(unboundop)
@@ -2,6 +2,7 @@
 import sys
 import copy
 import types
+import functools
 import inspect
 import keyword
 import itertools
@@ -433,6 +434,13 @@ def _tuple_str(obj_name, fields):
     return f'({",".join([f"{obj_name}.{f.name}" for f in fields])},)'
 
 
+# Classes with the same fields and options generate identical source for
+# their methods, so compile each distinct source only once.
+@functools.lru_cache(maxsize=256)
+def _compile_fns(txt):
+    return compile(txt, '<string>', 'exec')
+
+
 class _FuncBuilder:
     def __init__(self, globals):
         self.names = []
@@ -503,8 +511,16 @@ def add_fns_to_class(self, cls):
 
         txt = f"def __create_fn__({local_vars}):\n{fns_src}\n return {return_names}"
         ns = {}
-        exec(txt, self.globals, ns)
-        fns = ns['__create_fn__'](**self.locals)
+        exec(_compile_fns(txt), self.globals, ns)
+        create_fn = ns['__create_fn__']
+        # Give each class its own copies of the method code objects, so
+        # that classes sharing generated source do not share (and fight
+        # over) specialization state.
+        code = create_fn.__code__
+        create_fn.__code__ = code.replace(co_consts=tuple(
+            c.replace() if isinstance(c, types.CodeType) else c
+            for c in code.co_consts))
+        fns = create_fn(**self.locals)
 
         # Now that we've generated the functions, assign them into cls.
         for name, fn in zip(self.names, fns):
@@ -704,6 +704,13 @@ def __call__(cls, value, names=_not_given, *values, module=None, qualname=None,
             # simple value lookup if members exist
             if names is not _not_given:
                 value = (value, names) + values
+            else:
+                # fast path for hashable values of existing members; anything
+                # else goes through the full search in Enum.__new__
+                try:
+                    return cls._value2member_map_[value]
+                except (KeyError, TypeError):
+                    pass
             return cls.__new__(cls, value)
         # otherwise, functional API: we're creating a new Enum type
         if names is _not_given and type is None:
@@ -1584,10 +1591,10 @@ def __or__(self, other):
         if other_value is NotImplemented:
             return NotImplemented
 
-        for flag in self, other:
-            if self._get_value(flag) is None:
-                raise TypeError(f"'{flag}' cannot be combined with other flags with |")
         value = self._value_
+        for flag, flag_value in (self, value), (other, other_value):
+            if flag_value is None:
+                raise TypeError(f"'{flag}' cannot be combined with other flags with |")
         return self.__class__(value | other_value)
 
     def __and__(self, other):
@@ -1595,10 +1602,10 @@ def __and__(self, other):
         if other_value is NotImplemented:
             return NotImplemented
 
-        for flag in self, other:
-            if self._get_value(flag) is None:
-                raise TypeError(f"'{flag}' cannot be combined with other flags with &")
         value = self._value_
+        for flag, flag_value in (self, value), (other, other_value):
+            if flag_value is None:
+                raise TypeError(f"'{flag}' cannot be combined with other flags with &")
         return self.__class__(value & other_value)
 
     def __xor__(self, other):
@@ -1606,10 +1613,10 @@ def __xor__(self, other):
         if other_value is NotImplemented:
             return NotImplemented
 
-        for flag in self, other:
-            if self._get_value(flag) is None:
-                raise TypeError(f"'{flag}' cannot be combined with other flags with ^")
         value = self._value_
+        for flag, flag_value in (self, value), (other, other_value):
+            if flag_value is None:
+                raise TypeError(f"'{flag}' cannot be combined with other flags with ^")
         return self.__class__(value ^ other_value)
 
     def __invert__(self):
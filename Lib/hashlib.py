@@ -204,7 +204,9 @@ def file_digest(fileobj, digest, /, *, _bufsize=2**18):
     constructor, or a callable that returns a hash object.
     """
     # On Linux we could use AF_ALG sockets and sendfile() to archive zero-copy
-    # hashing with hardware acceleration.
+    # hashing with hardware acceleration.  Hashing an mmap() of the file
+    # would save the copy out of the page cache (5-10% for large files), but
+    # the process gets SIGBUS if the file is truncated while it is hashed.
     if isinstance(digest, str):
         digestobj = new(digest)
     else:
@@ -97,13 +97,13 @@
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads',
+    'dump', 'dumps', 'load', 'loads', 'iterload',
     'JSONDecoder', 'JSONDecodeError', 'JSONEncoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder, JSONDecodeError
+from .decoder import JSONDecoder, JSONDecodeError, WHITESPACE
 from .encoder import JSONEncoder
 import codecs
 
@@ -340,10 +340,134 @@ def loads(s, *, cls=None, object_hook=None, parse_float=None,
                             f'not {s.__class__.__name__}')
         s = s.decode(detect_encoding(s), 'surrogatepass')
 
+    return _get_decoder(cls, object_hook, parse_float, parse_int,
+                        parse_constant, object_pairs_hook, kw).decode(s)
+
+
+def iterload(fp, *, cls=None, object_hook=None, parse_float=None,
+        parse_int=None, parse_constant=None, object_pairs_hook=None,
+        chunk_size=65536, **kw):
+    """Incrementally deserialize ``fp`` (a ``.read()``-supporting file-like
+    object containing a JSON array) and yield the elements of the array one
+    at a time.
+
+    ``fp`` is read ``chunk_size`` characters or bytes at a time, so only
+    the element being decoded and one chunk are held in memory rather than
+    the whole document.  Invalid data after the elements already yielded
+    raises ``JSONDecodeError`` only once it is reached.
+
+    The other arguments have the same meaning as in ``load()``.
+    """
+    if chunk_size < 1:
+        raise ValueError('chunk_size must be positive')
+    decoder = _get_decoder(cls, object_hook, parse_float, parse_int,
+                           parse_constant, object_pairs_hook, kw)
+    read = fp.read
+    data = read(chunk_size)
+    if isinstance(data, str):
+        if data.startswith('\ufeff'):
+            raise JSONDecodeError("Unexpected UTF-8 BOM (decode using utf-8-sig)",
+                                  data, 0)
+    else:
+        if not isinstance(data, (bytes, bytearray)):
+            raise TypeError(f'the JSON object must be str, bytes or bytearray, '
+                            f'not {data.__class__.__name__}')
+        # detect_encoding() needs the first four bytes.
+        while 0 < len(data) < 4:
+            more = read(chunk_size)
+            if not more:
+                break
+            data += more
+        incremental = codecs.getincrementaldecoder(detect_encoding(data))
+        decode = incremental('surrogatepass').decode
+        raw_read = read
+        def read(size):
+            while b := raw_read(size):
+                if text := decode(b):
+                    return text
+            return decode(b'', True)
+        data = decode(data, not data)
+    return _iterload(decoder.scan_once, read, data, chunk_size)
+
+
+def _iterload(scan_once, read, buf, chunk_size, _w=WHITESPACE.match):
+    pos = 0
+
+    def fill(size=chunk_size):
+        # Append at least one more chunk, dropping the consumed text.
+        nonlocal buf, pos
+        data = read(max(size, chunk_size))
+        if not data:
+            return False
+        buf = buf[pos:] + data
+        pos = 0
+        return True
+
+    def near_end(i):
+        # Long enough for any literal ('-Infinity') or escape ('\\uXXXX').
+        return len(buf) - i < 10
+
+    def skip_whitespace():
+        nonlocal pos
+        pos = _w(buf, pos).end()
+        while pos == len(buf) and fill():
+            pos = _w(buf, pos).end()
+
+    skip_whitespace()
+    if not buf.startswith('[', pos):
+        raise JSONDecodeError("Expecting '['", buf, pos)
+    pos += 1
+    skip_whitespace()
+    if buf.startswith(']', pos):
+        pos += 1
+    else:
+        while True:
+            # The chunk boundary may cut an element short, so when decoding
+            # stops close to the end of the buffer, read more and retry.
+            # Reading at least as much as is buffered keeps the number of
+            # rescans of a large element logarithmic.  A number may also
+            # continue in the next chunk ('1' '.5', '1e' '+5').
+            while True:
+                try:
+                    obj, end = scan_once(buf, pos)
+                except StopIteration as err:
+                    if near_end(err.value) and fill(len(buf) - pos):
+                        continue
+                    raise JSONDecodeError("Expecting value", buf,
+                                          err.value) from None
+                except JSONDecodeError as err:
+                    if ((near_end(err.pos) or
+                         err.msg.startswith('Unterminated string')) and
+                            fill(len(buf) - pos)):
+                        continue
+                    raise
+                if ('0' <= buf[end - 1] <= '9' and near_end(end) and
+                        fill(len(buf) - pos)):
+                    continue
+                break
+            pos = end
+            yield obj
+            del obj
+            skip_whitespace()
+            if buf.startswith(',', pos):
+                pos += 1
+                skip_whitespace()
+            elif buf.startswith(']', pos):
+                pos += 1
+                break
+            else:
+                raise JSONDecodeError("Expecting ',' delimiter", buf, pos)
+    skip_whitespace()
+    if pos != len(buf):
+        raise JSONDecodeError("Extra data", buf, pos)
+
+
+def _get_decoder(cls, object_hook, parse_float, parse_int, parse_constant,
+                 object_pairs_hook, kw):
     if (cls is None and object_hook is None and
             parse_int is None and parse_float is None and
             parse_constant is None and object_pairs_hook is None and not kw):
-        return _default_decoder.decode(s)
+        return _default_decoder
     if cls is None:
         cls = JSONDecoder
     if object_hook is not None:
@@ -356,4 +480,4 @@ def loads(s, *, cls=None, object_hook=None, parse_float=None,
         kw['parse_int'] = parse_int
     if parse_constant is not None:
         kw['parse_constant'] = parse_constant
-    return cls(**kw).decode(s)
+    return cls(**kw)
@@ -24,6 +24,7 @@
 """
 
 import sys, os, time, io, re, traceback, warnings, weakref, collections.abc
+import functools
 
 from types import GenericAlias
 from string import Template
@@ -283,6 +284,14 @@ def _after_at_fork_child_reinit_locks():
 #   The logging record
 #---------------------------------------------------------------------------
 
+# Records are mostly created for a small set of source files, so remember how
+# their paths split into the filename and module attributes.
+@functools.lru_cache(maxsize=256)
+def _split_pathname(pathname):
+    filename = os.path.basename(pathname)
+    return filename, os.path.splitext(filename)[0]
+
+
 class LogRecord(object):
     """
     A LogRecord instance represents an event being logged.
@@ -329,8 +338,7 @@ def __init__(self, name, level, pathname, lineno,
         self.levelno = level
         self.pathname = pathname
         try:
-            self.filename = os.path.basename(pathname)
-            self.module = os.path.splitext(self.filename)[0]
+            self.filename, self.module = _split_pathname(pathname)
         except (TypeError, ValueError, AttributeError):
             self.filename = pathname
             self.module = "Unknown module"
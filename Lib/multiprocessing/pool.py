@@ -181,12 +181,19 @@ def Process(ctx, *args, **kwds):
         return ctx.Process(*args, **kwds)
 
     def __init__(self, processes=None, initializer=None, initargs=(),
-                 maxtasksperchild=None, context=None):
+                 maxtasksperchild=None, context=None, *,
+                 shared_memory_threshold=None):
         # Attributes initialized early to make sure that they exist in
         # __del__() if __init__() raises an exception
         self._pool = []
         self._state = INIT
 
+        if shared_memory_threshold is not None:
+            if (not isinstance(shared_memory_threshold, int)
+                    or shared_memory_threshold <= 0):
+                raise ValueError(
+                    "shared_memory_threshold must be a positive int or None")
+        self._shared_memory_threshold = shared_memory_threshold
         self._ctx = context or get_context()
         self._setup_queues()
         self._taskqueue = queue.SimpleQueue()
@@ -343,10 +350,29 @@ def _maintain_pool(ctx, Process, processes, pool, inqueue, outqueue,
                                          wrap_exception)
 
     def _setup_queues(self):
-        self._inqueue = self._ctx.SimpleQueue()
-        self._outqueue = self._ctx.SimpleQueue()
-        self._quick_put = self._inqueue._writer.send
-        self._quick_get = self._outqueue._reader.recv
+        if self._shared_memory_threshold is None:
+            self._inqueue = self._ctx.SimpleQueue()
+            self._outqueue = self._ctx.SimpleQueue()
+            self._quick_put = self._inqueue._writer.send
+            self._quick_get = self._outqueue._reader.recv
+            return
+
+        from .queues import _SharedMemorySimpleQueue
+        if os.name == 'posix':
+            # The workers must share the resource tracker of the pool: the
+            # shared memory blocks they create are unlinked by the pool.
+            from .resource_tracker import ensure_running
+            ensure_running()
+        ctx = self._ctx.get_context()
+        threshold = self._shared_memory_threshold
+        inqueue = _SharedMemorySimpleQueue(ctx=ctx, threshold=threshold)
+        outqueue = _SharedMemorySimpleQueue(ctx=ctx, threshold=threshold)
+        self._inqueue = inqueue
+        self._outqueue = outqueue
+        self._quick_put = lambda obj: inqueue._writer.send_bytes(
+            inqueue._dumps(obj))
+        self._quick_get = lambda: outqueue._loads(
+            outqueue._reader.recv_bytes())
 
     def _check_running(self):
         if self._state != RUN:
@@ -674,7 +700,8 @@ def _help_stuff_finish(inqueue, task_handler, size):
         util.debug('removing tasks from inqueue until task handler finished')
         inqueue._rlock.acquire()
         while task_handler.is_alive() and inqueue._reader.poll():
-            inqueue._reader.recv()
+            # unserialize the tasks to release their shared memory
+            inqueue._loads(inqueue._reader.recv_bytes())
             time.sleep(0)
 
     @classmethod
@@ -7,7 +7,7 @@
 # Licensed to PSF under a Contributor Agreement.
 #
 
-__all__ = ['Queue', 'SimpleQueue', 'JoinableQueue']
+__all__ = ['Queue', 'SimpleQueue', 'JoinableQueue', 'SharedMemoryQueue']
 
 import sys
 import os
@@ -26,6 +26,12 @@
 
 from .util import debug, info, Finalize, register_after_fork, is_exiting
 
+try:
+    import _multiprocessing
+except ImportError:
+    # SharedMemoryQueue is not available
+    _multiprocessing = None
+
 #
 # Queue type using a pipe, buffer and thread
 #
@@ -384,11 +390,11 @@ def get(self):
         with self._rlock:
             res = self._reader.recv_bytes()
         # unserialize the data after having released the lock
-        return _ForkingPickler.loads(res)
+        return self._loads(res)
 
     def put(self, obj):
         # serialize the data before acquiring the lock
-        obj = _ForkingPickler.dumps(obj)
+        obj = self._dumps(obj)
         if self._wlock is None:
             # writes to a message oriented win32 pipe are atomic
             self._writer.send_bytes(obj)
@@ -396,4 +402,141 @@ def put(self, obj):
             with self._wlock:
                 self._writer.send_bytes(obj)
 
+    def _dumps(self, obj):
+        return _ForkingPickler.dumps(obj)
+
+    def _loads(self, data):
+        return _ForkingPickler.loads(data)
+
+    __class_getitem__ = classmethod(types.GenericAlias)
+
+
+class _SharedMemorySimpleQueue(SimpleQueue):
+    '''
+    SimpleQueue which hands the out-of-band buffers of at least `threshold`
+    bytes over in shared memory instead of writing them to the pipe
+    '''
+
+    def __init__(self, *, ctx, threshold):
+        SimpleQueue.__init__(self, ctx=ctx)
+        self._threshold = threshold
+
+    def __getstate__(self):
+        return SimpleQueue.__getstate__(self) + (self._threshold,)
+
+    def __setstate__(self, state):
+        SimpleQueue.__setstate__(self, state[:-1])
+        self._threshold = state[-1]
+
+    def _dumps(self, obj):
+        from .shared_memory import _dumps
+        return _dumps(obj, self._threshold)
+
+    def _loads(self, data):
+        from .shared_memory import _loads
+        return _loads(data)
+
+
+#
+# Queue type using a ring buffer in shared memory
+#
+# _multiprocessing.ring_put() and ring_get() move the messages without a
+# lock between producers and consumers.  The semaphores are only used to
+# sleep when the buffer is full or empty.
+#
+
+class SharedMemoryQueue(object):
+
+    def __init__(self, buffer_size=1 << 20, *, ctx):
+        from .shared_memory import SharedMemory
+        if buffer_size < 8:
+            raise ValueError("buffer_size must be at least 8")
+        self._rlock = ctx.Lock()
+        self._wlock = ctx.Lock()
+        self._readable = ctx.Semaphore(0)
+        self._writable = ctx.Semaphore(0)
+        shm = SharedMemory(create=True,
+                           size=_multiprocessing.RING_HEADER_SIZE + buffer_size)
+        if sys.platform != 'win32' and ctx.get_start_method() == 'fork':
+            # Forked children inherit the mapping
+            shm.unlink()
+        else:
+            Finalize(self, shm.unlink, exitpriority=0)
+        self._shm = shm
+        self._buf = shm.buf
+
+    def __getstate__(self):
+        context.assert_spawning(self)
+        return (self._rlock, self._wlock, self._readable, self._writable,
+                self._shm.name)
+
+    def __setstate__(self, state):
+        from .shared_memory import SharedMemory
+        (self._rlock, self._wlock, self._readable, self._writable,
+         name) = state
+        self._shm = SharedMemory(name, track=False)
+        self._buf = self._shm.buf
+
+    def put(self, obj, block=True, timeout=None):
+        # serialize the data before acquiring the lock
+        self.put_bytes(_ForkingPickler.dumps(obj), block, timeout)
+
+    def get(self, block=True, timeout=None):
+        # unserialize the data after having released the lock
+        return _ForkingPickler.loads(self.get_bytes(block, timeout))
+
+    def put_bytes(self, buf, block=True, timeout=None):
+        if self._shm is None:
+            raise ValueError(f"Queue {self!r} is closed")
+        if block and timeout is not None:
+            deadline = time.monotonic() + timeout
+        if not self._wlock.acquire(block, timeout):
+            raise Full
+        try:
+            while (wake := _multiprocessing.ring_put(self._buf, buf,
+                                                     block)) is None:
+                if block and timeout is not None:
+                    timeout = deadline - time.monotonic()
+                if not block or not self._writable.acquire(True, timeout):
+                    raise Full
+        finally:
+            self._wlock.release()
+        if wake:
+            self._readable.release()
+
+    def get_bytes(self, block=True, timeout=None):
+        if self._shm is None:
+            raise ValueError(f"Queue {self!r} is closed")
+        if block and timeout is not None:
+            deadline = time.monotonic() + timeout
+        if not self._rlock.acquire(block, timeout):
+            raise Empty
+        try:
+            while (res := _multiprocessing.ring_get(self._buf,
+                                                    block)) is None:
+                if block and timeout is not None:
+                    timeout = deadline - time.monotonic()
+                if not block or not self._readable.acquire(True, timeout):
+                    raise Empty
+        finally:
+            self._rlock.release()
+        data, wake = res
+        if wake:
+            self._writable.release()
+        return data
+
+    def empty(self):
+        return _multiprocessing.ring_empty(self._buf)
+
+    def get_nowait(self):
+        return self.get(False)
+
+    def put_nowait(self, obj):
+        return self.put(obj, False)
+
+    def close(self):
+        if self._shm is not None:
+            self._shm.close()
+            self._shm = self._buf = None
+
     __class_getitem__ = classmethod(types.GenericAlias)
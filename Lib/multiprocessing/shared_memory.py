@@ -9,6 +9,7 @@
 
 
 from functools import partial
+import io
 import mmap
 import os
 import errno
@@ -23,7 +24,7 @@
     import _posixshmem
     _USE_POSIX = True
 
-from . import resource_tracker
+from . import reduction, resource_tracker
 
 _O_CREX = os.O_CREAT | os.O_EXCL
 
@@ -254,6 +255,95 @@ def unlink(self):
                 resource_tracker.unregister(self._name, "shared_memory")
 
 
+class _SharedBuffers(tuple):
+    "Pickle whose out-of-band buffers are in shared memory blocks."
+    __slots__ = ()
+
+
+def _attach_and_unlink(name, size):
+    "Map a shared memory block handed over by _dumps() and unlink it."
+    try:
+        fd = _posixshmem.shm_open(name, os.O_RDWR, mode=SharedMemory._mode)
+        try:
+            return mmap.mmap(fd, size)
+        finally:
+            os.close(fd)
+    finally:
+        _posixshmem.shm_unlink(name)
+        resource_tracker.unregister(name, "shared_memory")
+
+
+def _dumps(obj, threshold):
+    """Pickle obj, copying each out-of-band buffer of at least threshold
+    bytes into a new shared memory block.
+
+    The blocks are handed over to the process which unpickles the result
+    with _loads(): it maps and unlinks them, so large buffers are written
+    to memory once instead of being copied through a pipe.  Objects
+    supporting pickle protocol 5 out-of-band buffers (like array.array or
+    pickle.PickleBuffer) benefit from it.
+    """
+    segments = []
+
+    def buffer_callback(buffer):
+        if not _USE_POSIX:
+            # A Windows block is destroyed when its creator closes it,
+            # before the receiver can attach to it.
+            return True
+        try:
+            m = buffer.raw()
+        except BufferError:
+            # not contiguous
+            return True
+        if m.nbytes < threshold:
+            return True
+        shm = SharedMemory(create=True, size=m.nbytes)
+        try:
+            shm.buf[:m.nbytes] = m
+        except BaseException:
+            shm.close()
+            shm.unlink()
+            raise
+        shm.close()
+        segments.append((shm._name, m.nbytes))
+        return False
+
+    buf = io.BytesIO()
+    try:
+        reduction.ForkingPickler(buf, 5, buffer_callback=buffer_callback).dump(obj)
+        if not segments:
+            return buf.getbuffer()
+        return reduction.ForkingPickler.dumps(
+            _SharedBuffers((segments, buf.getvalue())))
+    except BaseException:
+        for name, size in segments:
+            _posixshmem.shm_unlink(name)
+            resource_tracker.unregister(name, "shared_memory")
+        raise
+
+
+def _loads(data):
+    "Unpickle data produced by _dumps()."
+    obj = reduction.ForkingPickler.loads(data)
+    if type(obj) is not _SharedBuffers:
+        return obj
+    segments, data = obj
+    buffers = []
+    try:
+        for name, size in segments:
+            buffers.append(_attach_and_unlink(name, size))
+    except BaseException:
+        # release the blocks which were not attached
+        for name, size in segments[len(buffers) + 1:]:
+            try:
+                _posixshmem.shm_unlink(name)
+            except OSError:
+                pass
+            resource_tracker.unregister(name, "shared_memory")
+        raise
+    return reduction.ForkingPickler.loads(data, buffers=buffers)
+
+
 _encoding = "utf8"
 
 class ShareableList:
@@ -0,0 +1,4 @@
+# When invoked as main program, invoke the profiler on a script
+from profile import main
+
+main()
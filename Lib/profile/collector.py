@@ -0,0 +1,20 @@
+from abc import ABC, abstractmethod
+
+
+class Collector(ABC):
+    """Base class for the consumers of the samples taken by
+    profile.sample.SampleProfiler."""
+
+    @abstractmethod
+    def collect(self, stack_frames):
+        """Add one sample.
+
+        *stack_frames* is the result of
+        _remote_debugging.RemoteUnwinder.get_stack_trace(): a list of
+        (thread_id, frames) pairs where frames is a list of
+        (filename, lineno, funcname) tuples, most recent call first.
+        """
+
+    @abstractmethod
+    def export(self, filename):
+        """Write the collected data to *filename*."""
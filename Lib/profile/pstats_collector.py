@@ -0,0 +1,54 @@
+import collections
+import marshal
+
+from .collector import Collector
+
+
+class PstatsCollector(Collector):
+    """Aggregate samples into pstats-compatible statistics.
+
+    A function that is running when a sample is taken gets the sample
+    interval added to its own time; every function on the stack gets it
+    added to its cumulative time.  The call counts are the number of
+    samples that saw the function on the stack.
+    """
+
+    def __init__(self, sample_interval_usec):
+        self.sample_interval_usec = sample_interval_usec
+        self.direct_samples = collections.Counter()
+        self.cumulative_samples = collections.Counter()
+        self.callers = collections.defaultdict(collections.Counter)
+        self.stats = {}
+
+    def collect(self, stack_frames):
+        for thread_id, frames in stack_frames:
+            if not frames:
+                continue
+            locations = [tuple(frame) for frame in frames]
+            self.direct_samples[locations[0]] += 1
+            # A recursive function is counted once per sample.
+            self.cumulative_samples.update(set(locations))
+            for callee, caller in zip(locations, locations[1:]):
+                self.callers[callee][caller] += 1
+
+    def export(self, filename):
+        self.create_stats()
+        with open(filename, "wb") as f:
+            marshal.dump(self.stats, f)
+
+    # Called by pstats.Stats() when it is given a collector.
+    def create_stats(self):
+        interval = self.sample_interval_usec / 1_000_000
+        self.stats = {}
+        for location, samples in self.cumulative_samples.items():
+            callers = {
+                caller: (count, count, 0.0, count * interval)
+                for caller, count in self.callers[location].items()
+            }
+            self.stats[location] = (
+                samples,
+                samples,
+                self.direct_samples[location] * interval,
+                samples * interval,
+                callers,
+            )
@@ -0,0 +1,215 @@
+"""Statistical profiler for running Python processes.
+
+Samples the Python stacks of another process at a fixed rate by reading
+its memory with _remote_debugging.RemoteUnwinder.  The profiled process
+does not run any profiling code, so it can be profiled in production:
+
+    python -m profile.sample 1234
+    python -m profile.sample -i 100 -d 60 --collapsed 1234
+"""
+
+import argparse
+import pstats
+import time
+
+import _remote_debugging
+
+from .pstats_collector import PstatsCollector
+from .stack_collector import CollapsedStackCollector
+
+__all__ = ["SampleProfiler", "sample"]
+
+
+class SampleProfiler:
+    """Take samples of the stacks of the process *pid*."""
+
+    def __init__(self, pid, sample_interval_usec, all_threads):
+        self.pid = pid
+        self.sample_interval_usec = sample_interval_usec
+        self.all_threads = all_threads
+        self.unwinder = _remote_debugging.RemoteUnwinder(
+            self.pid, all_threads=self.all_threads
+        )
+
+    def sample(self, collector, duration_sec=10):
+        """Feed samples to *collector* for *duration_sec* seconds, or
+        until the process exits.  Return the number of samples taken."""
+        sample_interval_sec = self.sample_interval_usec / 1_000_000
+        num_samples = 0
+        errors = 0
+        start_time = next_time = time.perf_counter()
+        end_time = start_time + duration_sec
+        while True:
+            current_time = time.perf_counter()
+            if current_time >= end_time:
+                break
+            if current_time < next_time:
+                time.sleep(min(next_time, end_time) - current_time)
+                continue
+            try:
+                stack_frames = self.unwinder.get_stack_trace()
+                collector.collect(stack_frames)
+            except (RuntimeError, UnicodeDecodeError, MemoryError,
+                    OSError) as exc:
+                if _process_exited(exc):
+                    break
+                # The process changed its state while we were reading it.
+                errors += 1
+            num_samples += 1
+            # Do not try to catch up with the samples missed while the
+            # sampler was descheduled: that would skew the profile.
+            next_time = max(next_time + sample_interval_sec, current_time)
+
+        running_time = time.perf_counter() - start_time
+        print(f"Captured {num_samples} samples in {running_time:.2f} seconds")
+        if running_time:
+            print(f"Sample rate: {num_samples / running_time:.2f} samples/sec")
+        if num_samples:
+            print(f"Error rate: {errors / num_samples * 100:.2f}%")
+        return num_samples
+
+
+def _process_exited(exc):
+    # The unwinder wraps the ProcessLookupError of its failed read.
+    while exc is not None:
+        if isinstance(exc, ProcessLookupError):
+            return True
+        exc = exc.__cause__ or exc.__context__
+    return False
+
+
+def sample(
+    pid,
+    *,
+    sort="cumulative",
+    sample_interval_usec=1000,
+    duration_sec=10,
+    filename=None,
+    all_threads=False,
+    limit=None,
+    output_format="pstats",
+):
+    """Profile the process *pid* and print or write the results.
+
+    *output_format* is "pstats" for a pstats-style report, printed unless
+    *filename* is given, or "collapsed" for the folded stacks used by
+    flame graph tools.  *sort* and *limit* are passed to the sort_stats()
+    and print_stats() methods of the pstats.Stats report.
+    """
+    profiler = SampleProfiler(pid, sample_interval_usec, all_threads)
+
+    match output_format:
+        case "pstats":
+            collector = PstatsCollector(sample_interval_usec)
+        case "collapsed":
+            collector = CollapsedStackCollector()
+            filename = filename or f"collapsed.{pid}.txt"
+        case _:
+            raise ValueError(f"Invalid output format: {output_format}")
+
+    profiler.sample(collector, duration_sec)
+
+    if output_format == "pstats" and not filename:
+        stats = pstats.Stats(collector).strip_dirs().sort_stats(sort)
+        if limit is None:
+            stats.print_stats()
+        else:
+            stats.print_stats(limit)
+    else:
+        collector.export(filename)
+        print(f"Profile written to {filename}")
+
+
+_SORT_KEYS = {
+    "nsamples": "calls",
+    "tottime": "tottime",
+    "cumtime": "cumulative",
+    "name": "name",
+    "filename": "filename",
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=(
+            "Sample the Python stacks of a running process and report "
+            "where it spends its time."
+        ),
+        color=True,
+    )
+    parser.add_argument("pid", type=int, help="Process ID to sample")
+    parser.add_argument(
+        "-i",
+        "--interval",
+        type=int,
+        default=1000,
+        help="Sampling interval in microseconds (default: 1000)",
+    )
+    parser.add_argument(
+        "-d",
+        "--duration",
+        type=float,
+        default=10,
+        help="Sampling duration in seconds (default: 10)",
+    )
+    parser.add_argument(
+        "-a",
+        "--all-threads",
+        action="store_true",
+        help="Sample all threads, not just the main thread",
+    )
+    output_format = parser.add_mutually_exclusive_group()
+    output_format.add_argument(
+        "--pstats",
+        action="store_const",
+        const="pstats",
+        dest="format",
+        default="pstats",
+        help="Print a pstats-style report, or write pstats data with -o "
+             "(default)",
+    )
+    output_format.add_argument(
+        "--collapsed",
+        action="store_const",
+        const="collapsed",
+        dest="format",
+        help="Write collapsed stacks for flame graph tools",
+    )
+    parser.add_argument(
+        "-o",
+        "--outfile",
+        help="Output file (default: print the report; collapsed.<pid>.txt "
+             "for --collapsed)",
+    )
+    parser.add_argument(
+        "--sort",
+        choices=list(_SORT_KEYS),
+        default="cumtime",
+        help="Sort key of the report (default: cumtime)",
+    )
+    parser.add_argument(
+        "-l",
+        "--limit",
+        type=int,
+        default=15,
+        help="Number of functions in the report (default: 15)",
+    )
+
+    args = parser.parse_args()
+    if args.format == "collapsed" and args.sort != "cumtime":
+        parser.error("--sort only applies to the pstats report")
+
+    sample(
+        args.pid,
+        sample_interval_usec=args.interval,
+        duration_sec=args.duration,
+        filename=args.outfile,
+        all_threads=args.all_threads,
+        limit=args.limit,
+        sort=_SORT_KEYS[args.sort],
+        output_format=args.format,
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,35 @@
+import collections
+
+from .collector import Collector
+
+
+class StackTraceCollector(Collector):
+    """Call process_frames() with the frames of each thread, oldest first."""
+
+    def collect(self, stack_frames):
+        for thread_id, frames in stack_frames:
+            if frames:
+                self.process_frames(frames[::-1])
+
+    def process_frames(self, frames):
+        pass
+
+
+class CollapsedStackCollector(StackTraceCollector):
+    """Count identical stacks, for the "collapsed" (folded) format read by
+    flame graph tools: one "frame;frame;frame count" line per stack."""
+
+    def __init__(self):
+        self.stack_counter = collections.Counter()
+
+    def process_frames(self, frames):
+        self.stack_counter[tuple(tuple(frame) for frame in frames)] += 1
+
+    def export(self, filename):
+        with open(filename, "w", encoding="utf-8") as f:
+            for stack, count in self.stack_counter.items():
+                stack_str = ";".join(
+                    f"{file}:{funcname}:{lineno}"
+                    for file, lineno, funcname in stack
+                )
+                f.write(f"{stack_str} {count}\n")
@@ -522,6 +522,29 @@ def _get_charset_prefix(pattern, flags):
         return charset
     return None
 
+def _get_required_literal(pattern, flags):
+    # look for the longest run of literals that every match contains,
+    # and the minimal number of characters matched before it
+    literal = []
+    offset = 0
+    run = []
+    run_offset = pos = 0
+    iscased = _get_iscased(flags)
+    for i, (op, av) in enumerate(pattern.data):
+        if op is LITERAL and not (iscased and iscased(av)):
+            if not run:
+                run_offset = pos
+            run.append(av)
+            pos += 1
+            continue
+        if len(run) > len(literal):
+            literal, offset = run, run_offset
+        run = []
+        pos += pattern[i:i+1].getwidth()[0]
+    if len(run) > len(literal):
+        literal, offset = run, run_offset
+    return literal, min(offset, MAXCODE)
+
 def _compile_info(code, pattern, flags):
     # internal: compile an info block.  in the current version,
     # this contains min/max pattern width, and an optional literal
@@ -536,9 +559,27 @@ def _compile_info(code, pattern, flags):
     prefix = []
     prefix_skip = 0
     charset = None # not used
+    required = []
+    required_offset = 0
     if not (flags & SRE_FLAG_IGNORECASE and flags & SRE_FLAG_LOCALE):
+        # zero-width assertions like \b do not consume characters, so
+        # the first character matched still comes from what follows them
+        # (a leading ^ or \A is left alone, search() has a faster path)
+        if flags & SRE_FLAG_MULTILINE:
+            anchors = (AT_BEGINNING_STRING,)
+        else:
+            anchors = (AT_BEGINNING, AT_BEGINNING_STRING)
+        i = 0
+        while (i < len(pattern.data) and pattern.data[i][0] is AT and
+               pattern.data[i][1] not in anchors):
+            i += 1
+        if i:
+            pattern = pattern[i:]
         # look for literal prefix
         prefix, prefix_skip, got_all = _get_literal_prefix(pattern, flags)
+        if i:
+            # the matcher has to start at the assertions
+            prefix_skip = 0
         # if no prefix, look for charset prefix
         if not prefix:
             charset = _get_charset_prefix(pattern, flags)
@@ -547,6 +588,8 @@ def _compile_info(code, pattern, flags):
                 assert not hascased
                 if charset == _CHARSET_ALL:
                     charset = None
+            # look for a literal that has to occur somewhere
+            required, required_offset = _get_required_literal(pattern, flags)
 ##     if prefix:
 ##         print("*** PREFIX", prefix, prefix_skip)
 ##     if charset:
@@ -563,6 +606,8 @@ def _compile_info(code, pattern, flags):
             mask = mask | SRE_INFO_LITERAL
     elif charset:
         mask = mask | SRE_INFO_CHARSET
+    if required:
+        mask = mask | SRE_INFO_REQUIRED
     emit(mask)
     # pattern length
     if lo < MAXCODE:
@@ -571,6 +616,11 @@ def _compile_info(code, pattern, flags):
         emit(MAXCODE)
         prefix = prefix[:MAXCODE]
     emit(hi)
+    # add required literal
+    if required:
+        emit(len(required)) # length
+        emit(required_offset) # minimal offset from the start of a match
+        code.extend(required)
     # add literal prefix
     if prefix:
         emit(len(prefix)) # length
@@ -729,10 +779,19 @@ def print_2(*args):
                     max = 'MAXREPEAT'
                 print_(op, skip, bin(flags), min, max, to=i+skip)
                 start = i+4
+                if flags & SRE_INFO_REQUIRED:
+                    required_len, required_offset = code[start: start+2]
+                    print_2('  required_offset', required_offset)
+                    start += 2
+                    required = code[start: start+required_len]
+                    print_2('  required',
+                            '[%s]' % ', '.join('%#02x' % x for x in required),
+                            '(%r)' % ''.join(map(chr, required)))
+                    start += required_len
                 if flags & SRE_INFO_PREFIX:
-                    prefix_len, prefix_skip = code[i+4: i+6]
+                    prefix_len, prefix_skip = code[start: start+2]
                     print_2('  prefix_skip', prefix_skip)
-                    start = i + 6
+                    start += 2
                     prefix = code[start: start+prefix_len]
                     print_2('  prefix',
                             '[%s]' % ', '.join('%#02x' % x for x in prefix),
@@ -54,6 +54,7 @@
 
 import io
 import os
+import stat as _stat
 import sys
 from enum import IntEnum, IntFlag
 
@@ -215,6 +216,13 @@ def _intenum_converter(value, enum_klass):
 class _GiveupOnSendfile(Exception): pass
 
 
+def _seekable(file):
+    # Pipes have a seek() method which always fails.
+    if hasattr(file, 'seekable'):
+        return file.seekable()
+    return hasattr(file, 'seek')
+
+
 class socket(_socket.socket):
 
     """A subclass of _socket.socket adding the makefile() method."""
@@ -361,11 +369,23 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             except (AttributeError, io.UnsupportedOperation) as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
             try:
-                fsize = os.fstat(fileno).st_size
+                st = os.fstat(fileno)
             except OSError as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
-            if not fsize:
-                return 0  # empty file
+            # A pipe has no size and can't be used with os.sendfile(), but
+            # os.splice() moves its data to the socket without a copy.
+            # Buffered file objects may already hold data read from the
+            # pipe, so only raw files are spliced.
+            is_pipe = _stat.S_ISFIFO(st.st_mode)
+            if is_pipe:
+                if (offset or not hasattr(os, 'splice')
+                        or not isinstance(file, io.FileIO)):
+                    raise _GiveupOnSendfile("can't splice from this pipe")
+                fsize = 2 ** 30
+            else:
+                fsize = st.st_size
+                if not fsize:
+                    return 0  # empty file
             # Truncate to 1GiB to avoid OverflowError, see bpo-38319.
             blocksize = min(count or fsize, 2 ** 30)
             timeout = self.gettimeout()
@@ -393,7 +413,10 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
                         if blocksize <= 0:
                             break
                     try:
-                        sent = os_sendfile(sockno, fileno, offset, blocksize)
+                        if is_pipe:
+                            sent = os.splice(fileno, sockno, blocksize)
+                        else:
+                            sent = os_sendfile(sockno, fileno, offset, blocksize)
                     except BlockingIOError:
                         if not timeout:
                             # Block until the socket is ready to send some
@@ -415,7 +438,7 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
                         total_sent += sent
                 return total_sent
             finally:
-                if total_sent > 0 and hasattr(file, 'seek'):
+                if total_sent > 0 and not is_pipe and hasattr(file, 'seek'):
                     file.seek(offset)
     else:
         def _sendfile_use_sendfile(self, file, offset=0, count=None):
@@ -455,7 +478,7 @@ def _sendfile_use_send(self, file, offset=0, count=None):
                             break
             return total_sent
         finally:
-            if total_sent > 0 and hasattr(file, 'seek'):
+            if total_sent > 0 and _seekable(file):
                 file.seek(offset + total_sent)
 
     def _check_sendfile_params(self, file, offset, count):
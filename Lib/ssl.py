@@ -1265,15 +1265,60 @@ def sendall(self, data, flags=0):
         else:
             return super().sendall(data, flags)
 
+    def _sendfile_use_ssl_sendfile(self, file, offset=0, count=None):
+        # Lazy import to improve module import time
+        import stat
+
+        self._check_sendfile_params(file, offset, count)
+        try:
+            fileno = file.fileno()
+            st = os.fstat(fileno)
+        except (AttributeError, OSError) as err:
+            raise _socket._GiveupOnSendfile(err)  # not a regular file
+        if not stat.S_ISREG(st.st_mode):
+            raise _socket._GiveupOnSendfile("not a regular file")
+        if not st.st_size:
+            return 0  # empty file
+        if self.gettimeout() == 0:
+            raise ValueError("non-blocking sockets are not supported")
+        # Truncate to 1GiB to avoid OverflowError, see bpo-38319.
+        blocksize = min(count or st.st_size, 2 ** 30)
+        total_sent = 0
+        try:
+            while True:
+                if count:
+                    blocksize = min(count - total_sent, blocksize)
+                    if blocksize <= 0:
+                        break
+                try:
+                    sent = self._sslobj.sendfile(fileno, offset, blocksize)
+                except OSError as err:
+                    if total_sent == 0:
+                        raise _socket._GiveupOnSendfile(err)
+                    raise err from None
+                if sent == 0:
+                    break  # EOF
+                offset += sent
+                total_sent += sent
+            return total_sent
+        finally:
+            if total_sent > 0 and hasattr(file, 'seek'):
+                file.seek(offset)
+
     def sendfile(self, file, offset=0, count=None):
         """Send a file, possibly by using os.sendfile() if this is a
-        clear-text socket.  Return the total number of bytes sent.
+        clear-text socket or SSL_sendfile() if kernel TLS is used for
+        sending.  Return the total number of bytes sent.
         """
-        if self._sslobj is not None:
-            return self._sendfile_use_send(file, offset, count)
-        else:
+        if self._sslobj is None:
             # os.sendfile() works with plain sockets only
             return super().sendfile(file, offset, count)
+        if self._sslobj.uses_ktls_for_send():
+            try:
+                return self._sendfile_use_ssl_sendfile(file, offset, count)
+            except _socket._GiveupOnSendfile:
+                pass
+        return self._sendfile_use_send(file, offset, count)
 
     def recv(self, buflen=1024, flags=0):
         self._checkClosed()
@@ -337,15 +337,17 @@ def median(data):
     4.0
 
     """
-    data = sorted(data)
+    if not isinstance(data, (list, tuple)):
+        data = list(data)
     n = len(data)
     if n == 0:
         raise StatisticsError("no median for empty data")
     if n % 2 == 1:
-        return data[n // 2]
+        return _select(data, (n // 2,))[0]
     else:
         i = n // 2
-        return (data[i - 1] + data[i]) / 2
+        low, high = _select(data, (i - 1, i))
+        return (low + high) / 2
 
 
 def median_low(data):
@@ -360,17 +362,15 @@ def median_low(data):
     3
 
     """
-    # Potentially the sorting step could be replaced with a quickselect.
-    # However, it would require an excellent implementation to beat our
-    # highly optimized builtin sort.
-    data = sorted(data)
+    if not isinstance(data, (list, tuple)):
+        data = list(data)
     n = len(data)
     if n == 0:
         raise StatisticsError("no median for empty data")
     if n % 2 == 1:
-        return data[n // 2]
+        return _select(data, (n // 2,))[0]
     else:
-        return data[n // 2 - 1]
+        return _select(data, (n // 2 - 1,))[0]
 
 
 def median_high(data):
@@ -385,11 +385,12 @@ def median_high(data):
     5
 
     """
-    data = sorted(data)
+    if not isinstance(data, (list, tuple)):
+        data = list(data)
     n = len(data)
     if n == 0:
         raise StatisticsError("no median for empty data")
-    return data[n // 2]
+    return _select(data, (n // 2,))[0]
 
 
 def median_grouped(data, interval=1.0):
@@ -1182,35 +1183,35 @@ def quantiles(data, *, n=4, method='exclusive'):
     if n < 1:
         raise StatisticsError('n must be at least 1')
 
-    data = sorted(data)
+    if not isinstance(data, (list, tuple)):
+        data = list(data)
 
     ld = len(data)
     if ld < 2:
         if ld == 1:
-            return data * (n - 1)
+            return [data[0]] * (n - 1)
         raise StatisticsError('must have at least one data point')
 
+    # Each cut point is interpolated between data[j] and data[j + 1]
+    # of the sorted data, with weights (n - delta) and delta.
     if method == 'inclusive':
         m = ld - 1
-        result = []
-        for i in range(1, n):
-            j, delta = divmod(i * m, n)
-            interpolated = (data[j] * (n - delta) + data[j + 1] * delta) / n
-            result.append(interpolated)
-        return result
-
-    if method == 'exclusive':
+        cuts = [divmod(i * m, n) for i in range(1, n)]
+    elif method == 'exclusive':
         m = ld + 1
-        result = []
+        cuts = []
         for i in range(1, n):
             j = i * m // n                               # rescale i to m/n
             j = 1 if j < 1 else ld-1 if j > ld-1 else j  # clamp to 1 .. ld-1
             delta = i*m - j*n                            # exact integer math
-            interpolated = (data[j - 1] * (n - delta) + data[j] * delta) / n
-            result.append(interpolated)
-        return result
+            cuts.append((j - 1, delta))
+    else:
+        raise ValueError(f'Unknown method: {method!r}')
 
-    raise ValueError(f'Unknown method: {method!r}')
+    ranks = sorted({k for j, _ in cuts for k in (j, j + 1)})
+    value = dict(zip(ranks, _select(data, ranks)))
+    return [(value[j] * (n - delta) + value[j + 1] * delta) / n
+            for j, delta in cuts]
 
 
 ## Normal Distribution #####################################################
@@ -1473,6 +1474,12 @@ def _sum(data):
     allowed.
 
     """
+    if _float_sums is not None:
+        sums = _float_sums(data, False)
+        if sums is not None and sums[1]:
+            T, count, sx, _ = sums
+            return (T, Fraction(sx, 1 << 1074), count)
+
     count = 0
     types = set()
     types_add = types.add
@@ -1511,6 +1518,15 @@ def _ss(data, c=None):
         T, ssd, count = _sum((d := x - c) * d for x in data)
         return (T, ssd, c, count)
 
+    if _float_sums is not None:
+        sums = _float_sums(data, True)
+        if sums is not None and sums[1]:
+            # The sums are exact integer multiples of 2**-1074 and 2**-2148.
+            T, count, sx, sxx = sums
+            ssd = Fraction(count * sxx - sx * sx, count << 2148)
+            c = Fraction(sx, count << 1074)
+            return (T, ssd, c, count)
+
     count = 0
     types = set()
     types_add = types.add
@@ -1545,6 +1561,12 @@ def _ss(data, c=None):
     return (T, ssd, c, count)
 
 
+def _select(data, ranks):
+    """Return the items of sorted(data) at the positions in ranks."""
+    data = sorted(data)
+    return [data[i] for i in ranks]
+
+
 def _isfinite(x):
     try:
         return x.is_finite()  # Likely a Decimal.
@@ -1864,6 +1886,11 @@ def _normal_dist_inv_cdf(p, mu, sigma):
 
 # If available, use C implementation
 try:
-    from _statistics import _normal_dist_inv_cdf
+    from _statistics import _normal_dist_inv_cdf, _select
 except ImportError:
     pass
+
+try:
+    from _statistics import _float_sums
+except ImportError:
+    _float_sums = None
@@ -755,6 +755,20 @@ def _use_posix_spawn():
 _HAVE_POSIX_SPAWN_CLOSEFROM = hasattr(os, 'POSIX_SPAWN_CLOSEFROM')
 
 
+def _posix_spawn_has_setsid():
+    """Check if os.posix_spawn() supports the setsid argument."""
+    try:
+        # POSIX_SPAWN_SETSID was added in glibc 2.26
+        libc, version = os.confstr('CS_GNU_LIBC_VERSION').split(maxsplit=1)
+        version = tuple(map(int, version.split('.')))
+    except (AttributeError, ValueError, OSError):
+        return False
+    return sys.platform == 'linux' and libc == 'glibc' and version >= (2, 26)
+
+
+_HAVE_POSIX_SPAWN_SETSID = _USE_POSIX_SPAWN and _posix_spawn_has_setsid()
+
+
 class Popen:
     """ Execute a child program in a new process.
 
@@ -1763,12 +1777,30 @@ def _get_handles(self, stdin, stdout, stderr):
                     errread, errwrite)
 
 
+        @staticmethod
+        def _find_executable(executable, env):
+            """Return the first file named *executable* which can be
+            executed in the PATH of *env*, or None."""
+            if not isinstance(executable, str):
+                return None
+            # This matches the directories tried by _fork_exec()
+            for dir in os.get_exec_path(env):
+                path = os.path.join(dir, executable)
+                if os.access(path, os.X_OK) and not os.path.isdir(path):
+                    return path
+            return None
+
+
         def _posix_spawn(self, args, executable, env, restore_signals, close_fds,
                          p2cread, p2cwrite,
                          c2pread, c2pwrite,
-                         errread, errwrite):
+                         errread, errwrite, start_new_session, process_group):
             """Execute program using os.posix_spawn()."""
             kwargs = {}
+            if start_new_session:
+                kwargs['setsid'] = True
+            if process_group >= 0:
+                kwargs['setpgroup'] = process_group
             if restore_signals:
                 # See _Py_RestoreSignals() in Python/pylifecycle.c
                 sigset = []
@@ -1838,7 +1870,6 @@ def _execute_child(self, args, executable, preexec_fn, close_fds,
             sys.audit("subprocess.Popen", executable, args, cwd, env)
 
             if (_USE_POSIX_SPAWN
-                    and os.path.dirname(executable)
                     and preexec_fn is None
                     and (not close_fds or _HAVE_POSIX_SPAWN_CLOSEFROM)
                     and not pass_fds
@@ -1846,17 +1877,26 @@ def _execute_child(self, args, executable, preexec_fn, close_fds,
                     and (p2cread == -1 or p2cread > 2)
                     and (c2pwrite == -1 or c2pwrite > 2)
                     and (errwrite == -1 or errwrite > 2)
-                    and not start_new_session
-                    and process_group == -1
+                    and (not start_new_session or _HAVE_POSIX_SPAWN_SETSID)
                     and gid is None
                     and gids is None
                     and uid is None
                     and umask < 0):
-                self._posix_spawn(args, executable, env, restore_signals, close_fds,
-                                  p2cread, p2cwrite,
-                                  c2pread, c2pwrite,
-                                  errread, errwrite)
-                return
+                if os.path.dirname(executable):
+                    spawn_executable = executable
+                else:
+                    # posix_spawn() does not search PATH: look the program
+                    # up here and leave the error reporting to _fork_exec()
+                    # if it is not found.
+                    spawn_executable = self._find_executable(executable, env)
+                if spawn_executable is not None:
+                    self._posix_spawn(args, spawn_executable, env,
+                                      restore_signals, close_fds,
+                                      p2cread, p2cwrite,
+                                      c2pread, c2pwrite,
+                                      errread, errwrite,
+                                      start_new_session, process_group)
+                    return
 
             orig_executable = executable
 
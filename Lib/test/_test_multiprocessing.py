@@ -4331,6 +4331,101 @@ def test_shared_memory_name_with_embedded_null(self):
             finally:
                 sms._name = orig_name
 
+    @staticmethod
+    def _reverse_buffer(buf):
+        return pickle.PickleBuffer(bytearray(buf)[::-1])
+
+    @unittest.skipUnless(shared_memory._USE_POSIX,
+                         "shared memory blocks are handed over on POSIX only")
+    def test_shared_memory_pickle_handover(self):
+        large = pickle.PickleBuffer(bytearray(range(256)) * 8)
+        small = pickle.PickleBuffer(bytearray(10))
+        data = shared_memory._dumps([large, small, b'x'], 1024)
+        obj = pickle.loads(data)
+        self.assertIsInstance(obj, shared_memory._SharedBuffers)
+        segments, _ = obj
+        self.assertEqual([size for _, size in segments], [2048])
+        received = shared_memory._loads(data)
+        self.assertEqual([bytes(x) for x in received],
+                         [bytes(large), bytes(small), b'x'])
+        # the block was unlinked by _loads()
+        with self.assertRaises(FileNotFoundError):
+            shared_memory.SharedMemory(segments[0][0].lstrip('/'))
+
+        # without large buffers, the result is a plain pickle
+        data = shared_memory._dumps([small], 1024)
+        self.assertEqual(bytes(pickle.loads(data)[0]), bytes(small))
+        self.assertEqual(bytes(shared_memory._loads(data)[0]), bytes(small))
+
+    def test_pool_shared_memory_threshold(self):
+        buffers = [bytes(range(i, i + 200)) * 10 for i in range(10)]
+        with self.Pool(2, shared_memory_threshold=1024) as pool:
+            results = pool.map(self._reverse_buffer,
+                               map(pickle.PickleBuffer, buffers))
+            self.assertEqual([bytes(r) for r in results],
+                             [b[::-1] for b in buffers])
+            self.assertEqual(pool.apply(sqr, (5,)), 25)
+        pool.join()
+
+        for threshold in (0, -1, 1.5):
+            with self.assertRaises(ValueError):
+                self.Pool(1, shared_memory_threshold=threshold)
+
+    @classmethod
+    def _echo_shared_memory_queue(cls, inq, outq):
+        while (data := inq.get_bytes()) != b'stop':
+            outq.put_bytes(data)
+        outq.put(('done', os.getpid()))
+        inq.close()
+        outq.close()
+
+    def test_shared_memory_queue(self):
+        # Small buffers make the messages wrap around and the sides wait
+        inq = multiprocessing.SharedMemoryQueue(256)
+        outq = multiprocessing.SharedMemoryQueue(200)
+        p = self.Process(target=self._echo_shared_memory_queue,
+                         args=(inq, outq))
+        p.daemon = True
+        p.start()
+        messages = [bytes(range(i % 64)) * (1 + i % 3) for i in range(100)]
+        for data in messages:
+            inq.put_bytes(bytearray(data))
+            self.assertEqual(outq.get_bytes(timeout=support.SHORT_TIMEOUT),
+                             data)
+        # Both buffers can hold three messages of 60 bytes
+        for data in messages[60:63]:
+            inq.put_bytes(data[:60])
+        for data in messages[60:63]:
+            self.assertEqual(outq.get_bytes(), data[:60])
+        inq.put_bytes(b'stop')
+        self.assertEqual(outq.get(), ('done', p.pid))
+        join_process(p)
+        self.assertTrue(inq.empty())
+        self.assertTrue(outq.empty())
+        inq.close()
+        outq.close()
+
+    def test_shared_memory_queue_errors(self):
+        q = multiprocessing.SharedMemoryQueue(256)
+        self.assertTrue(q.empty())
+        self.assertRaises(pyqueue.Empty, q.get_nowait)
+        self.assertRaises(pyqueue.Empty, q.get, timeout=0.01)
+        q.put([1, 'x'])
+        self.assertFalse(q.empty())
+        self.assertEqual(q.get(), [1, 'x'])
+        with self.assertRaises(ValueError):
+            q.put_bytes(bytes(253))
+        q.put_bytes(bytes(252))
+        self.assertRaises(pyqueue.Full, q.put_nowait, 1)
+        self.assertRaises(pyqueue.Full, q.put_bytes, b'x', timeout=0.01)
+        self.assertEqual(q.get_bytes(), bytes(252))
+        q.close()
+        q.close()
+        self.assertRaises(ValueError, q.put, 1)
+        self.assertRaises(ValueError, q.get)
+        with self.assertRaises(ValueError):
+            multiprocessing.SharedMemoryQueue(4)
+
     def test_shared_memory_basics(self):
         name_tsmb = self._new_shm_name('test01_tsmb')
         sms = shared_memory.SharedMemory(name_tsmb, create=True, size=512)
@@ -2983,6 +2983,50 @@ def test_strptime_z_empty(self):
                 result = self.theclass.strptime(string, format)
                 self.assertEqual(result, target)
 
+    def test_strptime_numeric_directives(self):
+        # Formats made of numeric directives must behave exactly like
+        # _strptime, both for valid and for invalid input.
+        def check(string, format):
+            try:
+                expected = _strptime._strptime_datetime_datetime(
+                    self.theclass, string, format)
+            except (ValueError, re.error) as exc:
+                with self.assertRaisesRegex(type(exc), re.escape(str(exc))):
+                    self.theclass.strptime(string, format)
+            else:
+                got = self.theclass.strptime(string, format)
+                self.assertEqual(got, expected)
+                self.assertIs(type(got), type(expected))
+                self.assertEqual(got.tzinfo, expected.tzinfo)
+
+        fmt = '%Y-%m-%d %H:%M:%S.%f%z'
+        for string in ['2024-05-17 13:45:12.123456', '2024-5-7 3:4:5.1',
+                       '2024-05-17 13:45:12.1234567', '2024-02-30 00:00:00.0',
+                       '2024-00-17 13:45:12.0', '2024-13-17 13:45:12.0',
+                       '2024-05-17 24:45:12.0', '2024-05-17 13:60:12.0',
+                       '2024-05-17 13:45:60.0', '2024-05-17 13:45:61.0',
+                       '0000-05-17 13:45:12.0', '2024-05- 7 13:45:12.0',
+                       '2024-05-17  13:45:12.0', '2024-05-17\t13:45:12.0',
+                       '2024-05-17 13:45:12.0Z', '2024-05-17 13:45:12.0z',
+                       '2024-05-17 13:45:12.0+05:30', '2024-05-17 13:45:12.0-0530',
+                       '2024-05-17 13:45:12.0+05:30:15.25',
+                       '2024-05-17 13:45:12.0-053015.000001',
+                       '2024-05-17 13:45:12.0+05:3015', '2024-05-17 13:45:12.0+0530:15',
+                       '2024-05-17 13:45:12.0+24:00', '2024-05-17 13:45:12.0+05',
+                       '2024-05-17 13:45:12.0-00:00', '2024-05-17 13:45:12.0+05:30x']:
+            with self.subTest(string=string, format=fmt):
+                check(string, fmt)
+        for string, format in [('20240517', '%Y%m%d'), ('2024517', '%Y%m%d'),
+                               ('2024%05', '%Y%%%m'), ('2024t05', '%YT%m'),
+                               ('12:30', '%H:%M'), ('1230', '%H%M'),
+                               ('05/17/2024', '%m/%d/%Y'), ('17', '%d'),
+                               ('2024 2024', '%Y %Y'), ('2024', '%Y%'),
+                               ('99', '%f'), ('59+01', '%S%z')]:
+            with self.subTest(string=string, format=format):
+                with warnings.catch_warnings():
+                    warnings.simplefilter('ignore', DeprecationWarning)
+                    check(string, format)
+
     def test_more_timetuple(self):
         # This tests fields beyond those tested by the TestDate.test_timetuple.
         t = self.theclass(2004, 12, 31, 6, 22, 33)
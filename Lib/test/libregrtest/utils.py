@@ -389,7 +389,7 @@ def get_build_info():
     if hasattr(sys, 'getobjects'):
         build.append("TraceRefs")
     # --enable-pystats
-    if hasattr(sys, '_stats_on'):
+    if sysconfig.get_config_var('Py_STATS'):
         build.append("pystats")
     # --with-valgrind
     if sysconfig.get_config_var('WITH_VALGRIND'):
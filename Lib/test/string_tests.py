@@ -375,6 +375,21 @@ def test_adaptive_find(self):
             self.checkequal(len(haystack), haystack + needle, 'find', needle)
             self.checkequal(1, haystack + needle, 'count', needle)
 
+    def test_find_short_needle(self):
+        # Short needles in long haystacks jump between occurrences of the
+        # needle's last character, and switch to the default search when
+        # false positives are frequent.
+        for text in ('x' * 1000, 'xb' * 500, 'bx' * 500, 'b' * 1000):
+            for needle in 'ab', 'abb', 'aab', 'abab':
+                with self.subTest(text=text[:4], needle=needle):
+                    self.checkequal(-1, text, 'find', needle)
+                    self.checkequal(0, text, 'count', needle)
+                    haystack = text + needle + text + needle
+                    self.checkequal(len(text), haystack, 'find', needle)
+                    self.checkequal(2, haystack, 'count', needle)
+                    self.checkequal(1, haystack, 'count', needle, 0,
+                                    len(haystack) - 1)
+
     def test_find_with_memory(self):
         # Test the "Skip with memory" path in the two-way algorithm.
         for N in 1000, 3000, 10_000, 30_000:
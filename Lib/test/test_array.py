@@ -3,6 +3,7 @@
 """
 
 import collections.abc
+import io
 import unittest
 from test import support
 from test.support import import_helper
@@ -322,6 +323,22 @@ def test_pickle_for_empty_array(self):
             self.assertEqual(a.x, b.x)
             self.assertEqual(type(a), type(b))
 
+    def test_resize_after_pickle(self):
+        # Pickling must not leave the array exporting its buffer.
+        for pickler in (pickle.Pickler, pickle._Pickler):
+            with self.subTest(pickler=pickler):
+                a = array.array(self.typecode, self.example)
+                f = io.BytesIO()
+                p = pickler(f, protocol=5)
+                p.dump(a)
+                a.append(self.example[0])
+                a.pop()
+                self.assertEqual(pickle.loads(f.getvalue()), a)
+        a = array.array(self.typecode, self.example)
+        reduced = a.__reduce_ex__(5)
+        a.append(self.example[0])
+        del reduced
+
     def test_iterator_pickle(self):
         orig = array.array(self.typecode, self.example)
         data = list(orig)
@@ -1368,6 +1385,26 @@ def test_type_error(self):
         with self.assertRaises(TypeError):
             a[0] = 42.0
 
+    def test_extend_sequence_errors(self):
+        # Items before a bad one stay appended, as when iterating.
+        for seq in [1, 2, 42.0, 3], (1, 2, 42.0, 3), [1, Intable(2), 'x', 3]:
+            a = array.array(self.typecode, [5])
+            with self.assertRaises(TypeError):
+                a.extend(seq)
+            self.assertEqual(a, array.array(self.typecode, [5, 1, 2]))
+
+        # The list can change while non-int items are converted.
+        class Shrink:
+            def __index__(self):
+                items.clear()
+                return 7
+        items = [1, Shrink(), 2]
+        a = array.array(self.typecode)
+        a.extend(items)
+        self.assertEqual(a, array.array(self.typecode, [1, 7]))
+        items = [1, Shrink(), 2]
+        self.assertRaises(IndexError, array.array, self.typecode, items)
+
 class Intable:
     def __init__(self, num):
         self._num = num
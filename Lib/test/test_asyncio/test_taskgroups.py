@@ -1113,6 +1113,16 @@ def loop_factory():
         loop.set_task_factory(asyncio.eager_task_factory)
         return loop
 
+    async def test_eagerly_completed_task_not_tracked(self):
+        async def hit():
+            return 42
+
+        async with asyncio.TaskGroup() as tg:
+            t = tg.create_task(hit())
+            self.assertTrue(t.done())
+            self.assertEqual(t.result(), 42)
+            self.assertEqual(len(tg._tasks), 0)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -117,6 +117,21 @@ def addnoise(line):
         # empty strings. TBD: shouldn't it raise an exception instead ?
         self.assertEqual(binascii.a2b_base64(self.type2test(fillers)), b'')
 
+    def test_base64_quads(self):
+        # Whole quads are decoded in bulk, everything else one character
+        # at a time; check the transitions between the two.
+        a2b = binascii.a2b_base64
+        encoded = binascii.b2a_base64(self.rawdata, newline=False)
+        for i in range(0, 20):
+            for junk in (b'!', b'\n', b'=', b'=='):
+                data = self.type2test(encoded[:i] + junk + encoded[i:])
+                if junk.startswith(b'=') and i % 4 >= 2:
+                    # Valid padding ends the data
+                    continue
+                self.assertEqual(a2b(data), self.rawdata, (i, junk))
+        self.assertEqual(a2b(self.type2test(b'YWJj=YWJj')), b'abcabc')
+        self.assertEqual(a2b(self.type2test(b'YWJjZA==YWJj')), b'abcd')
+
     def test_base64_strict_mode(self):
         # Test base64 with strict mode on
         def _assertRegexTemplate(assert_regex: str, data: bytes, non_strict_mode_expected_result: bytes):
@@ -291,6 +291,31 @@ def __gt__(self, other):
         self.assertEqual(i1, 40)
         self.assertEqual(i2, 41)
 
+    def test_scalar_lists(self):
+        mod = self.module
+        for data in [list(range(0, 100, 2)),
+                     [i * 2**40 for i in range(-25, 25)],
+                     [i / 4 for i in range(50)],
+                     sorted(str(i) for i in range(50)),
+                     sorted(chr(0x10000 + i) + 'x' * (i % 3) for i in range(50)),
+                     # The direct comparisons give way to the generic ones.
+                     [1, 2, 3, 2**100, 2**101, 2**102],
+                     [1.0, 2, 3.5, 4, 5.0]]:
+            for x in set(data) | {data[0] * 2, data[-1] * 2}:
+                with self.subTest(data=data[:3], x=x):
+                    for lo, hi in [(0, len(data)), (2, len(data) - 1)]:
+                        expected = lo + sum(e < x for e in data[lo:hi])
+                        self.assertEqual(mod.bisect_left(data, x, lo, hi),
+                                         expected)
+                        expected = lo + sum(e <= x for e in data[lo:hi])
+                        self.assertEqual(mod.bisect_right(data, x, lo, hi),
+                                         expected)
+
+        # Items of other types are still compared normally.
+        self.assertRaises(TypeError, mod.bisect_left, [1, 2, 'a'], 3)
+        self.assertRaises(TypeError, mod.bisect_right, ['a', 1], 'b')
+        self.assertRaises(IndexError, mod.bisect_left, [1, 2], 3, 0, 5)
+
 class TestBisectPython(TestBisect, unittest.TestCase):
     module = py_bisect
 
@@ -3233,6 +3233,27 @@ class BEPoint(ctypes.BigEndianStructure):
             self.assertNotEqual(point, a)
             self.assertRaises(NotImplementedError, a.tolist)
 
+    def test_memoryview_compare_contiguous_fast_path(self):
+        # Contiguous integer buffers are compared with memcmp().
+        for fmt in 'bBhHiIlLqQ':
+            a = array.array(fmt, range(100))
+            v = memoryview(a)
+            w = memoryview(array.array(fmt, a))
+            self.assertEqual(v, w)
+            self.assertEqual(v.cast('B').cast(fmt, [10, 10]),
+                             w.cast('B').cast(fmt, [10, 10]))
+            w[-1] = 7
+            self.assertNotEqual(v, w)
+            self.assertEqual(v[:-1], w[:-1])
+            self.assertEqual(v[::2], w[::2])
+
+        # Floats with different bytes can be equal and vice versa.
+        d1 = memoryview(struct.pack('dd', 0.0, 1.0)).cast('d')
+        d2 = memoryview(struct.pack('dd', -0.0, 1.0)).cast('d')
+        self.assertEqual(d1, d2)
+        nan = memoryview(struct.pack('d', float('nan'))).cast('d')
+        self.assertNotEqual(nan, nan)
+
     @warnings_helper.ignore_warnings(category=DeprecationWarning)  # gh-80480 array('u')
     def test_memoryview_compare_special_cases_deprecated_u_type_code(self):
 
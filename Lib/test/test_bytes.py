@@ -1579,6 +1579,23 @@ def test_fifo_overrun(self):
         b += bytes(2)  # Append exactly the number of deleted bytes
         del b          # Free memory buffer, allowing pydebug verification
 
+    def test_fifo_reuses_buffer(self):
+        # Appending after deleting from the front moves the data back to
+        # the start of the buffer instead of growing it.
+        b = bytearray(range(256))
+        del b[200:]
+        del b[:50]
+        size = sys.getsizeof(b)
+        b += bytes(range(60))
+        self.assertEqual(b, bytes(range(50, 200)) + bytes(range(60)))
+        self.assertLessEqual(sys.getsizeof(b), size)
+        for i in range(1000):
+            b += bytes([i % 256]) * 7
+            self.assertEqual(b[-7:], bytes([i % 256]) * 7)
+            del b[:7]
+        self.assertEqual(len(b), 210)
+        self.assertLessEqual(sys.getsizeof(b), size)
+
     def test_del_expand(self):
         # Reducing the size should not expand the buffer (issue #23985)
         b = bytearray(10)
@@ -3,6 +3,7 @@
 """
 import os
 import sys
+import sysconfig
 import types
 import unittest
 from test import support
@@ -12,7 +13,7 @@
 
 
 # Is the Py_STATS macro defined?
-Py_STATS = hasattr(sys, '_stats_on')
+Py_STATS = bool(sysconfig.get_config_var('Py_STATS'))
 
 
 class CAPITests(unittest.TestCase):
@@ -87,6 +88,7 @@ def test_config_get(self):
             ("stdio_errors", str, None),
             ("stdlib_dir", str | None, "_stdlib_dir"),
             ("tracemalloc", int, None),
+            ("type_cache_size", int, None),
             ("use_environment", bool, None),
             ("use_frozen_modules", bool, None),
             ("use_hash_seed", bool, None),
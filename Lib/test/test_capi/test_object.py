@@ -148,6 +148,8 @@ def test_enable_deferred_refcount(self):
         self.assertEqual(_testcapi.pyobject_enable_deferred_refcount("not tracked"), 0)
         foo = []
         self.assertEqual(_testcapi.pyobject_enable_deferred_refcount(foo), int(support.Py_GIL_DISABLED))
+        # Enabling it again reports that it is enabled
+        self.assertEqual(_testcapi.pyobject_enable_deferred_refcount(foo), int(support.Py_GIL_DISABLED))
 
         # Make sure reference counting works on foo now
         self.assertEqual(foo, [])
@@ -156,9 +158,9 @@ def test_enable_deferred_refcount(self):
 
         # Make sure that PyUnstable_Object_EnableDeferredRefcount is thread safe
         def silly_func(obj):
-            self.assertIn(
+            self.assertEqual(
                 _testcapi.pyobject_enable_deferred_refcount(obj),
-                (0, 1)
+                int(support.Py_GIL_DISABLED)
             )
 
         silly_list = [1, 2, 3]
@@ -102,6 +102,35 @@ def f():
         _testinternalcapi.invalidate_executors(f.__code__)
         self.assertFalse(exe.is_valid())
 
+    def test_get_executors(self):
+        ns = {}
+        exec(textwrap.dedent(f"""
+            def f(x):
+                for i in range({TIER2_THRESHOLD}):
+                    if x:
+                        pass
+        """), ns, ns)
+        f = ns['f']
+        f(True)
+        exe = get_first_executor(f)
+        [info] = sys._jit.get_executors(f.__code__)
+        self.assertIs(_opcode.get_executor(f.__code__, info['offset']), exe)
+        self.assertTrue(info['valid'])
+        self.assertIsNone(info['invalidation_reason'])
+        self.assertEqual(info['uops'], list(exe))
+        self.assertGreater(len(info['exits']), 0)
+        for exit in info['exits']:
+            self.assertIsInstance(exit['target'], int)
+            self.assertIsInstance(exit['temperature'], int)
+            self.assertFalse(exit['linked'])
+
+        before = sys._jit.get_invalidations()
+        _testinternalcapi.invalidate_executors(f.__code__)
+        self.assertFalse(exe.is_valid())
+        self.assertEqual(sys._jit.get_executors(f.__code__), [])
+        after = sys._jit.get_invalidations()
+        self.assertGreater(after['code'], before['code'])
+
     def test_sys__clear_internal_caches(self):
         def f():
             for _ in range(TIER2_THRESHOLD):
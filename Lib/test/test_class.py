@@ -896,6 +896,27 @@ def test_inspect_dict(self):
             c.__dict__
             self.assertTrue(has_inline_values(c))
 
+    def test_attribute_order(self):
+        # The shared keys are ordered by first use, but each instance keeps
+        # its own insertion order, so assigning the attributes in a
+        # different order doesn't need a dict.
+        class C:
+            def __init__(self, reverse):
+                if reverse:
+                    self.c = 3
+                    self.b = 2
+                    self.a = 1
+                else:
+                    self.a = 1
+                    self.b = 2
+                    self.c = 3
+        objs = [C(i % 2) for i in range(10)]
+        for i, obj in enumerate(objs):
+            self.assertTrue(has_inline_values(obj))
+            order = ['c', 'b', 'a'] if i % 2 else ['a', 'b', 'c']
+            self.assertEqual(list(obj.__dict__), order)
+            self.assertTrue(has_inline_values(obj))
+
     def test_update_dict(self):
         d = { "e": 5, "f": 6 }
         for cls in (Plain, WithAttrs):
@@ -1174,6 +1174,28 @@ def test_cpu_count_default(self):
         res = assert_python_ok('-c', code, PYTHON_CPU_COUNT='default')
         self.assertEqual(self.res2int(res), (os.cpu_count(), os.process_cpu_count()))
 
+    @support.cpython_only
+    def test_type_cache_size(self):
+        try:
+            import _testcapi  # noqa: F401
+        except ImportError:
+            self.skipTest("requires _testcapi")
+        code = "import _testcapi; print(_testcapi.config_get('type_cache_size'))"
+        res = assert_python_ok('-X', 'type_cache_size=65536', '-c', code)
+        self.assertEqual(self.res2int(res), (65536,))
+        res = assert_python_ok('-c', code, PYTHON_TYPE_CACHE_SIZE='256')
+        self.assertEqual(self.res2int(res), (256,))
+
+        msg = b"type_cache_size is missing or invalid"
+        for value in ('', '=foo', '=0', '=1000', '=128', '=33554432'):
+            with self.subTest(value=value):
+                rc, out, err = assert_python_failure(
+                    '-X', 'type_cache_size' + value, '-c', 'pass')
+                self.assertIn(msg, err)
+        rc, out, err = assert_python_failure(
+            '-c', 'pass', PYTHON_TYPE_CACHE_SIZE='3000')
+        self.assertIn(msg, err)
+
     def test_import_time(self):
         # os is not imported at startup
         code = 'import os; import os'
@@ -1192,6 +1214,20 @@ def test_import_time(self):
         assert_python_failure('-X', 'importtime=-1', '-c', code)
         assert_python_failure('-X', 'importtime=3', '-c', code)
 
+    def test_startup_time(self):
+        res = assert_python_ok('-X', 'startuptime', '-c', 'pass')
+        res_err = res.err.decode('utf-8')
+        for phase in ('config', 'runtime', 'core', 'path config',
+                      'importlib', 'encodings', 'sys streams', 'main module',
+                      'site'):
+            self.assertRegex(res_err, rf'startup time: \s*\d+ \| {phase}\n')
+
+        res = assert_python_ok('-S', '-X', 'startuptime', '-c', 'pass')
+        self.assertNotIn(b'| site', res.err)
+
+        res = assert_python_ok('-c', 'pass')
+        self.assertNotIn(b'startup time:', res.err)
+
     def res2int(self, res):
         out = res.out.strip().decode("utf-8")
         return tuple(int(i) for i in out.split())
@@ -16,6 +16,7 @@
 import unittest
 
 from collections import namedtuple, Counter, OrderedDict, _count_elements
+from collections import _count_mapping, _most_common
 from collections import UserDict, UserString, UserList
 from collections import ChainMap
 from collections import deque
@@ -2337,6 +2338,105 @@ def test_helper_function(self):
         self.assertTrue(c.called)
         self.assertEqual(dict(c), {'a': 5, 'b': 2, 'c': 1, 'd': 1, 'r':2 })
 
+    def test_count_mapping(self):
+        # two paths, one for real dicts and one for other mappings
+        for other in {'a': 2, 'z': 1.5}, OrderedDict(a=2, z=1.5):
+            d = {'a': 5, 'b': 2}
+            _count_mapping(d, other)
+            self.assertEqual(list(d.items()),
+                             [('a', 7), ('b', 2), ('z', 1.5)])
+            m = OrderedDict(a=5, b=2)
+            _count_mapping(m, other)
+            self.assertEqual(m, OrderedDict(a=7, b=2, z=1.5))
+
+        # test fidelity to the pure python version
+        c = CounterSubclassWithSetItem(a=1)
+        c.called = False
+        c.update({'a': 2, 'b': 3})
+        self.assertTrue(c.called)
+        self.assertEqual(dict(c), {'a': 3, 'b': 3})
+        c = CounterSubclassWithGet(a=1)
+        c.called = False
+        c.update({'a': 2, 'b': 3})
+        self.assertTrue(c.called)
+        self.assertEqual(dict(c), {'a': 3, 'b': 3})
+
+        class BadItems(dict):
+            def items(self):
+                return [('a', 1, 2)]
+        # same message as the interpreter unpacking the pair
+        with self.assertRaisesRegex(ValueError,
+                r'^too many values to unpack \(expected 2, got 3\)$'):
+            _count_mapping({}, BadItems())
+        class ShortItems(dict):
+            def items(self):
+                return [('a',)]
+        with self.assertRaisesRegex(ValueError,
+                r'^not enough values to unpack \(expected 2, got 1\)$'):
+            _count_mapping({}, ShortItems())
+        self.assertRaises(TypeError, _count_mapping, {'a': 1}, {'a': 'x'})
+
+        class Mutating(int):
+            def __add__(self, other):
+                other_dict['c'] = 1
+                return int(self) + other
+        other_dict = {'a': Mutating(1), 'b': 1}
+        with self.assertRaises(RuntimeError):
+            _count_mapping({'a': 1}, other_dict)
+
+    def test_most_common(self):
+        # agrees with heapq.nlargest(), including the order of ties
+        import heapq
+        import random
+        key = operator.itemgetter(1)
+        for counts in ([], [3], [2, 2, 2], list(range(20)) * 3,
+                       [randrange(10) for i in range(200)],
+                       [random.random() for i in range(200)],
+                       [2**70, -2**70, 1, 1.5, 1, 2**70, 1.0]):
+            d = {i: count for i, count in enumerate(counts)}
+            for n in -1, 0, 1, 2, 5, 50, len(d), len(d) + 1, 2**100:
+                expected = heapq.nlargest(n, d.items(), key=key)
+                self.assertEqual(_most_common(d, n), expected)
+                self.assertEqual(_most_common(OrderedDict(d), n), expected)
+                self.assertEqual(Counter(d).most_common(n), expected)
+        self.assertEqual(_most_common({'a': 1}, -2**100), [])
+
+        # Counts are compared like (count, order) tuples: equal counts are
+        # ties, kept in iteration order, even if they are also ordered.
+        class AllEqual(float):
+            __hash__ = float.__hash__
+            def __eq__(self, other):
+                return True
+        d = {i: AllEqual(i) for i in range(5)}
+        self.assertEqual(_most_common(d, 2), [(0, 0.0), (1, 1.0)])
+
+        class ListItems(dict):
+            def items(self):
+                return [('x', 2), ('y', 3)]
+        self.assertEqual(_most_common(ListItems(a=1), 1), [('y', 3)])
+        self.assertRaises(TypeError, _most_common, {'a': 1, 'b': 'x'}, 1)
+        self.assertRaises(TypeError, _most_common, {'a': 1}, 1.0)
+
+        class Mutating(int):
+            def __lt__(self, other):
+                d['c'] = 1
+                return int(self) < other
+        d = {'a': Mutating(1), 'b': 2}
+        with self.assertRaises(RuntimeError):
+            _most_common(d, 1)
+
+        # The comparison frees the key that is being compared.
+        class Clearing(int):
+            def __lt__(self, other):
+                d.clear()
+                return True
+        d = {''.join(['k', 'a']): Clearing(1), ''.join(['k', 'b']): 2}
+        with self.assertRaises(RuntimeError):
+            _most_common(d, 1)
+        d = Counter({''.join(['k', 'a']): Clearing(1), ''.join(['k', 'b']): 2})
+        with self.assertRaises(RuntimeError):
+            d.most_common(1)
+
     def test_multiset_operations_equivalent_to_set_operations(self):
         # When the multiplicities are all zero or one, multiset operations
         # are guaranteed to be equivalent to the corresponding operations
@@ -24,6 +24,11 @@
     _have_multiprocessing = True
 except (NotImplementedError, ModuleNotFoundError):
     _have_multiprocessing = False
+try:
+    from concurrent.futures import InterpreterPoolExecutor  # noqa: F401
+    _have_interpreters = True
+except ImportError:
+    _have_interpreters = False
 
 from test import support
 from test.support import os_helper
@@ -279,6 +284,16 @@ def test_compile_missing_multiprocessing(self, compile_file_mock):
         compileall.compile_dir(self.directory, quiet=True, workers=5)
         self.assertTrue(compile_file_mock.called)
 
+    @skipUnless(_have_interpreters, "requires subinterpreters")
+    @mock.patch('concurrent.futures.ProcessPoolExecutor')
+    @mock.patch('concurrent.futures.InterpreterPoolExecutor')
+    def test_compile_interpreter_pool_called(self, interp_mock, pool_mock):
+        compileall.compile_dir(self.directory, quiet=True, workers=0,
+                               interpreters=True)
+        self.assertTrue(interp_mock.called)
+        self.assertEqual(interp_mock.call_args[1]['max_workers'], None)
+        self.assertFalse(pool_mock.called)
+
     def test_compile_dir_maxlevels(self):
         # Test the actual impact of maxlevels parameter
         depth = 3
@@ -866,6 +881,23 @@ def test_workers(self):
         for file in files:
             self.assertCompiled(file)
 
+    @skipUnless(_have_interpreters, "requires subinterpreters")
+    def test_workers_interpreters(self):
+        files = []
+        for suffix in range(5):
+            pkgdir = os.path.join(self.directory, 'foo{}'.format(suffix))
+            os.mkdir(pkgdir)
+            script_helper.make_script(pkgdir, '__init__', '')
+            files.append(script_helper.make_script(pkgdir, 'bar2', ''))
+        bad = script_helper.make_script(self.directory, 'bad', 'def f(:')
+
+        rc, out, err = self.assertRunNotOK('-j', '2', '--interpreters',
+                                           self.directory)
+        self.assertRegex(out, b'SyntaxError')
+        self.assertNotCompiled(bad)
+        for file in files:
+            self.assertCompiled(file)
+
     @mock.patch('compileall.compile_dir')
     def test_workers_available_cores(self, compile_dir):
         with mock.patch("sys.argv",
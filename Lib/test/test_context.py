@@ -361,6 +361,36 @@ def ctx2_fun():
 
         ctx1.run(ctx1_fun)
 
+    def test_context_copy_many_sets(self):
+        # Setting variables in a context that is not shared updates its
+        # mapping in place; copies taken in between must not change.
+        ctx = contextvars.Context()
+        cvars = [contextvars.ContextVar(f'v{i}') for i in range(200)]
+        r = random.Random(0)
+        model = {}
+        snapshots = []
+
+        def fun():
+            for i in range(3000):
+                var = r.choice(cvars)
+                value = r.randrange(10)
+                var.set(value)
+                model[var] = value
+                if i % 100 == 0:
+                    snapshots.append((contextvars.copy_context(),
+                                      dict(model)))
+                    holder = iter(contextvars.copy_context())
+                    var.set(value + 1)
+                    model[var] = value + 1
+                    del holder
+
+        ctx.run(fun)
+        self.assertEqual(dict(ctx), model)
+        self.assertEqual(len(ctx), len(model))
+        for snapshot, expected in snapshots:
+            self.assertEqual(dict(snapshot), expected)
+            self.assertEqual(len(snapshot), len(expected))
+
     def test_context_isinstance(self):
         ctx = contextvars.Context()
         self.assertIsInstance(ctx, collections.abc.Mapping)
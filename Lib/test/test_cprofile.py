@@ -150,6 +150,28 @@ def test_bad_descriptor(self):
             with self.assertRaises(TypeError):
                 bytes.find(str())
 
+    def test_builtin_method_calls(self):
+        # Calls through the method descriptor and through a bound method
+        # are counted in the same entry, with their callers.
+        def f(d):
+            for i in range(3):
+                d.setdefault(i, i)
+            dict.setdefault(d, 3, 3)
+            with self.assertRaises(TypeError):
+                dict.setdefault([], 4)
+
+        pr = self.profilerclass()
+        pr.enable()
+        f({})
+        pr.disable()
+        pr.create_stats()
+        entries = {func: stats for func, stats in pr.stats.items()
+                   if "setdefault" in func[2]}
+        self.assertEqual(len(entries), 1)
+        [(cc, nc, tt, ct, callers)] = entries.values()
+        self.assertEqual((cc, nc), (4, 4))
+        self.assertEqual([func[2] for func in callers], ["f"])
+
 
 class TestCommandLine(unittest.TestCase):
     def test_sort(self):
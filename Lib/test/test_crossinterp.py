@@ -221,6 +221,7 @@ def ignore_byteswarning():
         *(o for o in BUILTIN_CONTAINERS if type(o) is memoryview),
         *(o for o in BUILTIN_CONTAINERS
           if type(o) is tuple and o not in TUPLES_WITHOUT_EQUALITY),
+        *(o for o in BUILTIN_CONTAINERS if type(o) is frozenset),
     ]
     _UNSHAREABLE_CONTAINERS = [o for o in BUILTIN_CONTAINERS
                                if o not in _SHAREABLE_CONTAINERS]
@@ -1334,6 +1335,27 @@ def test_tuple(self):
             ((1, 2), (3, 4), (5, 6)),
         ])
 
+    def test_frozenset(self):
+        self.assert_roundtrip_equal([
+            frozenset(),
+            frozenset([1]),
+            frozenset(["hello", "world"]),
+            frozenset([1, True, "hello", b"spam", 1.5]),
+        ])
+        # Test nesting
+        self.assert_roundtrip_equal([
+            frozenset([frozenset([1]), frozenset([2, 3])]),
+            frozenset([(1, 2), frozenset([(3,)])]),
+        ])
+
+    def test_frozensets_containing_non_shareable_types(self):
+        value = frozenset([0, 1.0, OBJECT])
+        with self.assertRaises(NotShareableError):
+            self.get_xidata(value)
+        value = frozenset([0, 1.0, (OBJECT,)])
+        with self.assertRaises(NotShareableError):
+            self.get_xidata(value)
+
     def test_tuples_containing_non_shareable_types(self):
         non_shareables = [
             EXCEPTION,
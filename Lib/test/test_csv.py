@@ -494,13 +494,25 @@ def test_read_bigfield(self):
             csv.field_size_limit(size)
             self._read_test([bigline], [[bigstring, bigstring]])
             self.assertEqual(csv.field_size_limit(), size)
+            quotedline = '"%s","%s"' % (bigstring, bigstring)
+            self._read_test([quotedline], [[bigstring, bigstring]])
             csv.field_size_limit(size-1)
             self.assertRaises(csv.Error, self._read_test, [bigline], [])
+            self.assertRaises(csv.Error, self._read_test, [quotedline], [])
             self.assertRaises(TypeError, csv.field_size_limit, None)
             self.assertRaises(TypeError, csv.field_size_limit, 1, None)
         finally:
             csv.field_size_limit(limit)
 
+    def test_read_max_field_size_limit(self):
+        limit = csv.field_size_limit(sys.maxsize)
+        try:
+            self._read_test(['abc,def'], [['abc', 'def']])
+            self._read_test(['"abc","def"'], [['abc', 'def']])
+            self.assertEqual(csv.field_size_limit(), sys.maxsize)
+        finally:
+            csv.field_size_limit(limit)
+
     def test_read_linenum(self):
         r = csv.reader(['line,1', 'line,2', 'line,3'])
         self.assertEqual(r.line_num, 0)
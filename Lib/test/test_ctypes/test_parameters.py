@@ -198,6 +198,32 @@ def from_param(cls, obj):
         # ArgumentError: argument 1: ValueError: 99
         self.assertRaises(ArgumentError, func, 99)
 
+    def test_simple_argtypes(self):
+        func = CDLL(_ctypes_test.__file__)._testfunc_d_bhilfd
+        func.restype = c_double
+        func.argtypes = (c_byte, c_short, c_int, c_long, c_float, c_double)
+        self.assertEqual(func(1, -2, 3, -4, 5.5, 6), 9.5)
+        self.assertEqual(func(True, 2, 3, 4, 5, 6.0), 21)
+        with self.assertRaisesRegex(ArgumentError, "argument 4: TypeError"):
+            func(1, 2, 3, 4.0, 5, 6)
+        with self.assertRaisesRegex(ArgumentError, "argument 6: TypeError"):
+            func(1, 2, 3, 4, 5, "6")
+
+        # from_param() overridden in a subclass is still called
+        class Doubled(c_int):
+            @classmethod
+            def from_param(cls, value):
+                return c_int(value * 2)
+
+        func.argtypes = (c_byte, c_short, Doubled, c_long, c_float, c_double)
+        self.assertEqual(func(1, 2, 3, 4, 5, 6), 24)
+
+        # without argtypes, int arguments are passed as C int
+        func = CDLL(_ctypes_test.__file__)._testfunc_i_bhilfd
+        self.assertEqual(func(1, -2, -3, 4, c_float(5), c_double(-6)), -1)
+        self.assertRaises(ArgumentError, func, 2**100, 0, 0, 0,
+                          c_float(0), c_double(0))
+
     def test_abstract(self):
         self.assertRaises(TypeError, Array.from_param, 42)
         self.assertRaises(TypeError, Structure.from_param, 42)
@@ -49,6 +49,28 @@ class C:
         o = C()
         self.assertEqual(len(fields(C)), 0)
 
+    def test_same_fields_in_different_classes(self):
+        # Classes with identical generated methods get their own functions
+        # and code objects, with their own defaults.
+        def make(default):
+            @dataclass
+            class C:
+                x: int
+                y: list = field(default_factory=lambda: [default])
+            return C
+
+        A, B = make(1), make(2)
+        self.assertEqual(A(0), A(0, [1]))
+        self.assertEqual(B(0), B(0, [2]))
+        self.assertNotEqual(A(0), B(0, [1]))
+        for name in '__init__', '__eq__':
+            with self.subTest(name=name):
+                a, b = getattr(A, name), getattr(B, name)
+                self.assertIsNot(a, b)
+                self.assertIsNot(a.__code__, b.__code__)
+                self.assertEqual(a.__code__.co_code, b.__code__.co_code)
+                self.assertEqual(a.__qualname__, A.__qualname__ + '.' + name)
+
     def test_one_field_no_default(self):
         @dataclass
         class C:
@@ -183,6 +183,19 @@ def __hash__(self):
         x.fail = True
         self.assertRaises(Exc, d.__getitem__, x)
 
+    def test_getitem_equal_int_keys(self):
+        # Keys that are equal to, but not the same object as, the stored ints
+        keys = [1000, -1000, 2**40, -2**40, -1, 2**61 - 1]
+        d = {k: str(k) for k in keys}
+        for k in keys:
+            k2 = int(str(k))
+            self.assertEqual(d[k2], str(k))
+            self.assertIn(k2, d)
+        # hash(-1) == hash(-2) and hash(2**61 - 1) == hash(0)
+        self.assertNotIn(int('-2'), d)
+        self.assertNotIn(0, d)
+        self.assertEqual(d[1000.0], '1000')
+
     def test_clear(self):
         d = {1:1, 2:2, 3:3}
         d.clear()
@@ -36,7 +36,7 @@
 else:
     ALLOCATOR_FOR_CONFIG = PYMEM_ALLOCATOR_MALLOC
 
-Py_STATS = hasattr(sys, '_stats_on')
+Py_STATS = bool(sysconfig.get_config_var('Py_STATS'))
 
 # _PyCoreConfig_InitCompatConfig()
 API_COMPAT = 1
@@ -582,6 +582,7 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
         'hash_seed': 0,
         'int_max_str_digits': sys.int_info.default_max_str_digits,
         'cpu_count': -1,
+        'type_cache_size': 4096,
         'faulthandler': False,
         'tracemalloc': 0,
         'perf_profiling': 0,
@@ -1045,6 +1046,7 @@ def test_init_from_config(self):
             'safe_path': True,
             'int_max_str_digits': 31337,
             'cpu_count': 4321,
+            'type_cache_size': 16384,
 
             'check_hash_pycs_mode': 'always',
             'pathconfig_warnings': False,
@@ -1791,6 +1793,11 @@ def test_initconfig_get_api(self):
     def test_initconfig_exit(self):
         self.run_embedded_interpreter("test_initconfig_exit")
 
+    def test_init_invalid_type_cache_size(self):
+        out, err = self.run_embedded_interpreter(
+            "test_init_invalid_type_cache_size")
+        self.assertEqual(out.rstrip(), "ok")
+
     def test_initconfig_module(self):
         self.run_embedded_interpreter("test_initconfig_module")
 
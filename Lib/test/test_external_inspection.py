@@ -842,6 +842,52 @@ async def main():
                 p.terminate()
                 p.wait(timeout=SHORT_TIMEOUT)
 
+    @skip_if_not_supported
+    @unittest.skipIf(
+        sys.platform == "linux" and not PROCESS_VM_READV_SUPPORTED,
+        "Test only runs on Linux with process_vm_readv support",
+    )
+    def test_async_large_awaited_by_set(self):
+        # The awaited_by set of the shared task spans several chunks of
+        # the set table read by the unwinder
+        script = textwrap.dedent(
+            """\
+            import asyncio
+
+            async def waiter(shared):
+                await shared
+
+            async def main():
+                shared = asyncio.create_task(asyncio.sleep(3600), name="shared")
+                waiters = [asyncio.create_task(waiter(shared))
+                           for _ in range(5000)]
+                await asyncio.sleep(0)
+                print("ready", flush=True)
+                await shared
+
+            asyncio.run(main())
+            """
+        )
+        p = subprocess.Popen([sys.executable, "-c", script],
+                             stdout=subprocess.PIPE, text=True)
+        try:
+            self.assertEqual(p.stdout.readline(), "ready\n")
+            try:
+                all_awaited_by = get_all_awaited_by(p.pid)
+            except PermissionError:
+                self.skipTest("Insufficient permissions to read the stack trace")
+        finally:
+            p.kill()
+            p.wait(timeout=SHORT_TIMEOUT)
+            p.stdout.close()
+
+        tasks = [task for _, tasks in all_awaited_by for task in tasks]
+        [shared] = [task for task in tasks if task.task_name == "shared"]
+        # the 5000 waiters and main()
+        self.assertEqual(len(shared.awaited_by), 5001)
+        funcnames = {coro.call_stack[0].funcname for coro in shared.awaited_by}
+        self.assertEqual(funcnames, {"waiter", "main"})
+
     @skip_if_not_supported
     @unittest.skipIf(
         sys.platform == "linux" and not PROCESS_VM_READV_SUPPORTED,
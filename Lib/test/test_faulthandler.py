@@ -695,6 +695,69 @@ def test_dump_traceback_later_fd(self):
     def test_dump_traceback_later_twice(self):
         self.check_dump_traceback_later(loops=2)
 
+    @threading_helper.requires_working_threading()
+    def test_slow_section(self):
+        code = dedent("""
+            import faulthandler
+            import threading
+            import time
+
+            def slow_function():
+                time.sleep(0.5)
+
+            # the deadline is not reached
+            faulthandler.start_slow_section(60.0)
+            assert faulthandler.end_slow_section() == 0
+            assert faulthandler.get_slow_tracebacks() == []
+
+            faulthandler.start_slow_section(0.05)
+            slow_function()
+            assert faulthandler.end_slow_section() == 1
+
+            # sections of other threads are independent
+            def other():
+                faulthandler.start_slow_section(60.0)
+                faulthandler.end_slow_section()
+            t = threading.Thread(target=other)
+            t.start()
+            t.join()
+
+            records = faulthandler.get_slow_tracebacks()
+            assert len(records) == 1, records
+            thread_id, elapsed, traceback = records[0]
+            assert thread_id == threading.get_ident()
+            assert elapsed >= 0.05, elapsed
+            assert 'in slow_function' in traceback, traceback
+            assert 'in <module>' in traceback, traceback
+
+            faulthandler.start_slow_section(0.05, repeat=True)
+            slow_function()
+            assert faulthandler.end_slow_section() >= 2
+            assert len(faulthandler.get_slow_tracebacks()) >= 3
+
+            faulthandler.clear_slow_tracebacks()
+            assert faulthandler.get_slow_tracebacks() == []
+            assert faulthandler.end_slow_section() == 0
+
+            # a thread exiting in a section is forgotten
+            def forgotten():
+                faulthandler.start_slow_section(0.05)
+            t = threading.Thread(target=forgotten)
+            t.start()
+            t.join()
+            time.sleep(0.2)
+            assert faulthandler.get_slow_tracebacks() == []
+
+            for timeout in (0, -1.0):
+                try:
+                    faulthandler.start_slow_section(timeout)
+                except ValueError:
+                    pass
+                else:
+                    raise AssertionError("ValueError not raised")
+        """)
+        script_helper.assert_python_ok('-c', code)
+
     @unittest.skipIf(not hasattr(faulthandler, "register"),
                      "need faulthandler.register")
     def check_register(self, filename=False, all_threads=False,
@@ -904,6 +904,47 @@ def test_short_repr(self):
             self.assertEqual(repr(float(s)), str(float(s)))
             self.assertEqual(repr(float(negs)), str(float(negs)))
 
+    @unittest.skipUnless(getattr(sys, 'float_repr_style', '') == 'short',
+                         "applies only when using short float repr style")
+    def test_short_repr_edge_cases(self):
+        test_values = [
+            (5e-324, '5e-324'),
+            (2.2250738585072014e-308, '2.2250738585072014e-308'),
+            (2.225073858507201e-308, '2.225073858507201e-308'),
+            (sys.float_info.max, '1.7976931348623157e+308'),
+            (2.0**-1022, '2.2250738585072014e-308'),
+            (2.0**-1074 * 3, '1.5e-323'),
+            (2.0**52, '4503599627370496.0'),
+            (2.0**53, '9007199254740992.0'),
+            (2.0**53 + 2, '9007199254740994.0'),
+            (2.0**54, '1.8014398509481984e+16'),
+            (2.0**60, '1.152921504606847e+18'),
+            (1e22, '1e+22'),
+            (1e23, '1e+23'),
+            (9007199254740991.0, '9007199254740991.0'),
+            (123456789012345680.0, '1.2345678901234568e+17'),
+            (0.3, '0.3'),
+            (2/3, '0.6666666666666666'),
+        ]
+        for value, s in test_values:
+            with self.subTest(s=s):
+                self.assertEqual(repr(value), s)
+                self.assertEqual(repr(-value), '-' + s)
+
+        # The repr is the shortest string that round-trips: rounding it
+        # to one digit less loses the value.
+        rng = random.Random(12345)
+        for _ in range(10000):
+            x = struct.unpack('<d', rng.randbytes(8))[0]
+            if not math.isfinite(x) or x == 0 or math.frexp(x)[0] == 0.5:
+                continue
+            s = repr(x)
+            self.assertEqual(float(s), x)
+            ndigits = len(s.split('e')[0].replace('-', '').replace('.', '')
+                          .strip('0'))
+            if ndigits > 1:
+                self.assertNotEqual(float('%.*e' % (ndigits - 2, x)), x, s)
+
 @support.requires_IEEE_754
 class RoundTestCase(unittest.TestCase, FloatsAreIdenticalMixin):
 
@@ -542,6 +542,29 @@ def test_manually_adding_non_string_keyword(self):
         with self.assertRaises(TypeError):
             p()
 
+    def test_keywords_without_call_keywords(self):
+        p = self.partial(capture, self.module.Placeholder, 1, a=10, b=20)
+        self.assertEqual(p(2), ((2, 1), {'a': 10, 'b': 20}))
+        self.assertEqual(p(2, 3), ((2, 1, 3), {'a': 10, 'b': 20}))
+        p.keywords['c'] = 30
+        self.assertEqual(p(2), ((2, 1), {'a': 10, 'b': 20, 'c': 30}))
+        del p.keywords['a'], p.keywords['b'], p.keywords['c']
+        self.assertEqual(p(2), ((2, 1), {}))
+
+        many = {f'k{i}': i for i in range(20)}
+        p = self.partial(capture, **many)
+        self.assertEqual(p(*range(10)), (tuple(range(10)), many))
+
+    def test_keywords_mutated_during_call(self):
+        def f(**kwargs):
+            p.keywords.clear()
+            return kwargs
+
+        value = object()
+        p = self.partial(f, a=value)
+        self.assertEqual(p(), {'a': value})
+        self.assertEqual(p(), {})
+
     def test_keystr_replaces_value(self):
         p = self.partial(capture)
 
@@ -1731,6 +1754,30 @@ def f(*args):
         self.assertEqual(f(1, 2), (1, 2))
         self.assertEqual(f((1, 2)), ((1, 2),))
 
+    def test_lru_single_scalar_arg(self):
+        for maxsize in None, 2:
+            @self.module.lru_cache(maxsize=maxsize)
+            def f(x):
+                return [x]
+
+            a = f(1)
+            self.assertIs(f(1), a)
+            self.assertEqual(f(True), [True])
+            self.assertEqual(f(1.0), [1.0])
+            self.assertIs(f('a'), f('a'))
+            self.assertEqual(f.cache_info()[:2], (3, 3))
+            self.assertIs(f(x=1), f(x=1))
+            self.assertRaises(TypeError, f, 1, 2)
+            self.assertRaises(TypeError, f)
+
+            @self.module.lru_cache(maxsize=maxsize, typed=True)
+            def g(x):
+                return [x]
+
+            self.assertIs(g(1), g(1))
+            self.assertEqual(g(1.0), [1.0])
+            self.assertEqual(g.cache_info()[:2], (1, 2))
+
     def test_lru_type_error(self):
         # Regression test for issue #28653.
         # lru_cache was leaking when one of the arguments
@@ -791,10 +791,12 @@ def test_get_stats(self):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "duration"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["duration"], 0)
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -810,6 +812,7 @@ def test_get_stats(self):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
+        self.assertGreaterEqual(new[2]["duration"], old[2]["duration"])
 
     def test_freeze(self):
         gc.freeze()
@@ -1214,6 +1217,11 @@ def test_collect(self):
             self.assertTrue("generation" in info)
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
+            self.assertTrue("duration" in info)
+            if v[1] == "start":
+                self.assertEqual(info["duration"], 0)
+            else:
+                self.assertGreaterEqual(info["duration"], 0)
 
     def test_collect_generation(self):
         self.preclean()
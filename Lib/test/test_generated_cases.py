@@ -1773,6 +1773,33 @@ def test_spilled_label(self):
         self.run_cases_test(input, output)
 
 
+    def test_cold_label(self):
+        input = """
+        cold label(one) {
+            goto two;
+        }
+
+        cold spilled label(two) {
+            RELOAD_STACK();
+            goto one;
+        }
+        """
+
+        output = """
+        COLD_LABEL(one)
+        {
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            JUMP_TO_LABEL(two);
+        }
+
+        COLD_LABEL(two)
+        {
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            JUMP_TO_LABEL(one);
+        }
+        """
+        self.run_cases_test(input, output)
+
     def test_incorrect_spills(self):
         input1 = """
         spilled label(one) {
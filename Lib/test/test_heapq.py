@@ -314,6 +314,31 @@ def test_heapsort_max(self):
             heap_sorted = [self.module.heappop_max(heap) for i in range(size)]
             self.assertEqual(heap_sorted, sorted(data, reverse=True))
 
+    def test_heapsort_numbers_and_tuples(self):
+        # Ints, floats and (priority, item) tuples must order exactly as
+        # with rich comparison, including big ints and ties.
+        def heapsort(data):
+            heap = data[:]
+            self.module.heapify(heap)
+            return [self.module.heappop(heap) for i in range(len(heap))]
+        big = 2**70
+        for data in [
+            [random.randrange(-big, big) for i in range(50)],
+            [random.randrange(-5, 5) * 2**62 for i in range(50)],
+            [random.uniform(-1e3, 1e3) for i in range(50)],
+            [(random.randrange(5), random.random()) for i in range(50)],
+            [(float(random.randrange(5)), [i]) for i in range(50)],
+            [(random.randrange(-big, big), str(i)) for i in range(50)],
+        ]:
+            self.assertEqual(heapsort(data), sorted(data))
+
+        # Equal priorities still compare the following items.
+        heap = [(1, 'b'), (1, None)]
+        self.assertRaises(TypeError, self.module.heapify, heap)
+        heap = [(1, 'b'), (2, None), (0, None)]
+        self.module.heapify(heap)
+        self.assertEqual(heap[0], (0, None))
+
     def test_merge(self):
         inputs = []
         for i in range(random.randrange(25)):
@@ -1,6 +1,7 @@
 import importlib
 import pickle
 import threading
+import time
 from textwrap import dedent
 import unittest
 
@@ -346,6 +347,40 @@ def test_get_timeout(self):
         with self.assertRaises(queues.QueueEmpty):
             queue.get(timeout=0.1)
 
+    def test_get_blocks_until_put(self):
+        queue = queues.create()
+        def f():
+            time.sleep(0.1)
+            queue.put('spam')
+        t = threading.Thread(target=f)
+        t.start()
+        obj = queue.get()
+        t.join()
+        self.assertEqual(obj, 'spam')
+
+    def test_put_blocks_until_get(self):
+        queue = queues.create(1)
+        queue.put(1)
+        def f():
+            time.sleep(0.1)
+            queue.get()
+        t = threading.Thread(target=f)
+        t.start()
+        queue.put(2)
+        t.join()
+        self.assertEqual(queue.get_nowait(), 2)
+
+    def test_blocked_get_when_destroyed(self):
+        queue = queues.create()
+        def f():
+            time.sleep(0.1)
+            _queues.destroy(queue.id)
+        t = threading.Thread(target=f)
+        t.start()
+        with self.assertRaises(queues.QueueNotFoundError):
+            queue.get()
+        t.join()
+
     def test_get_nowait(self):
         queue = queues.create()
         with self.assertRaises(queues.QueueEmpty):
@@ -199,6 +199,30 @@ def test_batched(self):
                         self.assertTrue(len(last_batch) <= n)
                         batches.append(last_batch)
 
+    def test_batched_sequences(self):
+        # Lists and tuples are read directly; the results must match
+        # those for a generic iterator.
+        data = list(range(10))
+        for seq in (data, tuple(data)):
+            for n in range(1, 12):
+                with self.subTest(type=type(seq), n=n):
+                    self.assertEqual(list(batched(seq, n)),
+                                     list(batched(iter(data), n)))
+
+        # The list may change between batches.
+        data = list(range(6))
+        b = batched(data, 2)
+        self.assertEqual(next(b), (0, 1))
+        data.append(6)
+        del data[2]
+        self.assertEqual(list(b), [(3, 4), (5, 6)])
+
+        # A partially consumed iterator is continued from its position.
+        it = iter(tuple(range(7)))
+        next(it)
+        self.assertEqual(list(batched(it, 3)), [(1, 2, 3), (4, 5, 6)])
+        self.assertEqual(list(it), [])
+
     def test_chain(self):
 
         def chain2(*iterables):
@@ -1113,6 +1137,28 @@ def test_starmap(self):
         self.assertRaises(ValueError, next, starmap(errfunc, [(4,5)]))
         self.assertRaises(TypeError, next, starmap(onearg, [(4,5)]))
 
+    def test_islice_sequences(self):
+        # The skipped items of lists and tuples are jumped over.
+        for seq in (list(range(20)), tuple(range(20))):
+            for args in [(5, None), (3, 20, 4), (25, None), (0, None, 7),
+                         (19, None, 3), (20, 30)]:
+                with self.subTest(type=type(seq), args=args):
+                    self.assertEqual(list(islice(seq, *args)),
+                                     list(islice(iter(range(20)), *args)))
+
+        data = list(range(10))
+        it = iter(data)
+        s = islice(it, 2, None, 3)
+        self.assertEqual(next(s), 2)
+        del data[3:]
+        data.extend('abcdefg')
+        self.assertEqual(list(s), ['c', 'f'])
+        self.assertEqual(list(it), [])
+
+        it = iter(tuple(range(10)))
+        self.assertEqual(list(islice(it, 20, None)), [])
+        self.assertEqual(list(it), [])
+
     def test_islice(self):
         for args in [          # islice(args) should agree with range(args)
                 (10, 20, 3),
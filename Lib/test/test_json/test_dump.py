@@ -38,6 +38,20 @@ def test_encode_truefalse(self):
                 {2: 3.0, 4.0: 5, False: 1, 6: True}, sort_keys=True),
                 '{"false": 1, "2": 3.0, "4.0": 5, "6": true}')
 
+    def test_repeated_keys(self):
+        class S(str):
+            pass
+        keys = ['a', 'caf\xe9', 'q"\\', S('s')] + [str(i) for i in range(2000)]
+        v = [{k: i for i, k in enumerate(keys)}] * 3
+        for ensure_ascii in (True, False):
+            s = self.dumps(v, ensure_ascii=ensure_ascii)
+            self.assertEqual(self.json.loads(s), v)
+        self.assertEqual(self.dumps([{'\xe9': 1}, {'\xe9': 2}]),
+                         '[{"\\u00e9": 1}, {"\\u00e9": 2}]')
+        self.assertEqual(self.dumps([{'\xe9': 1}, {'\xe9': 2}],
+                                    ensure_ascii=False),
+                         '[{"\xe9": 1}, {"\xe9": 2}]')
+
     # Issue 16228: Crash on encoding resized list
     def test_encode_mutated(self):
         a = [object()] * 10
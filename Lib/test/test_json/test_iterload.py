@@ -0,0 +1,81 @@
+from io import BytesIO, StringIO
+from test.test_json import PyTest, CTest
+
+
+DOCS = [
+    '[]',
+    ' [ ] ',
+    '[1]',
+    '\n[\n 1 ,\n 2\n]\n',
+    '[1.5e+10, -0.25, 1E-3, 123456789012345678901234567890]',
+    '[true, false, null, -Infinity, Infinity]',
+    '["a\\u00e9\\ud83d\\ude00b", "x\\"y\\\\", "€"]',
+    '[{"a": [1, {"b": null}], "c": "d"}, [[[]]], {}]',
+]
+
+
+class TestIterload:
+    def iterload(self, s, **kw):
+        return list(self.json.iterload(StringIO(s), **kw))
+
+    def test_elements(self):
+        for doc in DOCS:
+            expected = self.loads(doc)
+            for chunk_size in (1, 2, 3, 7, 65536):
+                with self.subTest(doc=doc, chunk_size=chunk_size):
+                    self.assertEqual(self.iterload(doc, chunk_size=chunk_size),
+                                     expected)
+
+    def test_bytes(self):
+        for doc in DOCS:
+            expected = self.loads(doc)
+            for encoding in ('utf-8', 'utf-8-sig', 'utf-16', 'utf-16-be',
+                             'utf-32', 'utf-32-le'):
+                for chunk_size in (1, 5, 65536):
+                    with self.subTest(doc=doc, encoding=encoding,
+                                      chunk_size=chunk_size):
+                        fp = BytesIO(doc.encode(encoding))
+                        result = list(self.json.iterload(
+                            fp, chunk_size=chunk_size))
+                        self.assertEqual(result, expected)
+
+    def test_lazy(self):
+        fp = StringIO('[1, 2, ' + ' ' * 1000 + '3]')
+        it = self.json.iterload(fp, chunk_size=10)
+        self.assertEqual(next(it), 1)
+        self.assertLess(fp.tell(), 100)
+        self.assertEqual(list(it), [2, 3])
+
+    def test_hooks(self):
+        doc = '[{"a": 1.5}, {"b": 2}]'
+        self.assertEqual(
+            self.iterload(doc, object_pairs_hook=tuple, parse_float=str,
+                          chunk_size=3),
+            [(('a', '1.5'),), (('b', 2),)])
+
+    def test_invalid(self):
+        for doc in ['', '1', '{}', '[', '[1', '[1,]', '[1 2]', '[1]x',
+                    '[tru]', '[1,,2]', '["abc]', '[1] [2]', '[{"a" 1}]']:
+            for chunk_size in (1, 3, 65536):
+                with self.subTest(doc=doc, chunk_size=chunk_size):
+                    with self.assertRaises(self.JSONDecodeError):
+                        self.iterload(doc, chunk_size=chunk_size)
+
+    def test_elements_before_error(self):
+        it = self.json.iterload(StringIO('[1, 2, x]'))
+        self.assertEqual(next(it), 1)
+        self.assertEqual(next(it), 2)
+        with self.assertRaises(self.JSONDecodeError):
+            next(it)
+
+    def test_invalid_arguments(self):
+        with self.assertRaises(TypeError):
+            self.json.iterload(StringIO('[]'), chunk_size=None)
+        with self.assertRaises(ValueError):
+            self.json.iterload(StringIO('[]'), chunk_size=0)
+        with self.assertRaises(self.JSONDecodeError):
+            self.json.iterload(StringIO('\ufeff[]'))
+
+
+class TestPyIterload(TestIterload, PyTest): pass
+class TestCIterload(TestIterload, CTest): pass
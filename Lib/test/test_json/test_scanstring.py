@@ -101,6 +101,25 @@ def assertScan(given, expect):
         assertScan('"z\ud834\\udd20x"', 'z\ud834\udd20x')
         assertScan('"z\ud834x"', 'z\ud834x')
 
+    def test_long_strings(self):
+        # Exercise every position of the special character relative to
+        # the word-at-a-time scan.
+        scanstring = self.json.decoder.scanstring
+        for n in range(40):
+            plain = 'x\x7f\xe9' * n
+            for i in range(len(plain) + 1):
+                head, tail = plain[:i], plain[i:]
+                self.assertEqual(
+                    scanstring(f'"{head}\\n{tail}"', 1, True),
+                    (f'{head}\n{tail}', len(plain) + 4))
+                self.assertEqual(
+                    scanstring(f'"{head}\t{tail}"', 1, False),
+                    (f'{head}\t{tail}', len(plain) + 3))
+                with self.assertRaises(self.JSONDecodeError):
+                    scanstring(f'"{head}\t{tail}"', 1, True)
+            with self.assertRaises(self.JSONDecodeError):
+                scanstring(f'"{plain}', 1, True)
+
     def test_bad_escapes(self):
         scanstring = self.json.decoder.scanstring
         bad_escapes = [
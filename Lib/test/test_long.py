@@ -12,6 +12,7 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 300      # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +230,36 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom3(self):
+        # Compare with products of pieces small enough for Karatsuba.
+        def mul_by_pieces(a, b):
+            width = KARATSUBA_CUTOFF * 2 * SHIFT
+            mask = (1 << width) - 1
+            result = 0
+            shift = 0
+            while a:
+                result += (a & mask) * b << shift
+                a >>= width
+                shift += width
+            return result
+
+        sizes = [TOOM3_CUTOFF + 1, TOOM3_CUTOFF + 2, TOOM3_CUTOFF * 3 + 1,
+                 TOOM3_CUTOFF * 10]
+        for adigits in sizes:
+            for bdigits in (adigits, adigits + 1, adigits * 3 // 2,
+                            adigits * 2 - 1):
+                abits = adigits * SHIFT
+                bbits = bdigits * SHIFT
+                with self.subTest(adigits=adigits, bdigits=bdigits):
+                    for a, b in [(random.getrandbits(abits) | 1 << (abits - 1),
+                                  random.getrandbits(bbits) | 1 << (bbits - 1)),
+                                 ((1 << abits) - 1, (1 << bbits) - 1)]:
+                        expected = mul_by_pieces(a, b)
+                        self.assertEqual(a * b, expected)
+                        self.assertEqual(-a * b, -expected)
+                        self.assertEqual(-a * -b, expected)
+                        self.assertEqual(a * a, mul_by_pieces(a, a))
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
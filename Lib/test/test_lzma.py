@@ -17,6 +17,13 @@
 lzma = import_module("lzma")
 from lzma import LZMACompressor, LZMADecompressor, LZMAError, LZMAFile
 
+try:
+    LZMACompressor(threads=2)
+except ValueError:
+    requires_mt_encoder = unittest.skip("liblzma has no multi-threaded encoder")
+else:
+    requires_mt_encoder = lambda test: test
+
 
 class CompressorDecompressorTestCase(unittest.TestCase):
 
@@ -33,6 +40,16 @@ def test_simple_bad_args(self):
         # Can't specify a preset and a custom filter chain at the same time.
         with self.assertRaises(ValueError):
             LZMACompressor(preset=7, filters=[{"id": lzma.FILTER_LZMA2}])
+        self.assertRaises(TypeError, LZMACompressor, threads=1.5)
+        self.assertRaises(ValueError, LZMACompressor, threads=-1)
+        # threads is keyword-only.
+        self.assertRaises(TypeError, LZMACompressor,
+                          lzma.FORMAT_XZ, -1, None, None, 2)
+        # Only FORMAT_XZ supports multi-threaded compression.
+        with self.assertRaises(ValueError):
+            LZMACompressor(lzma.FORMAT_ALONE, threads=2)
+        with self.assertRaises(ValueError):
+            LZMACompressor(lzma.FORMAT_RAW, filters=FILTERS_RAW_1, threads=2)
 
         self.assertRaises(TypeError, LZMADecompressor, ())
         self.assertRaises(TypeError, LZMADecompressor, memlimit=b"qw")
@@ -281,6 +298,21 @@ def test_roundtrip_xz(self):
         lzd = LZMADecompressor()
         self._test_decompressor(lzd, cdata, lzma.CHECK_CRC64)
 
+    @requires_mt_encoder
+    def test_roundtrip_xz_threads(self):
+        for threads in (0, 2):
+            with self.subTest(threads=threads):
+                lzc = LZMACompressor(threads=threads)
+                cdata = lzc.compress(INPUT) + lzc.flush()
+                lzd = LZMADecompressor()
+                self._test_decompressor(lzd, cdata, lzma.CHECK_CRC64)
+
+                lzc = LZMACompressor(check=lzma.CHECK_CRC32,
+                                     filters=FILTERS_RAW_4, threads=threads)
+                cdata = lzc.compress(INPUT) + lzc.flush()
+                lzd = LZMADecompressor()
+                self._test_decompressor(lzd, cdata, lzma.CHECK_CRC32)
+
     def test_roundtrip_alone(self):
         lzc = LZMACompressor(lzma.FORMAT_ALONE)
         cdata = lzc.compress(INPUT) + lzc.flush()
@@ -398,6 +430,8 @@ def test_bad_args(self):
         # Can't specify a preset and a custom filter chain at the same time.
         with self.assertRaises(ValueError):
             lzma.compress(b"", preset=3, filters=[{"id": lzma.FILTER_LZMA2}])
+        with self.assertRaises(ValueError):
+            lzma.compress(b"", format=lzma.FORMAT_ALONE, threads=2)
 
         self.assertRaises(TypeError, lzma.decompress)
         self.assertRaises(TypeError, lzma.decompress, [])
@@ -502,6 +536,12 @@ def test_roundtrip(self):
         ddata = lzma.decompress(cdata, lzma.FORMAT_RAW, filters=FILTERS_RAW_4)
         self.assertEqual(ddata, INPUT)
 
+    @requires_mt_encoder
+    def test_roundtrip_threads(self):
+        cdata = lzma.compress(INPUT, threads=2)
+        ddata = lzma.decompress(cdata)
+        self.assertEqual(ddata, INPUT)
+
     # Unlike LZMADecompressor, decompress() *does* handle concatenated streams.
 
     def test_decompress_multistream(self):
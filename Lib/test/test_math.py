@@ -4,6 +4,7 @@
 from test.support import verbose, requires_IEEE_754
 from test import support
 import unittest
+import array
 import fractions
 import itertools
 import decimal
@@ -1411,6 +1412,54 @@ def test_sumprod_accuracy(self):
         self.assertEqual(sumprod([True, False] * 10, [0.1] * 20), 1.0)
         self.assertEqual(sumprod([1.0, 10E100, 1.0, -10E100], [1.0]*4), 2.0)
 
+    def test_double_buffers(self):
+        # fsum(), sumprod() and dist() read arrays and memoryviews of
+        # doubles directly; the results must match iterating over them.
+        inf, nan = math.inf, math.nan
+        cases = [
+            [], [1.0], [0.1] * 10, [1e100, 1.0, -1e100, 1e-100],
+            [1e308, 1e308, -1e308], [inf, 1.0], [inf, -inf], [nan, 2.0],
+            [-0.0, -0.0], [1e308, -1e308, 1e308, 2.0],
+        ]
+        for p in cases:
+            for q in cases:
+                for func in math.sumprod, math.dist:
+                    if func is math.dist and len(p) != len(q):
+                        continue
+                    args = [(p, q),
+                            (array.array('d', p), array.array('d', q)),
+                            (memoryview(array.array('d', p)), q)]
+                    if len(p) == len(q):
+                        padded = [v for x in p for v in (x, 0.0)]
+                        args.append((memoryview(array.array('d', padded))[::2],
+                                     memoryview(array.array('d', q))))
+                    results = []
+                    for x, y in args:
+                        try:
+                            results.append(repr(func(x, y)))
+                        except (ValueError, OverflowError) as exc:
+                            results.append(type(exc))
+                    self.assertEqual(results, [results[0]] * len(args),
+                                     (func, p, q))
+            results = []
+            for x in p, array.array('d', p), memoryview(array.array('d', p)):
+                try:
+                    results.append(repr(math.fsum(x)))
+                except (ValueError, OverflowError) as exc:
+                    results.append(type(exc))
+            self.assertEqual(results, [results[0]] * 3, p)
+
+        # Other formats and overridden iteration are not bypassed.
+        self.assertEqual(math.fsum(array.array('f', [0.5, 1.5])), 2.0)
+        self.assertEqual(math.fsum(memoryview(b'\x01\x02')), 3.0)
+        class A(array.array):
+            def __iter__(self):
+                return iter([1.0])
+        self.assertEqual(math.fsum(A('d', [2.0, 3.0])), 1.0)
+        class B(array.array):
+            pass
+        self.assertEqual(math.fsum(B('d', [2.0, 3.0])), 5.0)
+
     @support.requires_resource('cpu')
     def test_sumprod_stress(self):
         sumprod = math.sumprod
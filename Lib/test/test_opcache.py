@@ -560,6 +560,39 @@ def instantiate():
         with self.assertRaises(TypeError):
             instantiate()
 
+    @cpython_only
+    @requires_specialization_ft
+    def test_call_kw_builtin_fast_with_keywords(self):
+        @reset_code
+        def call_sorted(n):
+            for _ in range(n):
+                self.assertEqual(sorted([1, 3, 2], reverse=True), [3, 2, 1])
+
+        call_sorted(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+        self.assert_specialized(call_sorted, "CALL_KW_BUILTIN_FAST_WITH_KEYWORDS")
+        self.assert_no_opcode(call_sorted, "CALL_KW_NON_PY")
+
+        with self.assertRaisesRegex(TypeError, "unexpected keyword argument 'spam'"):
+            sorted([], spam=1)
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_call_kw_method_descriptor_fast_with_keywords(self):
+        @reset_code
+        def call_split(n):
+            for _ in range(n):
+                self.assertEqual('a,b,c'.split(',', maxsplit=1), ['a', 'b,c'])
+
+        call_split(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+        self.assert_specialized(call_split,
+                                "CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS")
+        self.assert_no_opcode(call_split, "CALL_KW_NON_PY")
+
+        with self.assertRaisesRegex(TypeError, "argument for .* given by name"):
+            'a,b'.split(',', sep=',')
+        with self.assertRaisesRegex(TypeError, "Did you mean 'sep'"):
+            'a,b'.split(sep2=',')
+
     def test_recursion_check_for_general_calls(self):
         def test(default=None):
             return test()
@@ -1440,6 +1473,25 @@ def binary_op_bitwise_extend():
         self.assert_specialized(binary_op_bitwise_extend, "BINARY_OP_EXTEND")
         self.assert_no_opcode(binary_op_bitwise_extend, "BINARY_OP")
 
+        def binary_op_add_float():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a, b, c = 1.5, 2.0, 4.0
+                # The temporary (a + b) may be reused for the result,
+                # but the operands held in locals must not change.
+                d = (a + b) * c
+                e = c - (a * b)
+                self.assertEqual(d, 14.0)
+                self.assertEqual(e, 1.0)
+                self.assertEqual((a, b, c), (1.5, 2.0, 4.0))
+                x = a + b
+                y = x + x
+                self.assertEqual((x, y), (3.5, 7.0))
+
+        binary_op_add_float()
+        self.assert_specialized(binary_op_add_float, "BINARY_OP_ADD_FLOAT")
+        self.assert_specialized(binary_op_add_float, "BINARY_OP_MULTIPLY_FLOAT")
+        self.assert_specialized(binary_op_add_float, "BINARY_OP_SUBTRACT_FLOAT")
+
     @cpython_only
     @requires_specialization_ft
     def test_load_super_attr(self):
@@ -1587,6 +1639,50 @@ def set_value(n):
         set_value(_testinternalcapi.SPECIALIZATION_COOLDOWN)
         self.assert_no_opcode(set_value, "STORE_ATTR_INSTANCE_VALUE")
 
+    @cpython_only
+    @requires_specialization_ft
+    def test_load_attr_instance_value_poly(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+                self.y = 2
+
+        class B:
+            def __init__(self):
+                self.y = 3
+                self.x = 4
+
+        class C:
+            def __init__(self):
+                self.z = 5
+                self.x = 6
+
+        @reset_code
+        def get_values(items):
+            total = 0
+            for item in items:
+                total += item.x
+            return total
+
+        n = (_testinternalcapi.SPECIALIZATION_THRESHOLD
+             + _testinternalcapi.SPECIALIZATION_COOLDOWN)
+        self.assertEqual(get_values([A()] * n), n)
+        self.assert_specialized(get_values, "LOAD_ATTR_INSTANCE_VALUE")
+        self.assert_no_opcode(get_values, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+
+        # A second type keeps both entries instead of replacing the first.
+        items = [A(), B()] * n
+        self.assertEqual(get_values(items), 5 * n)
+        self.assert_specialized(get_values, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assertEqual(get_values(items), 5 * n)
+        self.assert_specialized(get_values, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+
+        # A third type evicts the least recently cached one.
+        items = [C(), A()] * n
+        self.assertEqual(get_values(items), 7 * n)
+        self.assert_specialized(get_values, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assertEqual(get_values([B(), C()] * n), 10 * n)
+
     @cpython_only
     @requires_specialization_ft
     def test_store_attr_with_hint(self):
@@ -1777,6 +1873,37 @@ def __getitem__(self, item):
         self.assert_specialized(binary_subscr_getitems, "BINARY_OP_SUBSCR_GETITEM")
         self.assert_no_opcode(binary_subscr_getitems, "BINARY_OP")
 
+    @cpython_only
+    @requires_specialization_ft
+    def test_store_subscr(self):
+        class C:
+            def __init__(self):
+                self.data = {}
+            def __setitem__(self, key, value):
+                self.data[key] = value
+
+        @reset_code
+        def store_subscr_py_setitem(c, n):
+            for i in range(n):
+                c["key"] = i
+
+        c = C()
+        n = _testinternalcapi.SPECIALIZATION_THRESHOLD
+        store_subscr_py_setitem(c, n)
+        self.assertEqual(c.data, {"key": n - 1})
+        self.assert_specialized(store_subscr_py_setitem, "STORE_SUBSCR_PY_SETITEM")
+        self.assert_no_opcode(store_subscr_py_setitem, "STORE_SUBSCR")
+
+        # Replacing __setitem__ must be seen straight away.
+        C.__setitem__ = lambda self, key, value: self.data.__setitem__(key, -value)
+        n = _testinternalcapi.SPECIALIZATION_COOLDOWN
+        store_subscr_py_setitem(c, n)
+        self.assertEqual(c.data, {"key": 1 - n})
+
+        del C.__setitem__
+        with self.assertRaises(TypeError):
+            store_subscr_py_setitem(c, 1)
+
     @cpython_only
     @requires_specialization_ft
     def test_compare_op(self):
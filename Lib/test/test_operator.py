@@ -470,6 +470,12 @@ class T(tuple):
         self.assertEqual(operator.itemgetter(0)(T('abc')), 'a')
         self.assertEqual(operator.itemgetter(0)(['a', 'b', 'c']), 'a')
         self.assertEqual(operator.itemgetter(0)(range(100, 200)), 100)
+        class L(list):
+            'List subclass'
+            def __getitem__(self, index):
+                return 'x'
+        self.assertEqual(operator.itemgetter(0)(L('abc')), 'x')
+        self.assertRaises(IndexError, operator.itemgetter(3), ['a', 'b', 'c'])
 
     def test_methodcaller(self):
         operator = self.module
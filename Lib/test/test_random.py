@@ -824,6 +824,16 @@ def test_getrandbits(self):
         self.assertEqual(self.gen.getrandbits(MyIndex(100)),
                          97904845777343510404718956115)
 
+        # Results are built from consecutive 32-bit outputs, least
+        # significant word first, whatever the number of bits.
+        for k in 33, 48, 63, 64, 65, 100, 1000, 1024:
+            self.gen.seed(k)
+            words = [self.gen.getrandbits(32) for i in range((k + 31) // 32)]
+            expected = sum(w << (32 * i) for i, w in enumerate(words[:-1]))
+            expected |= (words[-1] >> (-k % 32)) << (32 * (len(words) - 1))
+            self.gen.seed(k)
+            self.assertEqual(self.gen.getrandbits(k), expected)
+
     def test_getrandbits_2G_bits(self):
         size = 2**31
         self.gen.seed(1234567)
@@ -124,6 +124,9 @@ def test_basic_re_sub(self):
         self.assertTypedEqual(re.sub(b'y', memoryview(b'a'), memoryview(b'xyz')), b'xaz')
         for y in ("\xe0", "\u0430", "\U0001d49c"):
             self.assertEqual(re.sub(y, 'a', 'x%sz' % y), 'xaz')
+            self.assertEqual(re.sub('a', y, 'xaza'), 'x%sz%s' % (y, y))
+        self.assertEqual(re.sub('a', '', 'xaza'), 'xz')
+        self.assertEqual(re.subn('a', 'bc', 'aaxa'), ('bcbcxbc', 3))
 
         self.assertEqual(re.sub("(?i)b+", "x", "bbbb BBBB"), 'x x')
         self.assertEqual(re.sub(r'\d+', self.bump_num, '08.2 -2 23x99y'),
@@ -2482,6 +2485,48 @@ def test_search_anchor_at_beginning(self):
         # With optimization -- 0.0003 seconds.
         self.assertLess(stopwatch.seconds, 0.1)
 
+    def test_search_prefix_after_assertion(self):
+        # The literal or charset prefix is looked for past leading
+        # zero-width assertions.
+        s = 'warning: warn, fatal error. xerror'
+        self.assertEqual(re.findall(r'\b(?:error|warn|fatal)\b', s),
+                         ['warn', 'fatal', 'error'])
+        self.assertEqual(re.findall(r'\berror', s), ['error'])
+        self.assertEqual(re.findall(r'\Berror', s), ['error'])
+        self.assertEqual([m.span() for m in re.finditer(r'\Berror', s)],
+                         [(29, 34)])
+        self.assertEqual(re.search(r'\b(fa)tal', s).span(1), (15, 17))
+        self.assertEqual(re.findall(rb'\b[fw]\w+', s.encode()),
+                         [b'warning', b'warn', b'fatal'])
+        self.assertEqual(re.findall(r'(?m)^ab', 'ab\nxab\nab'), ['ab', 'ab'])
+        self.assertEqual(re.findall(r'^ab', 'ab\nxab\nab'), ['ab'])
+        self.assertEqual(re.findall(r'$\n', 'ab\n'), ['\n'])
+        self.assertEqual(re.findall(r'(?m)$\nx', 'ab\nxy\nx'), ['\nx', '\nx'])
+        self.assertIsNone(re.search(r'\bb', 'ab'))
+
+    def test_search_required_literal(self):
+        s = 'user=bob id=12 took 7 ms; id=3 took 150 ms'
+        self.assertEqual(re.findall(r'\d+ ms', s), ['7 ms', '150 ms'])
+        self.assertEqual(re.findall(r'\w+=\d+', s), ['id=12', 'id=3'])
+        self.assertEqual(re.findall(r'(\w+)=(\w+)', s),
+                         [('user', 'bob'), ('id', '12'), ('id', '3')])
+        self.assertEqual(re.search(r'.*took', s).span(), (0, 35))
+        self.assertEqual(re.search(r'.*?took', s).span(), (0, 19))
+        self.assertEqual(re.search(r'\w*ok', s).span(), (15, 19))
+        self.assertIsNone(re.search(r'[a-z]+ms', s))
+        p = re.compile(r'\d+ ms')
+        self.assertEqual(p.search(s, 22).span(), (36, 42))
+        self.assertIsNone(p.search(s, 22, 41))
+        self.assertEqual(p.search(s, 22, 42).span(), (36, 42))
+        self.assertEqual(re.findall(rb'\w+@ex\.com', b'a@ex.co b@ex.com'),
+                         [b'b@ex.com'])
+        self.assertIsNone(re.search('\\w+\u0100x', 'abc\u0100'))
+        self.assertEqual(re.search('\\w+\u0100x', 'abc\u0100x').span(),
+                         (0, 5))
+        # An empty match is not allowed where the previous one ended.
+        self.assertEqual(re.findall(r'a*', 'baac'), ['', 'aa', '', ''])
+        self.assertEqual(re.sub(r'x*', '-', 'abxd'), '-a-b--d-')
+
     def test_possessive_quantifiers(self):
         """Test Possessive Quantifiers
         Test quantifiers of the form @+ for some repetition operator @,
@@ -2791,6 +2836,31 @@ def test_possesive_repeat_one(self):
  9.   LITERAL 0x61 ('a')
 11.   SUCCESS
 12: SUCCESS
+''')
+
+    def test_required_literal(self):
+        self.assertEqual(get_debug_out(r'\d+: ok'), '''\
+MAX_REPEAT 1 MAXREPEAT
+  IN
+    CATEGORY CATEGORY_DIGIT
+LITERAL 58
+LITERAL 32
+LITERAL 111
+LITERAL 107
+
+ 0. INFO 10 0b1000 5 MAXREPEAT (to 11)
+      required_offset 1
+      required [0x3a, 0x20, 0x6f, 0x6b] (': ok')
+11: REPEAT_ONE 9 1 MAXREPEAT (to 21)
+15.   IN 4 (to 20)
+17.     CATEGORY UNI_DIGIT
+19.     FAILURE
+20:   SUCCESS
+21: LITERAL 0x3a (':')
+23. LITERAL 0x20 (' ')
+25. LITERAL 0x6f ('o')
+27. LITERAL 0x6b ('k')
+29. SUCCESS
 ''')
 
     def test_possesive_repeat(self):
@@ -0,0 +1,223 @@
+"""Tests for the sampling profiler (profile.sample)."""
+
+import contextlib
+import io
+import marshal
+import os
+import subprocess
+import sys
+import tempfile
+import textwrap
+import time
+import unittest
+from unittest import mock
+
+from test.support import SHORT_TIMEOUT, requires_subprocess
+
+try:
+    import _remote_debugging  # noqa: F401
+    import profile.sample
+    from profile.pstats_collector import PstatsCollector
+    from profile.stack_collector import CollapsedStackCollector
+except ImportError:
+    raise unittest.SkipTest(
+        "Test only runs when _remote_debugging is available"
+    )
+
+import pstats
+
+
+skip_if_not_supported = unittest.skipIf(
+    (
+        sys.platform != "darwin"
+        and sys.platform != "linux"
+        and sys.platform != "win32"
+    ),
+    "Test only runs on Linux, Windows and MacOS",
+)
+
+
+class TestCollectors(unittest.TestCase):
+
+    def test_pstats_collector(self):
+        collector = PstatsCollector(sample_interval_usec=1000)
+        # frames are most recent first
+        collector.collect([
+            (1, [("a.py", 10, "leaf"), ("a.py", 5, "main")]),
+            (2, [("a.py", 5, "main")]),
+            (3, []),
+        ])
+        collector.collect([
+            (1, [("a.py", 10, "leaf"), ("a.py", 10, "leaf"),
+                 ("a.py", 5, "main")]),
+        ])
+        collector.create_stats()
+        leaf = ("a.py", 10, "leaf")
+        main = ("a.py", 5, "main")
+        self.assertEqual(set(collector.stats), {leaf, main})
+
+        cc, nc, tt, ct, callers = collector.stats[leaf]
+        self.assertEqual((cc, nc), (2, 2))
+        self.assertAlmostEqual(tt, 0.002)
+        self.assertAlmostEqual(ct, 0.002)
+        self.assertEqual(set(callers), {leaf, main})
+        self.assertEqual(callers[main][0], 2)
+        self.assertEqual(callers[leaf][0], 1)
+
+        cc, nc, tt, ct, callers = collector.stats[main]
+        self.assertEqual((cc, nc), (3, 3))
+        self.assertAlmostEqual(tt, 0.001)
+        self.assertAlmostEqual(ct, 0.003)
+        self.assertEqual(callers, {})
+
+        # The statistics can be loaded by pstats
+        stats = pstats.Stats(collector)
+        self.assertEqual(stats.total_calls, 5)
+        with tempfile.TemporaryDirectory() as tmpdir:
+            filename = os.path.join(tmpdir, "profile.pstats")
+            collector.export(filename)
+            with open(filename, "rb") as f:
+                self.assertEqual(marshal.load(f), collector.stats)
+            self.assertEqual(pstats.Stats(filename).stats, stats.stats)
+
+    def test_collapsed_stack_collector(self):
+        collector = CollapsedStackCollector()
+        for _ in range(3):
+            collector.collect([
+                (1, [("a.py", 10, "leaf"), ("a.py", 5, "main")]),
+            ])
+        collector.collect([(1, [("a.py", 5, "main")]), (2, [])])
+        with tempfile.TemporaryDirectory() as tmpdir:
+            filename = os.path.join(tmpdir, "collapsed.txt")
+            collector.export(filename)
+            with open(filename, encoding="utf-8") as f:
+                lines = sorted(f.read().splitlines())
+        self.assertEqual(lines, [
+            "a.py:main:5 1",
+            "a.py:main:5;a.py:leaf:10 3",
+        ])
+
+    def test_cli_arguments(self):
+        argv = ["profile.sample", "-i", "500", "-d", "2", "-a",
+                "--collapsed", "-o", "out.txt", "1234"]
+        with (mock.patch("sys.argv", argv),
+              mock.patch("profile.sample.sample") as sample):
+            profile.sample.main()
+        sample.assert_called_once_with(
+            1234,
+            sample_interval_usec=500,
+            duration_sec=2,
+            filename="out.txt",
+            all_threads=True,
+            limit=15,
+            sort="cumulative",
+            output_format="collapsed",
+        )
+
+        argv = ["profile.sample", "--collapsed", "--sort", "name", "1234"]
+        with (mock.patch("sys.argv", argv),
+              mock.patch("sys.stderr", io.StringIO()),
+              mock.patch("profile.sample.sample") as sample):
+            with self.assertRaises(SystemExit):
+                profile.sample.main()
+        sample.assert_not_called()
+
+
+@requires_subprocess()
+@skip_if_not_supported
+@unittest.skipIf(
+    sys.platform == "linux"
+    and not _remote_debugging.PROCESS_VM_READV_SUPPORTED,
+    "Test only runs on Linux with process_vm_readv support",
+)
+class TestSampleProfiler(unittest.TestCase):
+
+    @contextlib.contextmanager
+    def busy_process(self):
+        script = textwrap.dedent("""\
+            import sys
+
+            def slow_fibonacci(n):
+                if n <= 1:
+                    return n
+                return slow_fibonacci(n - 1) + slow_fibonacci(n - 2)
+
+            def main_loop():
+                while True:
+                    slow_fibonacci(20)
+
+            print("ready", flush=True)
+            main_loop()
+            """)
+        proc = subprocess.Popen([sys.executable, "-c", script],
+                                stdout=subprocess.PIPE, text=True)
+        try:
+            self.assertEqual(proc.stdout.readline(), "ready\n")
+            yield proc
+        finally:
+            proc.kill()
+            proc.wait(SHORT_TIMEOUT)
+            proc.stdout.close()
+
+    def test_sample_collapsed(self):
+        with (self.busy_process() as proc,
+              tempfile.TemporaryDirectory() as tmpdir):
+            filename = os.path.join(tmpdir, "collapsed.txt")
+            try:
+                with contextlib.redirect_stdout(io.StringIO()) as output:
+                    profile.sample.sample(
+                        proc.pid,
+                        sample_interval_usec=1000,
+                        duration_sec=0.5,
+                        filename=filename,
+                        output_format="collapsed",
+                    )
+            except PermissionError:
+                self.skipTest("Insufficient permissions to read the process")
+            self.assertIn("Captured", output.getvalue())
+            with open(filename, encoding="utf-8") as f:
+                content = f.read()
+        self.assertIn("main_loop", content)
+        self.assertIn("slow_fibonacci", content)
+
+    def test_sample_pstats(self):
+        with self.busy_process() as proc:
+            try:
+                with contextlib.redirect_stdout(io.StringIO()) as output:
+                    profile.sample.sample(
+                        proc.pid,
+                        sample_interval_usec=1000,
+                        duration_sec=0.5,
+                        limit=5,
+                        sort="tottime",
+                    )
+            except PermissionError:
+                self.skipTest("Insufficient permissions to read the process")
+        output = output.getvalue()
+        self.assertIn("Captured", output)
+        self.assertIn("slow_fibonacci", output)
+
+    def test_process_exits(self):
+        proc = subprocess.Popen([sys.executable, "-c",
+                                 "import time; print(flush=True); "
+                                 "time.sleep(0.2)"],
+                                stdout=subprocess.PIPE)
+        with proc:
+            proc.stdout.readline()
+            try:
+                profiler = profile.sample.SampleProfiler(
+                    proc.pid, 1000, all_threads=True)
+            except PermissionError:
+                self.skipTest("Insufficient permissions to read the process")
+            collector = CollapsedStackCollector()
+            start = time.monotonic()
+            with contextlib.redirect_stdout(io.StringIO()):
+                profiler.sample(collector, duration_sec=SHORT_TIMEOUT)
+            # Sampling stops when the process exits, well before the
+            # duration.  The process may not have been reaped yet.
+            self.assertLess(time.monotonic() - start, SHORT_TIMEOUT / 2)
+            proc.wait(timeout=SHORT_TIMEOUT)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -53,6 +53,34 @@ def test_new_or_init(self):
         self.assertRaises(TypeError, self.thetype, [], 2)
         self.assertRaises(TypeError, set().__init__, a=1)
 
+    def test_from_list_and_tuple(self):
+        # Exact lists and tuples are hashed in batches.
+        for n in (0, 1, 15, 16, 17, 100):
+            data = [str(i % 40) for i in range(n)]
+            expected = {str(i % 40) for i in range(n)}
+            self.assertEqual(self.thetype(data), expected)
+            self.assertEqual(self.thetype(tuple(data)), expected)
+        data = list(range(20)) + [[]]
+        self.assertRaises(TypeError, self.thetype, data)
+        self.assertRaises(TypeError, self.thetype, tuple(data))
+
+    def test_from_list_mutated_while_hashing(self):
+        lst = list(range(40))
+        class Evil:
+            def __hash__(self):
+                lst.clear()
+                return 0
+        evil = Evil()
+        lst[3] = evil
+        orig = lst[:]
+        s = self.thetype(lst)
+        self.assertEqual(lst, [])
+        # The keys already taken from the list may or may not be added,
+        # but nothing else.
+        self.assertIn(evil, s)
+        self.assertLessEqual(len(s), len(orig))
+        self.assertTrue(all(x in orig for x in s))
+
     def test_uniquification(self):
         actual = sorted(self.s)
         expected = sorted(self.d)
@@ -231,6 +231,29 @@ def test_indices(self):
         self.assertEqual(slice(0, 10, MyIndexable(1)).indices(5), (0, 5, 1))
         self.assertEqual(slice(0, 10, 1).indices(MyIndexable(5)), (0, 5, 1))
 
+    def test_getslice_builtin_sequences(self):
+        # container[start:stop] on exact lists, tuples and strings does not
+        # build a slice object; check it agrees with explicit slices.
+        bounds = [None, 0, 2, 5, -3, -100, 100, True, 2**100, -2**100]
+        for seq in [list(range(10)), tuple(range(10)), "abcdefghij"]:
+            for start in bounds:
+                for stop in bounds:
+                    with self.subTest(seq=seq, start=start, stop=stop):
+                        self.assertEqual(seq[start:stop],
+                                         seq[slice(start, stop)])
+        lst = [1, 2, 3]
+        self.assertIsNot(lst[:], lst)
+        t = (1, 2, 3)
+        self.assertIs(t[:], t)
+        self.assertIs(t[0:100], t)
+        s = "abc"
+        self.assertIs(s[:], s)
+        with self.assertRaises(TypeError):
+            [1, 2][1.0:]
+        with self.assertRaises(TypeError):
+            (1, 2)[:"x"]
+        self.assertEqual([1, 2, 3][MyIndexable(1):], [2, 3])
+
     def test_setslice_without_getslice(self):
         tmp = []
         class X(object):
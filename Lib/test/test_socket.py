@@ -3104,6 +3104,44 @@ def testRecvFromNegative(self):
     def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
+    @requireAttrs(socket.socket, 'recvmmsg_into')
+    def testSendmmsgAndRecvmmsgInto(self):
+        # Testing sendmmsg() and recvmmsg_into() over UDP
+        bufs = [bytearray(len(MSG) + 10) for _ in range(4)]
+        received = []
+        while len(received) < 3:
+            received += self.serv.recvmmsg_into(bufs[len(received):])
+        self.assertEqual(len(received), 3)
+        for (nbytes, addr), buf in zip(received, bufs):
+            self.assertEqual(nbytes, len(MSG))
+            self.assertIsInstance(addr, tuple)
+            self.assertEqual(buf[:nbytes], MSG)
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+
+    @requireAttrs(socket.socket, 'sendmmsg')
+    def _testSendmmsgAndRecvmmsgInto(self):
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+        sent = self.cli.sendmmsg([MSG, bytearray(MSG), memoryview(MSG)],
+                                 0, (HOST, self.port))
+        self.assertEqual(sent, 3)
+
+    @requireAttrs(socket.socket, 'recvmmsg_into')
+    def testRecvmmsgIntoTimeout(self):
+        self.serv.settimeout(0.01)
+        self.assertRaises(TimeoutError,
+                          self.serv.recvmmsg_into, [bytearray(10)])
+
+    def _testRecvmmsgIntoTimeout(self):
+        pass
+
+    @requireAttrs(socket.socket, 'recvmmsg_into')
+    def testRecvmmsgIntoBadArgs(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, 1)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'x'])
+
+    def _testRecvmmsgIntoBadArgs(self):
+        pass
+
 
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
@@ -6769,6 +6807,35 @@ def testNonRegularFile(self):
         self.assertEqual(len(data), self.FILESIZE)
         self.assertEqual(data, self.FILEDATA)
 
+    # pipe
+
+    def _testPipe(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        def write_data():
+            with open(w, 'wb') as f:
+                f.write(self.FILEDATA)
+        writer = threading.Thread(target=write_data)
+        writer.start()
+        try:
+            file = open(r, 'rb', buffering=0)
+            with socket.create_connection(address) as sock, file as file:
+                meth = self.meth_from_sock(sock)
+                try:
+                    sent = meth(file)
+                except socket._GiveupOnSendfile:
+                    # os.splice() is not available
+                    sent = sock.sendfile(file)
+                self.assertEqual(sent, self.FILESIZE)
+        finally:
+            writer.join()
+
+    def testPipe(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(len(data), self.FILESIZE)
+        self.assertEqual(data, self.FILEDATA)
+
     # empty file
 
     def _testEmptyFileSend(self):
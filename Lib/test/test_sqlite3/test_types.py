@@ -30,6 +30,7 @@
     zlib = None
 
 from test import support
+from test.support.script_helper import assert_python_ok
 
 
 class SqliteTypeTests(unittest.TestCase):
@@ -464,6 +465,19 @@ def test_adapt_alt(self):
         alt = "other"
         self.assertEqual(alt, sqlite.adapt(1., None, alt))
 
+    def test_adapt_bytes_and_none(self):
+        # Use a fresh interpreter, so that adapters registered for other
+        # built-in types by earlier tests do not affect the result.
+        code = """if 1:
+            import sqlite3
+            sqlite3.register_adapter(bytes, lambda b: b.hex())
+            sqlite3.register_adapter(type(None), lambda _: "null")
+            con = sqlite3.connect(":memory:")
+            row = con.execute("select ?, ?", (b"\\x01\\x02", None)).fetchone()
+            assert row == ("0102", "null"), row
+        """
+        assert_python_ok("-c", code)
+
 
 @unittest.skipUnless(zlib, "requires zlib")
 class BinaryConverterTests(unittest.TestCase):
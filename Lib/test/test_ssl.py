@@ -4330,6 +4330,32 @@ def test_sendfile(self):
                     s.sendfile(file)
                     self.assertEqual(s.recv(1024), TEST_DATA)
 
+    @unittest.skipUnless(hasattr(ssl, 'OP_ENABLE_KTLS'),
+                         'requires OpenSSL 3.0 or later')
+    def test_sendfile_ktls(self):
+        # Whether kernel TLS is actually used depends on the kernel and
+        # the negotiated cipher; the result must be the same either way.
+        TEST_DATA = b''.join(b'%d,' % i for i in range(2000))
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(TEST_DATA)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        client_context, server_context, hostname = testing_context()
+        client_context.options |= ssl.OP_ENABLE_KTLS
+        server = ThreadedEchoServer(context=server_context, chatty=False)
+        with server:
+            with client_context.wrap_socket(socket.socket(),
+                                            server_hostname=hostname) as s:
+                s.connect((HOST, server.port))
+                self.assertIsInstance(s._sslobj.uses_ktls_for_send(), bool)
+                self.assertIsInstance(s._sslobj.uses_ktls_for_recv(), bool)
+                with open(os_helper.TESTFN, 'rb') as file:
+                    self.assertEqual(s.sendfile(file, 100, 1000), 1000)
+                    self.assertEqual(file.tell(), 1100)
+                data = b''
+                while len(data) < 1000:
+                    data += s.recv(1000)
+                self.assertEqual(data, TEST_DATA[100:1100])
+
     def test_session(self):
         client_context, server_context, hostname = testing_context()
         # TODO: sessions aren't compatible with TLSv1.3 yet
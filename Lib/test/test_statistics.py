@@ -193,7 +193,7 @@ class _DoNothing:
 
 
 class TestModules(unittest.TestCase):
-    func_names = ['_normal_dist_inv_cdf']
+    func_names = ['_normal_dist_inv_cdf', '_select']
 
     def test_py_functions(self):
         for fname in self.func_names:
@@ -204,6 +204,44 @@ def test_c_functions(self):
         for fname in self.func_names:
             self.assertEqual(getattr(c_statistics, fname).__module__, '_statistics')
 
+    @unittest.skipUnless(c_statistics, 'requires _statistics')
+    def test_float_data(self):
+        # The C accelerators for float and int data give exactly the
+        # results of the pure Python code.
+        rnd = random.Random(8675309)
+        datasets = [
+            [1e50, 1, -1e50] * 10,
+            [5e-324, -5e-324, 2.5e-308, 1e150, 1.0],
+            [2**53, -2**53, 3, 0.5],
+            [0.0, -0.0, 0, 0.0, -0.0],
+            list(range(100, 0, -1)),
+            [rnd.gauss(0, 1) for _ in range(1001)],
+            [rnd.choice([1.5, 2, 2.0, -0.0]) for _ in range(100)],
+            [math.ldexp(rnd.random(), rnd.randrange(-1074, 500))
+             for _ in range(500)],
+        ]
+        funcs = ['mean', 'variance', 'pvariance', 'stdev', 'pstdev',
+                 'median', 'median_low', 'median_high']
+        for data in datasets:
+            for fname in funcs:
+                with self.subTest(fname=fname, data=data[:5]):
+                    expected = getattr(py_statistics, fname)(data)
+                    for arg in data, tuple(data), iter(data):
+                        actual = getattr(c_statistics, fname)(arg)
+                        self.assertEqual(actual, expected)
+                        self.assertIs(type(actual), type(expected))
+                        self.assertEqual(sign(actual), sign(expected))
+            for n in 2, 4, 100:
+                for method in 'exclusive', 'inclusive':
+                    with self.subTest(n=n, method=method, data=data[:5]):
+                        expected = py_statistics.quantiles(
+                            data, n=n, method=method)
+                        actual = c_statistics.quantiles(
+                            data, n=n, method=method)
+                        self.assertEqual(actual, expected)
+                        self.assertEqual(list(map(type, actual)),
+                                         list(map(type, expected)))
+
 
 class NumericTestCase(unittest.TestCase):
     """Unit test class for numeric work.
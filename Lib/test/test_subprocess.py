@@ -2023,6 +2023,49 @@ def test_process_group_0(self):
             child_pgid = int(output)
             self.assertNotEqual(parent_pgid, child_pgid)
 
+    @unittest.skipUnless(subprocess._USE_POSIX_SPAWN, 'posix_spawn is not used')
+    @unittest.skipUnless(hasattr(os, 'setpgid') and hasattr(os, 'getpgid'),
+                         'no setpgid or getpgid on platform')
+    def test_posix_spawn_used(self):
+        # posix_spawn() is used for programs found in PATH and for a new
+        # process group or session.
+        exe_dir, exe_name = os.path.split(sys.executable)
+        env = {**os.environ, 'PATH': exe_dir}
+        code = "import os; print(os.getpgid(0), os.getsid(0))"
+        cases = [({}, {})]
+        cases.append(({'process_group': 0}, {'setpgroup': 0}))
+        if subprocess._HAVE_POSIX_SPAWN_SETSID:
+            cases.append(({'start_new_session': True}, {'setsid': True}))
+        for kwargs, spawn_kwargs in cases:
+            with self.subTest(**kwargs):
+                with mock.patch('subprocess.os.posix_spawn',
+                                wraps=os.posix_spawn) as posix_spawn:
+                    try:
+                        output = subprocess.check_output(
+                            [exe_name, "-c", code], env=env, **kwargs)
+                    except PermissionError as e:
+                        if e.errno != errno.EPERM:
+                            raise
+                        continue
+                posix_spawn.assert_called_once()
+                args, call_kwargs = posix_spawn.call_args
+                self.assertEqual(args[0], os.path.join(exe_dir, exe_name))
+                for key, value in spawn_kwargs.items():
+                    self.assertEqual(call_kwargs[key], value)
+                pgid, sid = map(int, output.split())
+                if 'process_group' in kwargs:
+                    self.assertNotEqual(pgid, os.getpgid(0))
+                if 'start_new_session' in kwargs:
+                    self.assertNotEqual(sid, os.getsid(0))
+
+        # A program missing from PATH is reported by _fork_exec()
+        with mock.patch('subprocess.os.posix_spawn') as posix_spawn:
+            with self.assertRaises(FileNotFoundError) as cm:
+                subprocess.Popen(["nonexistent_command_for_test"],
+                                 env={**os.environ, 'PATH': exe_dir})
+        posix_spawn.assert_not_called()
+        self.assertEqual(cm.exception.filename, "nonexistent_command_for_test")
+
     @unittest.skipUnless(hasattr(os, 'setreuid'), 'no setreuid on platform')
     def test_user(self):
         # For code coverage of the user parameter.  We don't care if we get a
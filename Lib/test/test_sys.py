@@ -1324,7 +1324,8 @@ class MyType:
         get_objects = sys.getobjects(3, MyType)
         self.assertEqual(len(get_objects), 3)
 
-    @unittest.skipUnless(hasattr(sys, '_stats_on'), 'need Py_STATS build')
+    @unittest.skipUnless(sysconfig.get_config_var('Py_STATS'),
+                         'need Py_STATS build')
     def test_pystats(self):
         # Call the functions, just check that they don't crash
         # Cannot save/restore state.
@@ -1333,6 +1334,57 @@ def test_pystats(self):
         sys._stats_clear()
         sys._stats_dump()
 
+    @test.support.cpython_only
+    @threading_helper.requires_working_threading()
+    def test_lite_stats(self):
+        import opcode
+        import threading
+
+        def pop_floats():
+            # Keep more floats alive than a free list holds
+            return [float(i) for i in range(1000)]
+
+        sys._stats_off()
+        sys._stats_clear()
+        self.addCleanup(sys._stats_clear)
+        self.addCleanup(sys._stats_off)
+        pop_floats()
+        stats = sys._stats_get()
+        self.assertEqual(stats, {
+            'deopts': {},
+            'specialization_failures': {},
+            'executors_invalidated': 0,
+            'freelists': {},
+            'type_cache': {'misses': 0, 'evictions': 0},
+        })
+
+        sys._stats_on()
+        pop_floats()
+        # Look up an attribute of a type which is not cached yet
+        type('T', (), {'x': 1}).x
+        # Counters of exited threads are kept
+        t = threading.Thread(target=pop_floats)
+        t.start()
+        t.join()
+        sys._stats_off()
+        stats = sys._stats_get()
+        # Only misses are counted, hits are the fast path
+        self.assertGreaterEqual(stats['freelists']['floats'], 1000)
+        self.assertGreater(stats['type_cache']['misses'], 0)
+        for name, count in stats['deopts'].items():
+            self.assertIn(name, opcode._specialized_opmap)
+            self.assertGreater(count, 0)
+        for name, kinds in stats['specialization_failures'].items():
+            self.assertIn(name, opcode._specializations)
+            for kind, count in kinds.items():
+                self.assertIsInstance(kind, int)
+                self.assertGreater(count, 0)
+
+        pop_floats()
+        self.assertEqual(sys._stats_get(), stats)
+        sys._stats_clear()
+        self.assertEqual(sys._stats_get()['freelists'], {})
+
     @test.support.cpython_only
     @unittest.skipUnless(hasattr(sys, 'abiflags'), 'need sys.abiflags')
     def test_disable_gil_abi(self):
@@ -1781,7 +1833,7 @@ def delx(self): del self.__x
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
                   '7P'
-                  '1PIP'                # Specializer cache
+                  '1PIPP'               # Specializer cache
                   + typeid              # heap type id (free-threaded only)
                   )
         class newstyleclass(object): pass
@@ -2259,6 +2311,41 @@ def frame_4_interpreter() -> None:
         assert_python_ok("-c", script.format(enabled=False), PYTHON_JIT="0")
         assert_python_ok("-c", script.format(enabled=available), PYTHON_JIT="1")
 
+    def test_jit_get_executors(self):
+        available = sys._jit.is_available()
+        script = textwrap.dedent(
+            """
+            import _testinternalcapi
+            import sys
+
+            def f():
+                for i in range(_testinternalcapi.TIER2_THRESHOLD + 1):
+                    pass
+
+            before = sys._jit.get_invalidations()
+            assert sys._jit.get_executors(f.__code__) == []
+            f()
+            executors = sys._jit.get_executors(f.__code__)
+            assert len(executors) == {enabled}, executors
+            for info in executors:
+                assert info["valid"]
+                assert info["invalidation_reason"] is None
+                assert info["uops"][0][0] == "_START_EXECUTOR"
+                assert info["jit_size"] >= 0
+                for exit in info["exits"]:
+                    assert exit.keys() == {{"target", "temperature", "linked"}}
+            sys._clear_internal_caches()
+            assert sys._jit.get_executors(f.__code__) == []
+            if {enabled}:
+                after = sys._jit.get_invalidations()
+                assert after["cleared"] > before["cleared"], after
+            """
+        )
+        assert_python_ok("-c", script.format(enabled=False), PYTHON_JIT="0")
+        assert_python_ok("-c", script.format(enabled=available), PYTHON_JIT="1")
+        with self.assertRaises(TypeError):
+            sys._jit.get_executors(None)
+
 
 if __name__ == "__main__":
     unittest.main()
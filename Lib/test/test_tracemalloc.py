@@ -305,6 +305,32 @@ def test_is_tracing(self):
         tracemalloc.start()
         self.assertTrue(tracemalloc.is_tracing())
 
+    def test_sample_rate(self):
+        tracemalloc.stop()
+        with self.assertRaises(ValueError):
+            tracemalloc.start(sample_rate_bytes=-1)
+        self.assertFalse(tracemalloc.is_tracing())
+
+        tracemalloc.start(sample_rate_bytes=16 * 1024)
+        # Only some blocks are traced, with a scaled size: the traced
+        # memory estimates the size of all blocks.
+        obj_size = 10_000
+        data = [bytearray(obj_size) for _ in range(2000)]
+        snapshot = tracemalloc.take_snapshot()
+        traces = [trace for trace in snapshot.traces
+                  if trace.size > obj_size]
+        self.assertGreater(len(traces), 100)
+        self.assertLess(len(traces), len(data))
+        size, peak_size = tracemalloc.get_traced_memory()
+        expected = obj_size * len(data)
+        self.assertGreater(size, expected * 0.85)
+        self.assertLess(size, expected * 1.15)
+
+        data = None
+        size2, peak_size2 = tracemalloc.get_traced_memory()
+        self.assertLess(size2, size - expected * 0.85)
+        self.assertGreaterEqual(peak_size2, size)
+
     def test_snapshot(self):
         obj, source = allocate_bytes(123)
 
@@ -467,6 +467,28 @@ def test_bug_834676(self):
         # Check for bug 834676
         unicodedata.normalize('NFC', '\ud55c\uae00')
 
+    def test_normalize_long_text(self):
+        # Runs of normalized text between the parts which need normalizing
+        # are copied as they are.
+        normalize = unicodedata.normalize
+        pad = 'The quick brown fox jumps over the lazy dog. '
+        pieces = ('caf\xe9', '\xaa\xbd', 'e\u0323\u0301', '\u1e0b\u0323',
+                  'C\u0338\u0327', '\ufb01', '\u1100\u1161\u11a8', '\u2460',
+                  '\U0001d400')
+        for form in ("NFC", "NFKC", "NFD", "NFKD"):
+            for piece in pieces:
+                for n in (0, 1, 3):
+                    with self.subTest(form=form, piece=piece, n=n):
+                        text = (pad * n + piece) * 3 + pad * n
+                        expected = ((pad * n + normalize(form, piece)) * 3
+                                    + pad * n)
+                        self.assertEqual(normalize(form, text), expected)
+            with self.subTest(form=form):
+                # Combining characters combine with the end of a long run.
+                text = pad * 3 + 'e' + '\u0301' + pad
+                expected = pad * 3 + normalize(form, 'e\u0301') + pad
+                self.assertEqual(normalize(form, text), expected)
+
     def test_normalize_return_type(self):
         # gh-129569: normalize() return type must always be str
         normalize = unicodedata.normalize
@@ -1110,6 +1110,25 @@ def meth(self):
         self.assertEqual(r.meth(), "abcdef")
         self.assertNotHasAttr(r, "__dict__")
 
+    def test_subclass_refs_new_only(self):
+        # ref.__init__() ignores the arguments of a subclass that only
+        # overrides __new__().
+        class MyRef(weakref.ref):
+            __slots__ = "key",
+            def __new__(type, ob, callback, key):
+                self = weakref.ref.__new__(type, ob, callback)
+                self.key = key
+                return self
+        o = Object(42)
+        r = MyRef(o, None, "abc")
+        self.assertIs(r(), o)
+        self.assertEqual(r.key, "abc")
+
+        class PlainRef(weakref.ref):
+            pass
+        with self.assertRaises(TypeError):
+            PlainRef(o, None, "abc")
+
     def test_subclass_refs_with_cycle(self):
         """Confirm https://bugs.python.org/issue3100 is fixed."""
         # An instance of a weakref subclass can have attributes.
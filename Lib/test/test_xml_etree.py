@@ -3803,6 +3803,19 @@ def test_constructor_args(self):
         parser2.feed(self.sample1)
         self._check_sample_element(parser2.close())
 
+    def test_many_names(self):
+        # More distinct tag and attribute names than the parser caches,
+        # mixing namespaced and plain names of equal length.
+        names = [f'n{i}' for i in range(200)]
+        xml = '<root xmlns:p="urn:x">%s</root>' % ''.join(
+            f'<{n} {n}="1" p:{n}="2"/><p:{n}/>' for n in names * 2)
+        root = ET.fromstring(xml)
+        self.assertEqual(len(root), 800)
+        for i, n in enumerate(names * 2):
+            self.assertEqual(root[2*i].tag, n)
+            self.assertEqual(root[2*i].attrib, {n: '1', '{urn:x}' + n: '2'})
+            self.assertEqual(root[2*i + 1].tag, '{urn:x}' + n)
+
     def test_subclass(self):
         class MyParser(ET.XMLParser):
             pass
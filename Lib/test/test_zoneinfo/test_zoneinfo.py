@@ -1030,6 +1030,21 @@ def test_tzstr_from_utc(self):
 
                 self.assertEqual(dt_act, dt_utc)
 
+    def test_tzstr_year_order(self):
+        # Looking up transitions of one year must not affect another.
+        tzstr = "EST5EDT,M3.2.0/4:00,M11.1.0/3:00"
+        dts = [datetime(year, month, 15, 12)
+               for year in (2030, 2031, 2030, 2099, 2031)
+               for month in (1, 7)]
+        expected = []
+        for dt in dts:
+            zi = self.zone_from_tzstr(tzstr)
+            expected.append(zi.utcoffset(dt))
+        zi = self.zone_from_tzstr(tzstr)
+        self.assertEqual([zi.utcoffset(dt) for dt in dts], expected)
+        self.assertEqual([zi.utcoffset(dt) for dt in reversed(dts)],
+                         expected[::-1])
+
     def test_extreme_tzstr(self):
         tzstrs = [
             # Extreme offset hour
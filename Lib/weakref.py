@@ -291,9 +291,6 @@ def __new__(type, ob, callback, key):
         self.key = key
         return self
 
-    def __init__(self, ob, callback, key):
-        super().__init__(ob, callback)
-
 
 class WeakKeyDictionary(_collections_abc.MutableMapping):
     """ Mapping class that references keys weakly.
@@ -49,6 +49,40 @@ get_sq_item(PyObject *s)
     return NULL;
 }
 
+/* Return v < w for two objects of the same exact type int (small enough to
+   fit in a machine word), float or str, or -1 for anything else.  Like the
+   unsafe_*_compare() helpers of list.sort(), this runs no Python code. */
+static inline int
+unsafe_lt(PyObject *v, PyObject *w)
+{
+    PyTypeObject *tp = Py_TYPE(v);
+    if (tp != Py_TYPE(w)) {
+        return -1;
+    }
+    if (tp == &PyLong_Type) {
+        if (_PyLong_IsCompact((PyLongObject *)v) &&
+            _PyLong_IsCompact((PyLongObject *)w)) {
+            return _PyLong_CompactValue((PyLongObject *)v) <
+                   _PyLong_CompactValue((PyLongObject *)w);
+        }
+        return -1;
+    }
+    if (tp == &PyFloat_Type) {
+        return PyFloat_AS_DOUBLE(v) < PyFloat_AS_DOUBLE(w);
+    }
+    if (tp == &PyUnicode_Type) {
+        return PyUnicode_Compare(v, w) < 0;
+    }
+    return -1;
+}
+
+static inline int
+is_unsafe_lt_type(PyObject *item)
+{
+    return PyLong_CheckExact(item) || PyFloat_CheckExact(item) ||
+           PyUnicode_CheckExact(item);
+}
+
 static inline Py_ssize_t
 internal_bisect_right(PyObject *list, PyObject *item, Py_ssize_t lo, Py_ssize_t hi,
                       PyObject* key)
@@ -70,6 +104,27 @@ internal_bisect_right(PyObject *list, PyObject *item, Py_ssize_t lo, Py_ssize_t
     if (sq_item == NULL) {
         return -1;
     }
+#ifndef Py_GIL_DISABLED
+    if (key == Py_None && PyList_CheckExact(list) && is_unsafe_lt_type(item)) {
+        /* Search the list directly for as long as its items can be compared
+           with unsafe_lt().  Nothing can change the list meanwhile; the
+           generic loop below takes over from the same bounds otherwise. */
+        while (lo < hi) {
+            mid = ((size_t)lo + hi) / 2;
+            if (mid >= PyList_GET_SIZE(list)) {
+                break;
+            }
+            res = unsafe_lt(item, PyList_GET_ITEM(list, mid));
+            if (res < 0) {
+                break;
+            }
+            if (res)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+    }
+#endif
     if (Py_EnterRecursiveCall(" in _bisect.bisect_right")) {
         return -1;
     }
@@ -254,6 +309,25 @@ internal_bisect_left(PyObject *list, PyObject *item, Py_ssize_t lo, Py_ssize_t h
     if (sq_item == NULL) {
         return -1;
     }
+#ifndef Py_GIL_DISABLED
+    if (key == Py_None && PyList_CheckExact(list) && is_unsafe_lt_type(item)) {
+        // See internal_bisect_right().
+        while (lo < hi) {
+            mid = ((size_t)lo + hi) / 2;
+            if (mid >= PyList_GET_SIZE(list)) {
+                break;
+            }
+            res = unsafe_lt(PyList_GET_ITEM(list, mid), item);
+            if (res < 0) {
+                break;
+            }
+            if (res)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+    }
+#endif
     if (Py_EnterRecursiveCall(" in _bisect.bisect_left")) {
         return -1;
     }
@@ -124,6 +124,16 @@ class dequeobject_converter(self_converter):
  *     d.rightindex == CENTER
  *
  * Checking for d.len == 0 is the intended way to see whether d is empty.
+ *
+ * In the free-threaded build every method that touches the blocks or the
+ * indices runs inside the deque's per-object critical section; only len()
+ * reads d.len without it.  The operations are not made lock-free: an
+ * append and a popleft on a one-block deque update the same indices, a
+ * maxlen deque pops from the opposite end on every append, and blocks are
+ * recycled through d.freeblocks, so a lock-free reader could follow a link
+ * into a block that has already been reused.  The critical section costs
+ * one uncontended atomic operation per call, and threads that need to
+ * block waiting for data should use queue.SimpleQueue.
  */
 
 typedef struct BLOCK {
@@ -2627,6 +2637,442 @@ _collections__count_elements_impl(PyObject *module, PyObject *mapping,
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+_collections._count_mapping
+
+    mapping: object
+    other: object
+    /
+
+Add the counts from the other mapping to the mapping
+[clinic start generated code]*/
+
+static PyObject *
+_collections__count_mapping_impl(PyObject *module, PyObject *mapping,
+                                 PyObject *other)
+/*[clinic end generated code: output=fb205e9ec5171dd9 input=0b30f670e5a33c0b]*/
+{
+    PyObject *key = NULL;
+    PyObject *count = NULL;
+    PyObject *newval = NULL;
+    PyObject *items = NULL;
+    PyObject *item = NULL;
+    PyObject *bound_get = NULL;
+    PyObject *mapping_get, *dict_get, *mapping_setitem, *dict_setitem;
+    PyObject *other_items, *dict_items;
+    PyObject *zero = _PyLong_GetZero();  // borrowed reference
+
+    /* Only take the fast path when get(), __setitem__() and items()
+     * have not been overridden.
+     */
+    mapping_get = _PyType_LookupRef(Py_TYPE(mapping), &_Py_ID(get));
+    dict_get = _PyType_Lookup(&PyDict_Type, &_Py_ID(get));
+    mapping_setitem = _PyType_LookupRef(Py_TYPE(mapping), &_Py_ID(__setitem__));
+    dict_setitem = _PyType_Lookup(&PyDict_Type, &_Py_ID(__setitem__));
+    other_items = _PyType_LookupRef(Py_TYPE(other), &_Py_ID(items));
+    dict_items = _PyType_Lookup(&PyDict_Type, &_Py_ID(items));
+
+    if (mapping_get != NULL && mapping_get == dict_get &&
+        mapping_setitem != NULL && mapping_setitem == dict_setitem &&
+        other_items != NULL && other_items == dict_items &&
+        PyDict_Check(mapping) && PyDict_Check(other))
+    {
+        /* Like _count_elements(), hash each key once and avoid the
+         * method calls.  Adding the counts may run arbitrary code, so
+         * hold references and check the size like a dict iterator.
+         */
+        Py_BEGIN_CRITICAL_SECTION(other);
+        Py_ssize_t pos = 0;
+        Py_ssize_t size = PyDict_GET_SIZE(other);
+        PyObject *k, *v;
+        while (PyDict_Next(other, &pos, &k, &v)) {
+            key = Py_NewRef(k);
+            count = Py_NewRef(v);
+            Py_hash_t hash = _PyObject_HashFast(key);
+            if (hash == -1) {
+                break;
+            }
+            PyObject *oldval = _PyDict_GetItem_KnownHash(mapping, key, hash);
+            if (oldval == NULL) {
+                if (PyErr_Occurred()) {
+                    break;
+                }
+                oldval = zero;
+            }
+            if (oldval == zero && PyLong_CheckExact(count)) {
+                newval = Py_NewRef(count);
+            }
+            else {
+                Py_INCREF(oldval);
+                newval = PyNumber_Add(count, oldval);
+                Py_DECREF(oldval);
+                if (newval == NULL) {
+                    break;
+                }
+            }
+            if (_PyDict_SetItem_KnownHash(mapping, key, newval, hash) < 0) {
+                break;
+            }
+            Py_CLEAR(newval);
+            Py_CLEAR(count);
+            Py_CLEAR(key);
+            if (PyDict_GET_SIZE(other) != size) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "dictionary changed size during iteration");
+                break;
+            }
+        }
+        Py_END_CRITICAL_SECTION();
+    }
+    else {
+        bound_get = PyObject_GetAttr(mapping, &_Py_ID(get));
+        if (bound_get == NULL) {
+            goto done;
+        }
+        PyObject *view = PyObject_CallMethodNoArgs(other, &_Py_ID(items));
+        if (view == NULL) {
+            goto done;
+        }
+        items = PyObject_GetIter(view);
+        Py_DECREF(view);
+        if (items == NULL) {
+            goto done;
+        }
+        while ((item = PyIter_Next(items)) != NULL) {
+            PyObject *pair = PySequence_Tuple(item);
+            if (pair == NULL) {
+                goto done;
+            }
+            if (PyTuple_GET_SIZE(pair) != 2) {
+                if (PyTuple_GET_SIZE(pair) > 2) {
+                    PyErr_Format(PyExc_ValueError,
+                                 "too many values to unpack "
+                                 "(expected 2, got %zd)",
+                                 PyTuple_GET_SIZE(pair));
+                }
+                else {
+                    PyErr_Format(PyExc_ValueError,
+                                 "not enough values to unpack "
+                                 "(expected 2, got %zd)",
+                                 PyTuple_GET_SIZE(pair));
+                }
+                Py_DECREF(pair);
+                goto done;
+            }
+            key = Py_NewRef(PyTuple_GET_ITEM(pair, 0));
+            count = Py_NewRef(PyTuple_GET_ITEM(pair, 1));
+            Py_DECREF(pair);
+            PyObject *oldval = PyObject_CallFunctionObjArgs(bound_get, key,
+                                                            zero, NULL);
+            if (oldval == NULL) {
+                goto done;
+            }
+            newval = PyNumber_Add(count, oldval);
+            Py_DECREF(oldval);
+            if (newval == NULL) {
+                goto done;
+            }
+            if (PyObject_SetItem(mapping, key, newval) < 0) {
+                goto done;
+            }
+            Py_CLEAR(newval);
+            Py_CLEAR(count);
+            Py_CLEAR(key);
+            Py_CLEAR(item);
+        }
+    }
+
+done:
+    Py_XDECREF(mapping_get);
+    Py_XDECREF(mapping_setitem);
+    Py_XDECREF(other_items);
+    Py_XDECREF(key);
+    Py_XDECREF(count);
+    Py_XDECREF(newval);
+    Py_XDECREF(item);
+    Py_XDECREF(items);
+    Py_XDECREF(bound_get);
+    if (PyErr_Occurred())
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+/* An entry of the heap used by _most_common(): the item to return, its
+   count, and its position in iteration order. */
+typedef struct {
+    PyObject *item;
+    PyObject *count;
+    Py_ssize_t index;
+} count_entry;
+
+/* Return 1 if a ranks below b: its count is smaller, or the counts are
+   equal and a comes later.  Return -1 on error.  Like the (count, order)
+   tuples of heapq.nlargest(), test for equality first, so that counts which
+   are unordered (such as NaN) fall back to the order of the entries. */
+static int
+count_entry_lt(const count_entry *a, const count_entry *b)
+{
+    PyObject *x = a->count, *y = b->count;
+    if (PyLong_CheckExact(x) && PyLong_CheckExact(y) &&
+        _PyLong_IsCompact((PyLongObject *)x) &&
+        _PyLong_IsCompact((PyLongObject *)y))
+    {
+        Py_ssize_t u = _PyLong_CompactValue((PyLongObject *)x);
+        Py_ssize_t v = _PyLong_CompactValue((PyLongObject *)y);
+        if (u != v) {
+            return u < v;
+        }
+        return a->index > b->index;
+    }
+    int eq = PyObject_RichCompareBool(x, y, Py_EQ);
+    if (eq < 0) {
+        return -1;
+    }
+    if (eq) {
+        return a->index > b->index;
+    }
+    return PyObject_RichCompareBool(x, y, Py_LT);
+}
+
+/* Restore the heap invariant for heap[pos] moving towards the leaves:
+   each entry ranks below its children. */
+static int
+count_heap_siftdown(count_entry *heap, Py_ssize_t size, Py_ssize_t pos)
+{
+    count_entry entry = heap[pos];
+    Py_ssize_t child;
+    while ((child = 2 * pos + 1) < size) {
+        if (child + 1 < size) {
+            int lt = count_entry_lt(&heap[child + 1], &heap[child]);
+            if (lt < 0) {
+                heap[pos] = entry;
+                return -1;
+            }
+            child += lt;
+        }
+        int lt = count_entry_lt(&heap[child], &entry);
+        if (lt < 0) {
+            heap[pos] = entry;
+            return -1;
+        }
+        if (!lt) {
+            break;
+        }
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = entry;
+    return 0;
+}
+
+/* Offer an entry to a heap of the n highest ranking ones.  Steals the
+   references in *entry, even on error.  Return -1 on error. */
+static int
+count_heap_offer(count_entry *heap, Py_ssize_t *size, Py_ssize_t n,
+                 count_entry *entry)
+{
+    if (*size < n) {
+        Py_ssize_t pos = (*size)++;
+        while (pos > 0) {
+            Py_ssize_t parent = (pos - 1) / 2;
+            int lt = count_entry_lt(entry, &heap[parent]);
+            if (lt < 0) {
+                heap[pos] = *entry;
+                return -1;
+            }
+            if (!lt) {
+                break;
+            }
+            heap[pos] = heap[parent];
+            pos = parent;
+        }
+        heap[pos] = *entry;
+        return 0;
+    }
+    int lt = count_entry_lt(&heap[0], entry);
+    if (lt <= 0) {
+        Py_DECREF(entry->item);
+        Py_DECREF(entry->count);
+        return lt;
+    }
+    Py_DECREF(heap[0].item);
+    Py_DECREF(heap[0].count);
+    heap[0] = *entry;
+    return count_heap_siftdown(heap, *size, 0);
+}
+
+/*[clinic input]
+_collections._most_common
+
+    mapping: object
+    n as n_obj: object
+    /
+
+List the n items of the mapping with the largest counts, largest first
+[clinic start generated code]*/
+
+static PyObject *
+_collections__most_common_impl(PyObject *module, PyObject *mapping,
+                               PyObject *n_obj)
+/*[clinic end generated code: output=afdf17032a18873e input=297b5f0899c86018]*/
+{
+    PyObject *result = NULL;
+    PyObject *items = NULL;
+    count_entry *heap = NULL;
+    Py_ssize_t size = 0;
+    Py_ssize_t index = 0;
+    int error = 0;
+
+    /* Like slicing, clamp huge values rather than overflowing. */
+    Py_ssize_t n = PyNumber_AsSsize_t(n_obj, NULL);
+    if (n == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (n <= 0) {
+        return PyList_New(0);
+    }
+    Py_ssize_t limit = n;
+    PyObject *mapping_items = _PyType_LookupRef(Py_TYPE(mapping),
+                                                &_Py_ID(items));
+    int fast = (PyDict_Check(mapping) && mapping_items != NULL &&
+                mapping_items == _PyType_Lookup(&PyDict_Type, &_Py_ID(items)));
+    Py_XDECREF(mapping_items);
+
+    if (fast) {
+        n = Py_MIN(n, PyDict_GET_SIZE(mapping));
+    }
+    else {
+        PyObject *view = PyObject_CallMethodNoArgs(mapping, &_Py_ID(items));
+        if (view == NULL) {
+            return NULL;
+        }
+        items = PyObject_GetIter(view);
+        Py_DECREF(view);
+        if (items == NULL) {
+            return NULL;
+        }
+        n = Py_MIN(n, 64);   /* grown as needed */
+    }
+    Py_ssize_t allocated = n;
+    heap = PyMem_New(count_entry, allocated ? allocated : 1);
+    if (heap == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    if (fast) {
+        Py_BEGIN_CRITICAL_SECTION(mapping);
+        Py_ssize_t pos = 0;
+        Py_ssize_t dict_size = PyDict_GET_SIZE(mapping);
+        PyObject *key, *value;
+        while (PyDict_Next(mapping, &pos, &key, &value)) {
+            /* The comparisons can run arbitrary code which may change the
+               dict, so hold strong references to the key and the count. */
+            key = Py_NewRef(key);
+            count_entry entry = {NULL, Py_NewRef(value), index++};
+            if (size == n) {
+                /* Most entries do not make it in: compare before
+                   building the (key, count) pair. */
+                int lt = count_entry_lt(&heap[0], &entry);
+                if (lt <= 0) {
+                    Py_DECREF(key);
+                    Py_DECREF(entry.count);
+                    if (lt < 0) {
+                        error = 1;
+                        break;
+                    }
+                    goto next;
+                }
+                if (PyDict_GET_SIZE(mapping) != dict_size) {
+                    Py_DECREF(key);
+                    Py_DECREF(entry.count);
+                    goto next;
+                }
+            }
+            entry.item = PyTuple_Pack(2, key, entry.count);
+            Py_DECREF(key);
+            if (entry.item == NULL) {
+                Py_DECREF(entry.count);
+                error = 1;
+                break;
+            }
+            if (count_heap_offer(heap, &size, n, &entry) < 0) {
+                error = 1;
+                break;
+            }
+          next:
+            if (PyDict_GET_SIZE(mapping) != dict_size) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "dictionary changed size during iteration");
+                error = 1;
+                break;
+            }
+        }
+        Py_END_CRITICAL_SECTION();
+    }
+    else {
+        PyObject *item;
+        while ((item = PyIter_Next(items)) != NULL) {
+            PyObject *count = PyObject_GetItem(item, _PyLong_GetOne());
+            if (count == NULL) {
+                Py_DECREF(item);
+                error = 1;
+                break;
+            }
+            count_entry entry = {item, count, index++};
+            if (size == allocated && allocated < limit) {
+                /* The heap's capacity was capped; grow it. */
+                Py_ssize_t new_allocated = Py_MIN(allocated * 2, limit);
+                count_entry *new_heap = PyMem_Resize(heap, count_entry,
+                                                     new_allocated);
+                if (new_heap == NULL) {
+                    Py_DECREF(item);
+                    Py_DECREF(count);
+                    PyErr_NoMemory();
+                    error = 1;
+                    break;
+                }
+                heap = new_heap;
+                allocated = new_allocated;
+            }
+            if (count_heap_offer(heap, &size, allocated, &entry) < 0) {
+                error = 1;
+                break;
+            }
+        }
+    }
+    if (error || PyErr_Occurred()) {
+        goto done;
+    }
+
+    /* Pop the heap into the result, lowest ranking entry last. */
+    result = PyList_New(size);
+    if (result == NULL) {
+        goto done;
+    }
+    while (size > 0) {
+        count_entry top = heap[0];
+        heap[0] = heap[--size];
+        PyList_SET_ITEM(result, size, top.item);
+        Py_DECREF(top.count);
+        if (count_heap_siftdown(heap, size, 0) < 0) {
+            Py_CLEAR(result);
+            goto done;
+        }
+    }
+
+done:
+    if (heap != NULL) {
+        for (Py_ssize_t i = 0; i < size; i++) {
+            Py_DECREF(heap[i].item);
+            Py_DECREF(heap[i].count);
+        }
+        PyMem_Free(heap);
+    }
+    Py_XDECREF(items);
+    return result;
+}
+
 /* Helper function for namedtuple() ************************************/
 
 typedef struct {
@@ -2818,6 +3264,8 @@ PyDoc_STRVAR(collections_doc,
 
 static struct PyMethodDef collections_methods[] = {
     _COLLECTIONS__COUNT_ELEMENTS_METHODDEF
+    _COLLECTIONS__COUNT_MAPPING_METHODDEF
+    _COLLECTIONS__MOST_COMMON_METHODDEF
     {NULL,       NULL}          /* sentinel */
 };
 
@@ -722,6 +722,63 @@ parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
     return 0;
 }
 
+/* In the IN_FIELD and IN_QUOTED_FIELD states most characters are just
+ * appended to the field.  Append the run of such characters starting at
+ * data[pos] in one go, without going through parse_process_char(), and
+ * return the position of the first character that needs it.
+ */
+static Py_ssize_t
+parse_add_plain_chars(ReaderObj *self, _csvstate *module_state,
+                      int kind, const void *data,
+                      Py_ssize_t pos, Py_ssize_t end)
+{
+    DialectObj *dialect = self->dialect;
+    Py_ssize_t field_limit = FT_ATOMIC_LOAD_SSIZE_RELAXED(module_state->field_limit);
+
+    if (self->field_len >= field_limit) {
+        /* Let parse_add_char() report the error */
+        return pos;
+    }
+    /* Stop at the field limit, parse_add_char() reports the error.
+       The limit can be PY_SSIZE_T_MAX, so do not compute pos + limit. */
+    if (field_limit - self->field_len < end - pos) {
+        end = pos + (field_limit - self->field_len);
+    }
+    while (self->field_size - self->field_len < end - pos) {
+        if (!parse_grow_buff(self)) {
+            return -1;
+        }
+    }
+
+    Py_UCS4 *field = self->field + self->field_len;
+    Py_ssize_t start = pos;
+    if (self->state == IN_FIELD) {
+        for (; pos < end; pos++) {
+            Py_UCS4 c = PyUnicode_READ(kind, data, pos);
+            if (c == dialect->delimiter || c == dialect->escapechar ||
+                c == '\n' || c == '\r')
+            {
+                break;
+            }
+            *field++ = c;
+        }
+    }
+    else {
+        assert(self->state == IN_QUOTED_FIELD);
+        Py_UCS4 quotechar = dialect->quoting != QUOTE_NONE ?
+                            dialect->quotechar : NOT_SET;
+        for (; pos < end; pos++) {
+            Py_UCS4 c = PyUnicode_READ(kind, data, pos);
+            if (c == quotechar || c == dialect->escapechar) {
+                break;
+            }
+            *field++ = c;
+        }
+    }
+    self->field_len += pos - start;
+    return pos;
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -966,7 +1023,18 @@ Reader_iternext(PyObject *op)
         data = PyUnicode_DATA(lineobj);
         pos = 0;
         linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
+        while (pos < linelen) {
+            if (self->state == IN_FIELD || self->state == IN_QUOTED_FIELD) {
+                pos = parse_add_plain_chars(self, module_state, kind, data,
+                                            pos, linelen);
+                if (pos < 0) {
+                    Py_DECREF(lineobj);
+                    goto err;
+                }
+                if (pos == linelen) {
+                    break;
+                }
+            }
             c = PyUnicode_READ(kind, data, pos);
             if (parse_process_char(self, module_state, c) < 0) {
                 Py_DECREF(lineobj);
@@ -2605,6 +2605,43 @@ PyCSimpleType_from_param_impl(PyObject *type, PyTypeObject *cls,
     return NULL;
 }
 
+/*
+ * If 'converter' is the builtin from_param() class method of a simple type
+ * (for example c_int.from_param), store the field descriptor and size it
+ * uses in *pfd and *psize and return 1.  _ctypes_callproc() uses this to
+ * convert plain int and float arguments without creating a PyCArgObject.
+ * Return 0 if the converter is something else, -1 on error.
+ */
+int
+_ctypes_simple_converter(ctypes_state *st, PyObject *converter,
+                         struct fielddesc **pfd, Py_ssize_t *psize)
+{
+    if (!PyCFunction_Check(converter)
+        || PyCFunction_GET_FUNCTION(converter)
+           != _PyCFunction_CAST(PyCSimpleType_from_param))
+    {
+        return 0;
+    }
+    PyObject *type = PyCFunction_GET_SELF(converter);
+    if (type == NULL || !PyType_Check(type)) {
+        return 0;
+    }
+    StgInfo *info;
+    if (PyStgInfo_FromType(st, type, &info) < 0) {
+        return -1;
+    }
+    if (!info || !info->proto) {
+        return 0;
+    }
+    const char *fmt = PyUnicode_AsUTF8(info->proto);
+    if (fmt == NULL) {
+        return -1;
+    }
+    *pfd = _ctypes_get_fielddesc(fmt);
+    *psize = info->size;
+    return *pfd != NULL;
+}
+
 static PyMethodDef PyCSimpleType_methods[] = {
     PYCSIMPLETYPE_FROM_PARAM_METHODDEF
     CDATATYPE_FROM_ADDRESS_METHODDEF
@@ -697,17 +697,28 @@ static int ConvParam(ctypes_state *st,
     }
 
     if (PyLong_Check(obj)) {
-        pa->ffi_type = &ffi_type_sint;
-        pa->value.i = (long)PyLong_AsUnsignedLong(obj);
-        if (pa->value.i == -1 && PyErr_Occurred()) {
-            PyErr_Clear();
-            pa->value.i = PyLong_AsLong(obj);
-            if (pa->value.i == -1 && PyErr_Occurred()) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "int too long to convert");
-                return -1;
+        /* Try the signed conversion first: going through
+           PyLong_AsUnsignedLong() would raise and clear an OverflowError
+           for every negative value. */
+        int overflow;
+        long value = PyLong_AsLongAndOverflow(obj, &overflow);
+        if (value == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (overflow > 0) {
+            value = (long)PyLong_AsUnsignedLong(obj);
+            if (value == -1 && PyErr_Occurred()) {
+                PyErr_Clear();
+                overflow = -1;
             }
         }
+        if (overflow < 0) {
+            PyErr_SetString(PyExc_OverflowError,
+                            "int too long to convert");
+            return -1;
+        }
+        pa->ffi_type = &ffi_type_sint;
+        pa->value.i = value;
         return 0;
     }
 
@@ -1242,6 +1253,24 @@ PyObject *_ctypes_callproc(ctypes_state *st,
         if (argtypes && argtype_count > i) {
             PyObject *v;
             converter = PyTuple_GET_ITEM(argtypes, i);
+            if (PyLong_CheckExact(arg) || PyFloat_CheckExact(arg)) {
+                /* Do what the builtin from_param() of simple types does,
+                   but store the result directly in the argument. */
+                struct fielddesc *fd;
+                Py_ssize_t size;
+                err = _ctypes_simple_converter(st, converter, &fd, &size);
+                if (err > 0) {
+                    pa->ffi_type = fd->pffi_type;
+                    pa->keep = fd->setfunc(&pa->value, arg, size);
+                    if (pa->keep != NULL) {
+                        continue;
+                    }
+                }
+                if (err != 0) {
+                    _ctypes_extend_error(st->PyExc_ArgError, "argument %zd: ", i+1);
+                    goto cleanup;
+                }
+            }
             v = PyObject_CallOneArg(converter, arg);
             if (v == NULL) {
                 _ctypes_extend_error(st->PyExc_ArgError, "argument %zd: ", i+1);
@@ -544,6 +544,8 @@ extern PyObject *PyCData_FromBaseObj(ctypes_state *st, PyObject *type,
                                      PyObject *base, Py_ssize_t index, char *adr);
 
 extern int _ctypes_simple_instance(ctypes_state *st, PyObject *obj);
+extern int _ctypes_simple_converter(ctypes_state *st, PyObject *converter,
+                                    struct fielddesc **pfd, Py_ssize_t *psize);
 
 PyObject *_ctypes_get_errobj(ctypes_state *st, int **pspace);
 
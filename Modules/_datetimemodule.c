@@ -18,6 +18,7 @@
 #include "datetime.h"
 
 
+#include <locale.h>               // setlocale()
 #include <time.h>
 
 #ifdef MS_WINDOWS
@@ -1146,6 +1147,220 @@ parse_isoformat_time(const char *dtstr, size_t dtlen, int *hour, int *minute,
     return rv ? -5 : 1;
 }
 
+/* Fields produced by parse_strptime_fast(). */
+typedef struct {
+    int year, month, day, hour, minute, second, microsecond;
+    int has_offset, offset, offset_us;  /* UTC offset for %z */
+} strptime_fields;
+
+static int
+lc_time_is_c(void)
+{
+    const char *loc = setlocale(LC_TIME, NULL);
+    return loc != NULL && (strcmp(loc, "C") == 0 ||
+                           strcmp(loc, "POSIX") == 0 ||
+                           strncmp(loc, "C.", 2) == 0);
+}
+
+/* Parse the "%z" part at the end of a strptime() string:
+ * [+-]HH[:]MM[[:]SS[.ffffff]] or Z, or nothing.  Return 0 if it is not
+ * consumed entirely or _strptime would reject it.
+ */
+static int
+parse_strptime_offset(const char *s, const char *s_end, strptime_fields *f)
+{
+    const char *p;
+    int hh = 0, mm = 0, ss = 0, us = 0;
+
+    if (s == s_end) {
+        return 1;
+    }
+    if (*s == 'Z') {
+        f->has_offset = 1;
+        return s + 1 == s_end;
+    }
+    if (*s != '+' && *s != '-') {
+        return 0;
+    }
+    int sign = (*s++ == '-') ? -1 : 1;
+    if (s_end - s < 2 || (p = parse_digits(s, &hh, 2)) == NULL) {
+        return 0;
+    }
+    s = p;
+    int colon = (s < s_end && *s == ':');
+    s += colon;
+    if (s_end - s < 2 || *s > '5' || (p = parse_digits(s, &mm, 2)) == NULL) {
+        return 0;
+    }
+    s = p;
+    if (s < s_end) {
+        /* _strptime insists on the same separator before the seconds. */
+        if ((*s == ':') != colon) {
+            return 0;
+        }
+        s += colon;
+        if (s_end - s < 2 || *s > '5' ||
+            (p = parse_digits(s, &ss, 2)) == NULL) {
+            return 0;
+        }
+        s = p;
+        if (s < s_end) {
+            if (*s++ != '.') {
+                return 0;
+            }
+            Py_ssize_t n = s_end - s;
+            if (n < 1 || n > 6 || parse_digits(s, &us, n) == NULL) {
+                return 0;
+            }
+            for (; n < 6; n++) {
+                us *= 10;
+            }
+        }
+    }
+    if (hh >= 24) {
+        return 0;
+    }
+    f->has_offset = 1;
+    f->offset = sign * (hh * 3600 + mm * 60 + ss);
+    f->offset_us = sign * us;
+    return 1;
+}
+
+/* Parse string the way _strptime would for formats made only of %Y, %m, %d,
+ * %H, %M, %S, %f and %% directives, printable ASCII literals and spaces,
+ * optionally ending with %z.  Every directive except %Y must be followed by
+ * a literal other than a digit, by %z or by the end of the format, so the
+ * digits it takes are never ambiguous.
+ *
+ * Return 1 on success and 0 for any other format or input, including all
+ * input that _strptime rejects, so the caller can leave those to it.  This
+ * is only valid in the C locale, where _strptime uses no alternative digits.
+ */
+static int
+parse_strptime_fast(PyObject *string, PyObject *format, strptime_fields *f)
+{
+    if (!PyUnicode_IS_ASCII(string) || !PyUnicode_IS_ASCII(format)) {
+        return 0;
+    }
+    const char *s = (const char *)PyUnicode_DATA(string);
+    const char *s_end = s + PyUnicode_GET_LENGTH(string);
+    const char *p = (const char *)PyUnicode_DATA(format);
+    const char *p_end = p + PyUnicode_GET_LENGTH(format);
+    const char *directives = "YmdHMSfz";
+    unsigned int seen = 0;
+
+    *f = (strptime_fields){1900, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+    while (p < p_end) {
+        char c = *p++;
+        if (c != '%' || (p < p_end && *p == '%')) {
+            p += (c == '%');
+            if (c == ' ') {
+                /* A space matches \s+ in _strptime. */
+                if (s == s_end || *s != ' ' || (++s < s_end && *s <= ' ')) {
+                    return 0;
+                }
+                continue;
+            }
+            if (c <= ' ' || c > '~' || s == s_end || *s != c) {
+                return 0;
+            }
+            s++;
+            continue;
+        }
+        if (p == p_end) {
+            return 0;
+        }
+        c = *p++;
+        /* A repeated directive is an error in _strptime. */
+        const char *d = strchr(directives, c);
+        if (c == '\0' || d == NULL || (seen & (1u << (d - directives)))) {
+            return 0;
+        }
+        seen |= 1u << (d - directives);
+        if (c == 'z') {
+            if (p != p_end || !parse_strptime_offset(s, s_end, f)) {
+                return 0;
+            }
+            s = s_end;
+            break;
+        }
+        if (c == 'Y') {
+            const char *q;
+            int year = 0;
+            if (s_end - s < 4 || (q = parse_digits(s, &year, 4)) == NULL ||
+                year < MINYEAR) {
+                return 0;
+            }
+            s = q;
+            f->year = year;
+            continue;
+        }
+        if (p < p_end && (Py_ISDIGIT(*p) ||
+                          (*p == '%' && (p + 1 == p_end ||
+                                         (p[1] != '%' && p[1] != 'z'))))) {
+            return 0;
+        }
+        const char *start = s;
+        while (s < s_end && Py_ISDIGIT(*s)) {
+            s++;
+        }
+        Py_ssize_t n = s - start;
+        int value = 0;
+        if (n < 1 || n > (c == 'f' ? 6 : 2)) {
+            return 0;
+        }
+        (void)parse_digits(start, &value, n);
+        switch (c) {
+        case 'm':
+            if (value < 1 || value > 12) {
+                return 0;
+            }
+            f->month = value;
+            break;
+        case 'd':
+            if (value < 1 || value > 31) {
+                return 0;
+            }
+            f->day = value;
+            break;
+        case 'H':
+            if (value > 23) {
+                return 0;
+            }
+            f->hour = value;
+            break;
+        case 'M':
+            if (value > 59) {
+                return 0;
+            }
+            f->minute = value;
+            break;
+        case 'S':
+            /* _strptime accepts 60 and 61, which datetime rejects. */
+            if (value > 59) {
+                return 0;
+            }
+            f->second = value;
+            break;
+        case 'f':
+            for (; n < 6; n++) {
+                value *= 10;
+            }
+            f->microsecond = value;
+            break;
+        default:
+            return 0;
+        }
+    }
+    /* %d without %Y makes _strptime emit a DeprecationWarning. */
+    unsigned int year_bit = 1u << 0, day_bit = 1u << 2;
+    if (s != s_end || (seen & (year_bit | day_bit)) == day_bit ||
+        f->day > days_in_month(f->year, f->month)) {
+        return 0;
+    }
+    return 1;
+}
+
 /* ---------------------------------------------------------------------------
  * Create various objects, mostly without range checking.
  */
@@ -1510,7 +1725,7 @@ get_tzinfo_member(PyObject *self)
  * this returns NULL.  Else result is returned.
  */
 static PyObject *
-call_tzinfo_method(PyObject *tzinfo, const char *name, PyObject *tzinfoarg)
+call_tzinfo_method(PyObject *tzinfo, PyObject *name, PyObject *tzinfoarg)
 {
     PyObject *offset;
 
@@ -1520,7 +1735,7 @@ call_tzinfo_method(PyObject *tzinfo, const char *name, PyObject *tzinfoarg)
 
     if (tzinfo == Py_None)
         Py_RETURN_NONE;
-    offset = PyObject_CallMethod(tzinfo, name, "O", tzinfoarg);
+    offset = PyObject_CallMethodOneArg(tzinfo, name, tzinfoarg);
     if (offset == Py_None || offset == NULL)
         return offset;
     if (PyDelta_Check(offset)) {
@@ -1537,7 +1752,7 @@ call_tzinfo_method(PyObject *tzinfo, const char *name, PyObject *tzinfoarg)
     }
     else {
         PyErr_Format(PyExc_TypeError,
-                     "tzinfo.%s() must return None or "
+                     "tzinfo.%U() must return None or "
                      "timedelta, not '%.200s'",
                      name, Py_TYPE(offset)->tp_name);
         Py_DECREF(offset);
@@ -1558,7 +1773,7 @@ call_tzinfo_method(PyObject *tzinfo, const char *name, PyObject *tzinfoarg)
 static PyObject *
 call_utcoffset(PyObject *tzinfo, PyObject *tzinfoarg)
 {
-    return call_tzinfo_method(tzinfo, "utcoffset", tzinfoarg);
+    return call_tzinfo_method(tzinfo, &_Py_ID(utcoffset), tzinfoarg);
 }
 
 /* Call tzinfo.dst(tzinfoarg), and extract an integer from the
@@ -1572,7 +1787,7 @@ call_utcoffset(PyObject *tzinfo, PyObject *tzinfoarg)
 static PyObject *
 call_dst(PyObject *tzinfo, PyObject *tzinfoarg)
 {
-    return call_tzinfo_method(tzinfo, "dst", tzinfoarg);
+    return call_tzinfo_method(tzinfo, &_Py_ID(dst), tzinfoarg);
 }
 
 /* Call tzinfo.tzname(tzinfoarg), and return the result.  tzinfo must be
@@ -1848,6 +2063,62 @@ make_freplacement(PyObject *object)
  * tzinfoarg is the argument to pass to the object's tzinfo method, if
  * needed.
  */
+/* Format the given fields without time.strftime() when format only uses
+ * %Y (for years from 1000 on), %m, %d, %H, %M, %S, %f and %% besides
+ * printable ASCII characters.  These come out the same in every locale and
+ * on every platform.  Return 1 and set *result (NULL on error) if the format
+ * was handled, and 0 otherwise.
+ */
+static int
+fixed_strftime(PyObject *format, int year, int month, int day, int hour,
+               int minute, int second, int us, PyObject **result)
+{
+    char buf[64 * 3];  /* "%f" is the longest expansion */
+    char *out = buf;
+
+    Py_ssize_t flen = PyUnicode_GET_LENGTH(format);
+    if (!PyUnicode_IS_ASCII(format) || flen > 64 || year < 1000) {
+        return 0;
+    }
+    const char *p = (const char *)PyUnicode_DATA(format);
+    const char *p_end = p + flen;
+    while (p < p_end) {
+        char c = *p++;
+        if (c != '%') {
+            if (c < ' ' || c > '~') {
+                return 0;
+            }
+            *out++ = c;
+            continue;
+        }
+        if (p == p_end) {
+            return 0;
+        }
+        int value, width = 2;
+        switch (*p++) {
+        case '%':
+            *out++ = '%';
+            continue;
+        case 'Y': value = year; width = 4; break;
+        case 'm': value = month; break;
+        case 'd': value = day; break;
+        case 'H': value = hour; break;
+        case 'M': value = minute; break;
+        case 'S': value = second; break;
+        case 'f': value = us; width = 6; break;
+        default:
+            return 0;
+        }
+        for (int i = width - 1; i >= 0; i--) {
+            out[i] = '0' + value % 10;
+            value /= 10;
+        }
+        out += width;
+    }
+    *result = PyUnicode_FromStringAndSize(buf, out - buf);
+    return 1;
+}
+
 static PyObject *
 wrap_strftime(PyObject *object, PyObject *format, PyObject *timetuple,
               PyObject *tzinfoarg)
@@ -3429,15 +3700,37 @@ date_fromisocalendar(PyObject *cls, PyObject *args, PyObject *kw)
     return new_date_subclass_ex(year, month, day, cls);
 }
 
+/* Return the tzinfo for the %z of fields from parse_strptime_fast(). */
+static PyObject *
+strptime_fields_tzinfo(const strptime_fields *f)
+{
+    if (!f->has_offset) {
+        return Py_NewRef(Py_None);
+    }
+    PyObject *delta = new_delta(0, f->offset, f->offset_us, 1);
+    if (delta == NULL) {
+        return NULL;
+    }
+    PyObject *tzinfo = new_timezone(delta, NULL);
+    Py_DECREF(delta);
+    return tzinfo;
+}
+
 /* Return new date from _strptime.strptime_datetime_date(). */
 static PyObject *
 date_strptime(PyObject *cls, PyObject *args)
 {
     PyObject *string, *format, *result;
+    strptime_fields f;
 
     if (!PyArg_ParseTuple(args, "UU:strptime", &string, &format)) {
         return NULL;
     }
+    if ((PyTypeObject *)cls == DATE_TYPE(NO_STATE) && lc_time_is_c() &&
+        parse_strptime_fast(string, format, &f))
+    {
+        return new_date(f.year, f.month, f.day);
+    }
 
     PyObject *module = PyImport_Import(&_Py_ID(_strptime));
     if (module == NULL) {
@@ -3577,6 +3870,25 @@ date_strftime(PyObject *self, PyObject *args, PyObject *kw)
                                      &format))
         return NULL;
 
+    /* Subclasses may override timetuple(), and that of an aware datetime
+     * calls tzinfo.dst(), so only naive dates and datetimes take the
+     * fast path.
+     */
+    if (PyDate_CheckExact(self)) {
+        if (fixed_strftime(format, GET_YEAR(self), GET_MONTH(self),
+                           GET_DAY(self), 0, 0, 0, 0, &result)) {
+            return result;
+        }
+    }
+    else if (PyDateTime_CheckExact(self) && GET_DT_TZINFO(self) == Py_None) {
+        if (fixed_strftime(format, GET_YEAR(self), GET_MONTH(self),
+                           GET_DAY(self), DATE_GET_HOUR(self),
+                           DATE_GET_MINUTE(self), DATE_GET_SECOND(self),
+                           DATE_GET_MICROSECOND(self), &result)) {
+            return result;
+        }
+    }
+
     tuple = PyObject_CallMethodNoArgs(self, &_Py_ID(timetuple));
     if (tuple == NULL)
         return NULL;
@@ -4670,10 +4982,23 @@ static PyObject *
 time_strptime(PyObject *cls, PyObject *args)
 {
     PyObject *string, *format, *result;
+    strptime_fields f;
 
     if (!PyArg_ParseTuple(args, "UU:strptime", &string, &format)) {
         return NULL;
     }
+    if ((PyTypeObject *)cls == TIME_TYPE(NO_STATE) && lc_time_is_c() &&
+        parse_strptime_fast(string, format, &f))
+    {
+        PyObject *tzinfo = strptime_fields_tzinfo(&f);
+        if (tzinfo == NULL) {
+            return NULL;
+        }
+        result = new_time(f.hour, f.minute, f.second, f.microsecond,
+                          tzinfo, 0);
+        Py_DECREF(tzinfo);
+        return result;
+    }
 
     PyObject *module = PyImport_Import(&_Py_ID(_strptime));
     if (module == NULL) {
@@ -4840,6 +5165,12 @@ time_strftime(PyObject *op, PyObject *args, PyObject *kw)
                                       &format))
         return NULL;
 
+    if (fixed_strftime(format, 1900, 1, 1, TIME_GET_HOUR(self),
+                       TIME_GET_MINUTE(self), TIME_GET_SECOND(self),
+                       TIME_GET_MICROSECOND(self), &result)) {
+        return result;
+    }
+
     /* Python's strftime does insane things with the year part of the
      * timetuple.  The year is forced to (the otherwise nonsensical)
      * 1900 to work around that.
@@ -5667,9 +5998,22 @@ static PyObject *
 datetime_strptime(PyObject *cls, PyObject *args)
 {
     PyObject *string, *format, *result;
+    strptime_fields f;
 
     if (!PyArg_ParseTuple(args, "UU:strptime", &string, &format))
         return NULL;
+    if ((PyTypeObject *)cls == DATETIME_TYPE(NO_STATE) && lc_time_is_c() &&
+        parse_strptime_fast(string, format, &f))
+    {
+        PyObject *tzinfo = strptime_fields_tzinfo(&f);
+        if (tzinfo == NULL) {
+            return NULL;
+        }
+        result = new_datetime(f.year, f.month, f.day, f.hour, f.minute,
+                              f.second, f.microsecond, tzinfo, 0);
+        Py_DECREF(tzinfo);
+        return result;
+    }
 
     PyObject *module = PyImport_Import(&_Py_ID(_strptime));
     if (module == NULL) {
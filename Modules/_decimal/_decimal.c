@@ -30,6 +30,7 @@
 #endif
 
 #include <Python.h>
+#include "pycore_freelist.h"      // _Py_FREELIST_POP()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_typeobject.h"
 #include "complexobject.h"
@@ -2063,7 +2064,17 @@ PyDecType_New(decimal_state *state, PyTypeObject *type)
     PyDecObject *dec;
 
     if (type == state->PyDec_Type) {
-        dec = PyObject_GC_New(PyDecObject, state->PyDec_Type);
+        dec = _Py_FREELIST_POP(PyDecObject, decimals);
+        if (dec != NULL && Py_TYPE(dec) != type) {
+            /* left behind by another instance of the module */
+            PyTypeObject *tp = Py_TYPE(dec);
+            PyObject_GC_Del(dec);
+            Py_DECREF(tp);
+            dec = NULL;
+        }
+        if (dec == NULL) {
+            dec = PyObject_GC_New(PyDecObject, state->PyDec_Type);
+        }
     }
     else {
         dec = (PyDecObject *)type->tp_alloc(type, 0);
@@ -2102,6 +2113,13 @@ dec_dealloc(PyObject *dec)
     PyTypeObject *tp = Py_TYPE(dec);
     PyObject_GC_UnTrack(dec);
     mpd_del(MPD(dec));
+    decimal_state *state = get_module_state_by_def(tp);
+    if (tp == state->PyDec_Type &&
+        _Py_FREELIST_PUSH(decimals, dec, Py_decimals_MAXFREELIST))
+    {
+        /* the object keeps its reference to the type */
+        return;
+    }
     tp->tp_free(dec);
     Py_DECREF(tp);
 }
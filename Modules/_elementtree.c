@@ -3078,6 +3078,9 @@ _elementtree_TreeBuilder_start_impl(TreeBuilderObject *self, PyObject *tag,
 
 #define EXPAT(st, func) ((st)->expat_capi->func)
 
+/* number of slots in the parser's name cache; must be a power of two */
+#define NAME_CACHE_SIZE 64
+
 static XML_Memory_Handling_Suite ExpatMemoryHandler = {
     PyMem_Malloc, PyMem_Realloc, PyMem_Free};
 
@@ -3090,6 +3093,10 @@ typedef struct {
     PyObject *entity;
 
     PyObject *names;
+    /* direct-mapped cache in front of 'names', so that repeated tag and
+       attribute names can be looked up without allocating a bytes key */
+    PyObject *name_cache_keys[NAME_CACHE_SIZE];
+    PyObject *name_cache_values[NAME_CACHE_SIZE];
 
     PyObject *handle_start_ns;
     PyObject *handle_end_ns;
@@ -3117,10 +3124,22 @@ makeuniversal(XMLParserObject* self, const char* string)
     /* convert a UTF-8 tag/attribute name from the expat parser
        to a universal name string */
 
-    Py_ssize_t size = (Py_ssize_t) strlen(string);
+    Py_ssize_t size;
+    size_t hash = 5381;
     PyObject* key;
     PyObject* value;
 
+    for (size = 0; string[size]; size++)
+        hash = hash * 33 + (unsigned char) string[size];
+    hash &= NAME_CACHE_SIZE - 1;
+
+    /* check the cache first */
+    key = self->name_cache_keys[hash];
+    if (key != NULL && PyBytes_GET_SIZE(key) == size &&
+        memcmp(PyBytes_AS_STRING(key), string, size) == 0) {
+        return Py_NewRef(self->name_cache_values[hash]);
+    }
+
     /* look the 'raw' name up in the names dictionary */
     key = PyBytes_FromStringAndSize(string, size);
     if (!key)
@@ -3173,7 +3192,13 @@ makeuniversal(XMLParserObject* self, const char* string)
         }
     }
 
-    Py_DECREF(key);
+    if (value != NULL) {
+        Py_XSETREF(self->name_cache_keys[hash], key);
+        Py_XSETREF(self->name_cache_values[hash], Py_NewRef(value));
+    }
+    else {
+        Py_DECREF(key);
+    }
     return value;
 }
 
@@ -3656,6 +3681,8 @@ xmlparser_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         self->handle_start = self->handle_data = self->handle_end = NULL;
         self->handle_comment = self->handle_pi = self->handle_close = NULL;
         self->handle_doctype = NULL;
+        memset(self->name_cache_keys, 0, sizeof(self->name_cache_keys));
+        memset(self->name_cache_values, 0, sizeof(self->name_cache_values));
         self->elementtree_module = PyType_GetModuleByDef(type, &elementtreemodule);
         assert(self->elementtree_module != NULL);
         Py_INCREF(self->elementtree_module);
@@ -3853,6 +3880,10 @@ xmlparser_gc_clear(PyObject *op)
     Py_CLEAR(self->target);
     Py_CLEAR(self->entity);
     Py_CLEAR(self->names);
+    for (int i = 0; i < NAME_CACHE_SIZE; i++) {
+        Py_CLEAR(self->name_cache_keys[i]);
+        Py_CLEAR(self->name_cache_values[i]);
+    }
 
     return 0;
 }
@@ -380,6 +380,93 @@ partial_vectorcall_fallback(PyThreadState *tstate, partialobject *pto,
     return _PyObject_MakeTpCall(tstate, (PyObject *)pto, args, nargs, kwnames);
 }
 
+/* Call a partial object that stores keyword arguments from a call that
+ * passes none. The stored keywords become the kwnames of a vectorcall, which
+ * avoids building the argument tuple and keyword dict of partial_call(). */
+static PyObject *
+partial_vectorcall_kw(PyThreadState *tstate, partialobject *pto,
+                      PyObject *const *args, size_t nargsf)
+{
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    PyObject **pto_args = _PyTuple_ITEMS(pto->args);
+    Py_ssize_t pto_nargs = PyTuple_GET_SIZE(pto->args);
+    Py_ssize_t tot_nargs = pto_nargs + nargs - pto->phcount;
+    PyObject *small_stack[_PY_FASTCALL_SMALL_STACK];
+    PyObject **stack = small_stack;
+    PyObject *kwnames = NULL;
+    Py_ssize_t nkw = 0;
+    int fallback = 0;
+
+    /* Take new references to the keyword values, since the call could
+     * modify pto->kw. */
+    Py_BEGIN_CRITICAL_SECTION(pto->kw);
+    Py_ssize_t size = PyDict_GET_SIZE(pto->kw);
+    if ((size_t)(tot_nargs + size) > Py_ARRAY_LENGTH(small_stack)) {
+        stack = PyMem_Malloc((tot_nargs + size) * sizeof(PyObject *));
+    }
+    if (stack != NULL) {
+        kwnames = PyTuple_New(size);
+    }
+    if (kwnames != NULL) {
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
+        while (PyDict_Next(pto->kw, &pos, &key, &value)) {
+            if (!PyUnicode_Check(key)) {
+                /* Let partial_call() report the error */
+                fallback = 1;
+                break;
+            }
+            PyTuple_SET_ITEM(kwnames, nkw, Py_NewRef(key));
+            stack[tot_nargs + nkw] = Py_NewRef(value);
+            nkw++;
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+
+    PyObject *ret = NULL;
+    if (stack == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    if (kwnames == NULL) {
+        goto done;
+    }
+    if (fallback) {
+        ret = partial_vectorcall_fallback(tstate, pto, args, nargsf, NULL);
+        goto done;
+    }
+    if (pto->phcount) {
+        Py_ssize_t j = 0;       // New args index
+        for (Py_ssize_t i = 0; i < pto_nargs; i++) {
+            if (pto_args[i] == pto->placeholder) {
+                stack[i] = args[j];
+                j += 1;
+            }
+            else {
+                stack[i] = pto_args[i];
+            }
+        }
+        assert(j == pto->phcount);
+        memcpy(stack + pto_nargs, args + j, (nargs - j) * sizeof(PyObject*));
+    }
+    else {
+        /* Copy to new stack, using borrowed references */
+        memcpy(stack, pto_args, pto_nargs * sizeof(PyObject*));
+        memcpy(stack + pto_nargs, args, nargs * sizeof(PyObject*));
+    }
+    ret = _PyObject_VectorcallTstate(tstate, pto->fn, stack, tot_nargs,
+                                     nkw ? kwnames : NULL);
+done:
+    for (Py_ssize_t i = 0; i < nkw; i++) {
+        Py_DECREF(stack[tot_nargs + i]);
+    }
+    Py_XDECREF(kwnames);
+    if (stack != small_stack) {
+        PyMem_Free(stack);
+    }
+    return ret;
+}
+
 static PyObject *
 partial_vectorcall(PyObject *self, PyObject *const *args,
                    size_t nargsf, PyObject *kwnames)
@@ -389,7 +476,8 @@ partial_vectorcall(PyObject *self, PyObject *const *args,
     Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
 
     /* pto->kw is mutable, so need to check every time */
-    if (PyDict_GET_SIZE(pto->kw)) {
+    int has_kw = PyDict_GET_SIZE(pto->kw) != 0;
+    if (has_kw && kwnames != NULL) {
         return partial_vectorcall_fallback(tstate, pto, args, nargsf, kwnames);
     }
     Py_ssize_t pto_phcount = pto->phcount;
@@ -399,6 +487,9 @@ partial_vectorcall(PyObject *self, PyObject *const *args,
                      "expected at least %zd, got %zd", pto_phcount, nargs);
         return NULL;
     }
+    if (has_kw) {
+        return partial_vectorcall_kw(tstate, pto, args, nargsf);
+    }
 
     Py_ssize_t nargskw = nargs;
     if (kwnames != NULL) {
@@ -1103,6 +1194,7 @@ typedef PyObject *(*lru_cache_ternaryfunc)(struct lru_cache_object *, PyObject *
 typedef struct lru_cache_object {
     lru_list_elem root;  /* includes PyObject_HEAD */
     lru_cache_ternaryfunc wrapper;
+    vectorcallfunc vectorcall;
     int typed;
     PyObject *cache;
     Py_ssize_t hits;
@@ -1291,38 +1383,27 @@ lru_cache_prepend_link(lru_cache_object *self, lru_list_elem *link)
  */
 
 static int
-bounded_lru_cache_get_lock_held(lru_cache_object *self, PyObject *args, PyObject *kwds,
-                                PyObject **result, PyObject **key, Py_hash_t *hash)
+bounded_lru_cache_get_lock_held(lru_cache_object *self, PyObject *key,
+                                Py_hash_t hash, PyObject **result)
 {
     _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(self);
     lru_list_elem *link;
 
-    PyObject *key_ = *key = lru_cache_make_key(self->kwd_mark, args, kwds, self->typed);
-    if (!key_)
-        return -1;
-    Py_hash_t hash_ = *hash = PyObject_Hash(key_);
-    if (hash_ == -1) {
-        Py_DECREF(key_);  /* dead reference left in *key, is not used */
-        return -1;
-    }
-    int res = _PyDict_GetItemRef_KnownHash_LockHeld((PyDictObject *)self->cache, key_, hash_,
+    int res = _PyDict_GetItemRef_KnownHash_LockHeld((PyDictObject *)self->cache, key, hash,
                                                     (PyObject **)&link);
     if (res > 0) {
-        lru_cache_extract_link(link);
-        lru_cache_append_link(self, link);
+        /* A hit on the most recently used entry leaves the list as is. */
+        if (link->next != &self->root) {
+            lru_cache_extract_link(link);
+            lru_cache_append_link(self, link);
+        }
         *result = link->result;
         FT_ATOMIC_ADD_SSIZE(self->hits, 1);
         Py_INCREF(link->result);
         Py_DECREF(link);
-        Py_DECREF(key_);
         return 1;
     }
-    if (res < 0) {
-        Py_DECREF(key_);
-        return -1;
-    }
-    FT_ATOMIC_ADD_SSIZE(self->misses, 1);
-    return 0;
+    return res;
 }
 
 static PyObject *
@@ -1478,16 +1559,26 @@ bounded_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds
     Py_hash_t hash;
     int res;
 
+    /* The key and its hash don't depend on the cache state, so they are
+       computed before taking the lock. */
+    key = lru_cache_make_key(self->kwd_mark, args, kwds, self->typed);
+    if (!key)
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
     Py_BEGIN_CRITICAL_SECTION(self);
-    res = bounded_lru_cache_get_lock_held(self, args, kwds, &result, &key, &hash);
+    res = bounded_lru_cache_get_lock_held(self, key, hash, &result);
     Py_END_CRITICAL_SECTION();
 
-    if (res < 0) {
-        return NULL;
-    }
-    if (res > 0) {
-        return result;
+    if (res != 0) {
+        Py_DECREF(key);
+        return res < 0 ? NULL : result;
     }
+    FT_ATOMIC_ADD_SSIZE(self->misses, 1);
 
     result = PyObject_Call(self->func, args, kwds);
 
@@ -1502,6 +1593,9 @@ bounded_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds
     return result;
 }
 
+static PyObject *lru_cache_vectorcall(PyObject *op, PyObject *const *args,
+                                      size_t nargsf, PyObject *kwnames);
+
 static PyObject *
 lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
 {
@@ -1564,6 +1658,7 @@ lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     obj->root.prev = &obj->root;
     obj->root.next = &obj->root;
     obj->wrapper = wrapper;
+    obj->vectorcall = lru_cache_vectorcall;
     obj->typed = typed;
     obj->cache = cachedict;
     obj->func = Py_NewRef(func);
@@ -1636,6 +1731,60 @@ lru_cache_call(PyObject *op, PyObject *args, PyObject *kwds)
     return result;
 }
 
+/* Cache hits on a single str or int argument, the most common case, are
+   served without creating an args tuple: lru_cache_make_key() uses such
+   an argument as the key itself.  Everything else, including misses, goes
+   through the tuple-based wrapper. */
+static PyObject *
+lru_cache_vectorcall(PyObject *op, PyObject *const *args,
+                     size_t nargsf, PyObject *kwnames)
+{
+    lru_cache_object *self = lru_cache_object_CAST(op);
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    PyObject *key, *result;
+    Py_hash_t hash;
+    int res;
+
+    if (nargs != 1 || kwnames != NULL || self->typed || self->maxsize == 0) {
+        goto fallback;
+    }
+    key = args[0];
+    if (!PyUnicode_CheckExact(key) && !PyLong_CheckExact(key)) {
+        goto fallback;
+    }
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        return NULL;
+    }
+    if (self->maxsize < 0) {
+        res = _PyDict_GetItemRef_KnownHash((PyDictObject *)self->cache,
+                                           key, hash, &result);
+        if (res > 0) {
+            FT_ATOMIC_ADD_SSIZE(self->hits, 1);
+        }
+    }
+    else {
+        Py_BEGIN_CRITICAL_SECTION(self);
+        res = bounded_lru_cache_get_lock_held(self, key, hash, &result);
+        Py_END_CRITICAL_SECTION();
+    }
+    if (res != 0) {
+        return res < 0 ? NULL : result;
+    }
+
+  fallback:
+    if (kwnames == NULL) {
+        PyObject *argtuple = _PyTuple_FromArray(args, nargs);
+        if (argtuple == NULL) {
+            return NULL;
+        }
+        result = self->wrapper(self, argtuple, NULL);
+        Py_DECREF(argtuple);
+        return result;
+    }
+    return _PyObject_MakeTpCall(_PyThreadState_GET(), op, args, nargs, kwnames);
+}
+
 static PyObject *
 lru_cache_descr_get(PyObject *self, PyObject *obj, PyObject *type)
 {
@@ -1773,6 +1922,8 @@ static PyMemberDef lru_cache_memberlist[] = {
      offsetof(lru_cache_object, dict), Py_READONLY},
     {"__weaklistoffset__", Py_T_PYSSIZET,
      offsetof(lru_cache_object, weakreflist), Py_READONLY},
+    {"__vectorcalloffset__", Py_T_PYSSIZET,
+     offsetof(lru_cache_object, vectorcall), Py_READONLY},
     {NULL}  /* Sentinel */
 };
 
@@ -1794,7 +1945,8 @@ static PyType_Spec lru_cache_type_spec = {
     .name = "functools._lru_cache_wrapper",
     .basicsize = sizeof(lru_cache_object),
     .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
-             Py_TPFLAGS_METHOD_DESCRIPTOR | Py_TPFLAGS_IMMUTABLETYPE,
+             Py_TPFLAGS_METHOD_DESCRIPTOR | Py_TPFLAGS_HAVE_VECTORCALL |
+             Py_TPFLAGS_IMMUTABLETYPE,
     .slots = lru_cache_type_slots
 };
 
@@ -22,6 +22,55 @@ module _heapq
 [clinic start generated code]*/
 /*[clinic end generated code: output=da39a3ee5e6b4b0d input=d7cca0a2e4c0ceb3]*/
 
+/* Compare two exact ints that fit in a machine word or two exact floats
+   without going through rich comparison.  Return -1 for other operands. */
+static inline int
+number_lt(PyObject *a, PyObject *b)
+{
+    if (PyLong_CheckExact(a) && PyLong_CheckExact(b)) {
+        if (_PyLong_IsCompact((PyLongObject *)a) &&
+            _PyLong_IsCompact((PyLongObject *)b)) {
+            return _PyLong_CompactValue((PyLongObject *)a) <
+                   _PyLong_CompactValue((PyLongObject *)b);
+        }
+    }
+    else if (PyFloat_CheckExact(a) && PyFloat_CheckExact(b)) {
+        return PyFloat_AS_DOUBLE(a) < PyFloat_AS_DOUBLE(b);
+    }
+    return -1;
+}
+
+/* Return a < b with the result convention of PyObject_RichCompareBool().
+   Besides plain numbers, (priority, item) tuples are decided by their first
+   items when those are numbers that differ, as the tuple comparison would
+   stop there too. */
+static int
+heap_lt(PyObject *a, PyObject *b)
+{
+    int cmp = number_lt(a, b);
+    if (cmp >= 0) {
+        return cmp;
+    }
+    if (PyTuple_CheckExact(a) && PyTuple_CheckExact(b) &&
+        PyTuple_GET_SIZE(a) > 0 && PyTuple_GET_SIZE(b) > 0)
+    {
+        PyObject *x = PyTuple_GET_ITEM(a, 0);
+        PyObject *y = PyTuple_GET_ITEM(b, 0);
+        if (x != y) {
+            cmp = number_lt(x, y);
+            if (cmp == 1 || (cmp == 0 && number_lt(y, x) == 1)) {
+                return cmp;
+            }
+        }
+    }
+    Py_INCREF(a);
+    Py_INCREF(b);
+    cmp = PyObject_RichCompareBool(a, b, Py_LT);
+    Py_DECREF(a);
+    Py_DECREF(b);
+    return cmp;
+}
+
 static int
 siftdown(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
 {
@@ -43,11 +92,7 @@ siftdown(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
     while (pos > startpos) {
         parentpos = (pos - 1) >> 1;
         parent = arr[parentpos];
-        Py_INCREF(newitem);
-        Py_INCREF(parent);
-        cmp = PyObject_RichCompareBool(newitem, parent, Py_LT);
-        Py_DECREF(parent);
-        Py_DECREF(newitem);
+        cmp = heap_lt(newitem, parent);
         if (cmp < 0)
             return -1;
         if (size != PyList_GET_SIZE(heap)) {
@@ -91,11 +136,7 @@ siftup(PyListObject *heap, Py_ssize_t pos)
         if (childpos + 1 < endpos) {
             PyObject* a = arr[childpos];
             PyObject* b = arr[childpos + 1];
-            Py_INCREF(a);
-            Py_INCREF(b);
-            cmp = PyObject_RichCompareBool(a, b, Py_LT);
-            Py_DECREF(a);
-            Py_DECREF(b);
+            cmp = heap_lt(a, b);
             if (cmp < 0)
                 return -1;
             childpos += ((unsigned)cmp ^ 1);   /* increment when cmp==0 */
@@ -272,9 +313,7 @@ _heapq_heappushpop_impl(PyObject *module, PyObject *heap, PyObject *item)
     }
 
     PyObject* top = PyList_GET_ITEM(heap, 0);
-    Py_INCREF(top);
-    cmp = PyObject_RichCompareBool(top, item, Py_LT);
-    Py_DECREF(top);
+    cmp = heap_lt(top, item);
     if (cmp < 0)
         return NULL;
     if (cmp == 0) {
@@ -424,11 +463,8 @@ siftdown_max(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
     newitem = arr[pos];
     while (pos > startpos) {
         parentpos = (pos - 1) >> 1;
-        parent = Py_NewRef(arr[parentpos]);
-        Py_INCREF(newitem);
-        cmp = PyObject_RichCompareBool(parent, newitem, Py_LT);
-        Py_DECREF(parent);
-        Py_DECREF(newitem);
+        parent = arr[parentpos];
+        cmp = heap_lt(parent, newitem);
         if (cmp < 0)
             return -1;
         if (size != PyList_GET_SIZE(heap)) {
@@ -472,11 +508,7 @@ siftup_max(PyListObject *heap, Py_ssize_t pos)
         if (childpos + 1 < endpos) {
             PyObject* a = arr[childpos + 1];
             PyObject* b = arr[childpos];
-            Py_INCREF(a);
-            Py_INCREF(b);
-            cmp = PyObject_RichCompareBool(a, b, Py_LT);
-            Py_DECREF(a);
-            Py_DECREF(b);
+            cmp = heap_lt(a, b);
             if (cmp < 0)
                 return -1;
             childpos += ((unsigned)cmp ^ 1);   /* increment when cmp==0 */
@@ -609,9 +641,7 @@ _heapq_heappushpop_max_impl(PyObject *module, PyObject *heap, PyObject *item)
     }
 
     PyObject *top = PyList_GET_ITEM(heap, 0);
-    Py_INCREF(top);
-    cmp = PyObject_RichCompareBool(item, top, Py_LT);
-    Py_DECREF(top);
+    cmp = heap_lt(item, top);
     if (cmp < 0) {
         return NULL;
     }
@@ -7,6 +7,8 @@
 
 #include "Python.h"
 #include "pycore_crossinterp.h"   // _PyXIData_t
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
+#include "pycore_time.h"          // _PyDeadline_Init()
 
 #define REGISTERS_HEAP_TYPES
 #define HAS_FALLBACK
@@ -519,6 +521,9 @@ typedef struct _queue {
     int alive;
     struct _queueitems {
         Py_ssize_t maxsize;
+        // Blocked put() and get() calls park on this address (see
+        // _queue_wait()), so it is written atomically.  It is set to -1
+        // when the queue is destroyed.
         Py_ssize_t count;
         _queueitem *first;
         _queueitem *last;
@@ -568,13 +573,25 @@ _queue_kill_and_wait(_queue *queue)
     PyThread_acquire_lock(queue->mutex, WAIT_LOCK);
     assert(queue->alive);
     queue->alive = 0;
+    // Wake up any blocked put() or get() calls; they will see the queue
+    // is gone.  No new waiter can park since no count matches -1.
+    _Py_atomic_store_ssize(&queue->items.count, -1);
     PyThread_release_lock(queue->mutex);
+    _PyParkingLot_UnparkAll(&queue->items.count);
 
-    // Wait for all waiters to fail.
+    // Wait for all waiters to fail.  A woken put() or get() has to
+    // re-attach its thread state before it can give up, so let it run.
+    PyThreadState *save = NULL;
+    if (queue->num_waiters > 0 && PyThreadState_GetUnchecked() != NULL) {
+        save = PyEval_SaveThread();
+    }
     while (queue->num_waiters > 0) {
         PyThread_acquire_lock(queue->mutex, WAIT_LOCK);
         PyThread_release_lock(queue->mutex);
-    };
+    }
+    if (save != NULL) {
+        PyEval_RestoreThread(save);
+    }
 }
 
 static void
@@ -646,7 +663,7 @@ _queue_add(_queue *queue, int64_t interpid, _PyXIData_t *data, int unboundop)
         return -1;
     }
 
-    queue->items.count += 1;
+    _Py_atomic_store_ssize(&queue->items.count, queue->items.count + 1);
     if (queue->items.first == NULL) {
         queue->items.first = item;
     }
@@ -656,6 +673,7 @@ _queue_add(_queue *queue, int64_t interpid, _PyXIData_t *data, int unboundop)
     queue->items.last = item;
 
     _queue_unlock(queue);
+    _PyParkingLot_UnparkAll(&queue->items.count);
     return 0;
 }
 
@@ -677,11 +695,35 @@ _queue_next(_queue *queue, _PyXIData_t **p_data, int *p_unboundop)
     if (queue->items.last == item) {
         queue->items.last = NULL;
     }
-    queue->items.count -= 1;
+    _Py_atomic_store_ssize(&queue->items.count, queue->items.count - 1);
 
     _queueitem_popped(item, p_data, p_unboundop);
 
     _queue_unlock(queue);
+    _PyParkingLot_UnparkAll(&queue->items.count);
+    return 0;
+}
+
+// Block until the queue's item count is no longer "count", the deadline
+// passes (return "err"), or a signal handler raises (return -1).
+// The caller must be marked as a waiter, so the queue stays alive.
+static int
+_queue_wait(_queue *queue, Py_ssize_t count, PyTime_t deadline, int err)
+{
+    PyTime_t timeout = -1;
+    if (deadline != 0) {
+        timeout = _PyDeadline_Get(deadline);
+        if (timeout <= 0) {
+            return err;
+        }
+    }
+    int res = _PyParkingLot_Park(&queue->items.count, &count, sizeof(count),
+                                 timeout, NULL, 1);
+    if (res == Py_PARK_INTR) {
+        if (PyErr_CheckSignals() < 0) {
+            return -1;
+        }
+    }
     return 0;
 }
 
@@ -742,6 +784,7 @@ _queue_clear_interpreter(_queue *queue, int64_t interpid)
     }
     assert(err == 0);  // There should be no other errors.
 
+    int removed = 0;
     _queueitem *prev = NULL;
     _queueitem *next = queue->items.first;
     while (next != NULL) {
@@ -758,7 +801,9 @@ _queue_clear_interpreter(_queue *queue, int64_t interpid)
             else {
                 prev->next = next;
             }
-            queue->items.count -= 1;
+            _Py_atomic_store_ssize(&queue->items.count,
+                                   queue->items.count - 1);
+            removed = 1;
         }
         else {
             prev = item;
@@ -766,6 +811,10 @@ _queue_clear_interpreter(_queue *queue, int64_t interpid)
     }
 
     _queue_unlock(queue);
+    if (removed) {
+        // Wake up put() calls waiting for room.
+        _PyParkingLot_UnparkAll(&queue->items.count);
+    }
 }
 
 
@@ -813,13 +862,13 @@ _queuerefs_clear(_queueref *head)
         _queue *queue = ref->queue;
         GLOBAL_FREE(ref);
 
-        _queue_kill_and_wait(queue);
 #ifdef Py_DEBUG
     if (queue->items.count > 0) {
         fprintf(stderr, "queue %" PRId64 " still holds %zd items\n",
                 qid, queue->items.count);
     }
 #endif
+        _queue_kill_and_wait(queue);
         _queue_free(queue);
     }
 }
@@ -1119,7 +1168,7 @@ queue_destroy(_queues *queues, int64_t qid)
 // Push an object onto the queue.
 static int
 queue_put(_queues *queues, int64_t qid, PyObject *obj, unboundop_t unboundop,
-          xidata_fallback_t fallback)
+          xidata_fallback_t fallback, PY_TIMEOUT_T timeout)
 {
     PyThreadState *tstate = PyThreadState_Get();
 
@@ -1145,9 +1194,21 @@ queue_put(_queues *queues, int64_t qid, PyObject *obj, unboundop_t unboundop,
     assert(_PyXIData_INTERPID(xidata) ==
             PyInterpreterState_GetID(tstate->interp));
 
-    // Add the data to the queue.
+    // Add the data to the queue, waiting while it is full.
     int64_t interpid = -1;  // _queueitem_init() will set it.
-    int res = _queue_add(queue, interpid, xidata, unboundop);
+    PyTime_t deadline = timeout > 0 ? _PyDeadline_Init(timeout) : 0;
+    int res;
+    for (;;) {
+        res = _queue_add(queue, interpid, xidata, unboundop);
+        if (res != ERR_QUEUE_FULL || timeout == 0) {
+            break;
+        }
+        res = _queue_wait(queue, queue->items.maxsize, deadline,
+                          ERR_QUEUE_FULL);
+        if (res != 0) {
+            break;
+        }
+    }
     _queue_unmark_waiter(queue, queues->mutex);
     if (res != 0) {
         // We may chain an exception here:
@@ -1159,11 +1220,11 @@ queue_put(_queues *queues, int64_t qid, PyObject *obj, unboundop_t unboundop,
     return 0;
 }
 
-// Pop the next object off the queue.  Fail if empty.
-// XXX Support a "wait" mutex?
+// Pop the next object off the queue.  If it is empty, wait up to
+// "timeout" for an item (0 means fail right away, -1 wait forever).
 static int
 queue_get(_queues *queues, int64_t qid,
-          PyObject **res, int *p_unboundop)
+          PyObject **res, int *p_unboundop, PY_TIMEOUT_T timeout)
 {
     int err;
     *res = NULL;
@@ -1177,9 +1238,19 @@ queue_get(_queues *queues, int64_t qid,
     // Past this point we are responsible for releasing the mutex.
     assert(queue != NULL);
 
-    // Pop off the next item from the queue.
+    // Pop off the next item from the queue, waiting while it is empty.
     _PyXIData_t *data = NULL;
-    err = _queue_next(queue, &data, p_unboundop);
+    PyTime_t deadline = timeout > 0 ? _PyDeadline_Init(timeout) : 0;
+    for (;;) {
+        err = _queue_next(queue, &data, p_unboundop);
+        if (err != ERR_QUEUE_EMPTY || timeout == 0) {
+            break;
+        }
+        err = _queue_wait(queue, 0, deadline, ERR_QUEUE_EMPTY);
+        if (err != 0) {
+            break;
+        }
+    }
     _queue_unmark_waiter(queue, queues->mutex);
     if (err != 0) {
         return err;
@@ -1598,18 +1669,26 @@ Each corresponding default unbound op and fallback is also included.");
 static PyObject *
 queuesmod_put(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    static char *kwlist[] = {"qid", "obj", "unboundop", "fallback", NULL};
+    static char *kwlist[] = {"qid", "obj", "unboundop", "fallback",
+                             "blocking", "timeout", NULL};
     qidarg_converter_data qidarg = {0};
     PyObject *obj;
     int unboundarg = -1;
     int fallbackarg = -1;
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&O|ii$p:put", kwlist,
+    int blocking = 0;
+    PyObject *timeout_obj = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&O|ii$pO:put", kwlist,
                                      qidarg_converter, &qidarg, &obj,
-                                     &unboundarg, &fallbackarg))
+                                     &unboundarg, &fallbackarg,
+                                     &blocking, &timeout_obj))
     {
         return NULL;
     }
     int64_t qid = qidarg.id;
+    PY_TIMEOUT_T timeout;
+    if (PyThread_ParseTimeoutArg(timeout_obj, blocking, &timeout) < 0) {
+        return NULL;
+    }
     struct _queuedefaults defaults = {-1, -1};
     if (unboundarg < 0 || fallbackarg < 0) {
         int err = queue_get_defaults(&_globals.queues, qid, &defaults);
@@ -1627,7 +1706,8 @@ queuesmod_put(PyObject *self, PyObject *args, PyObject *kwds)
     }
 
     /* Queue up the object. */
-    int err = queue_put(&_globals.queues, qid, obj, unboundop, fallback);
+    int err = queue_put(&_globals.queues, qid, obj, unboundop, fallback,
+                        timeout);
     // This is the only place that raises QueueFull.
     if (handle_queue_error(err, self, qid)) {
         return NULL;
@@ -1637,24 +1717,34 @@ queuesmod_put(PyObject *self, PyObject *args, PyObject *kwds)
 }
 
 PyDoc_STRVAR(queuesmod_put_doc,
-"put(qid, obj)\n\
+"put(qid, obj, unboundop=-1, fallback=-1, *, blocking=False, timeout=None)\n\
+\n\
+Add the object's data to the queue.\n\
 \n\
-Add the object's data to the queue.");
+If the queue is full and \"blocking\" is true then wait (up to \"timeout\"\n\
+seconds, if given) for room.  Otherwise raise QueueFull.");
 
 static PyObject *
 queuesmod_get(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    static char *kwlist[] = {"qid", NULL};
+    static char *kwlist[] = {"qid", "blocking", "timeout", NULL};
     qidarg_converter_data qidarg = {0};
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&:get", kwlist,
-                                     qidarg_converter, &qidarg)) {
+    int blocking = 0;
+    PyObject *timeout_obj = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|$pO:get", kwlist,
+                                     qidarg_converter, &qidarg,
+                                     &blocking, &timeout_obj)) {
         return NULL;
     }
     int64_t qid = qidarg.id;
+    PY_TIMEOUT_T timeout;
+    if (PyThread_ParseTimeoutArg(timeout_obj, blocking, &timeout) < 0) {
+        return NULL;
+    }
 
     PyObject *obj = NULL;
     int unboundop = 0;
-    int err = queue_get(&_globals.queues, qid, &obj, &unboundop);
+    int err = queue_get(&_globals.queues, qid, &obj, &unboundop, timeout);
     // This is the only place that raises QueueEmpty.
     if (handle_queue_error(err, self, qid)) {
         return NULL;
@@ -1669,12 +1759,14 @@ queuesmod_get(PyObject *self, PyObject *args, PyObject *kwds)
 }
 
 PyDoc_STRVAR(queuesmod_get_doc,
-"get(qid) -> (obj, unboundop)\n\
+"get(qid, *, blocking=False, timeout=None) -> (obj, unboundop)\n\
 \n\
 Return a new object from the data at the front of the queue.\n\
 The unbound op is also returned.\n\
 \n\
-If there is nothing to receive then raise QueueEmpty.");
+If there is nothing to receive and \"blocking\" is true then wait\n\
+(up to \"timeout\" seconds, if given) for an item.  Otherwise raise\n\
+QueueEmpty.");
 
 static PyObject *
 queuesmod_bind(PyObject *self, PyObject *args, PyObject *kwds)
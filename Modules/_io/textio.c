@@ -2134,6 +2134,27 @@ _PyIO_find_line_ending(
          * The decoder ensures that \r\n are not split in two pieces
          */
         const char *s = start;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Fast path: look for \n with memchr(), then for an earlier \r.
+               Searching in bounded windows keeps files that only use one
+               of the two line endings from being rescanned to the end of
+               the buffer for every line. */
+            while (s < end) {
+                const char *e = end - s > 256 ? s + 256 : end;
+                const char *lf = memchr(s, '\n', e - s);
+                const char *cr = memchr(s, '\r', (lf != NULL ? lf : e) - s);
+                if (cr != NULL) {
+                    /* The string is NUL-terminated, so cr[1] is valid. */
+                    return (cr - start) + (cr[1] == '\n' ? 2 : 1);
+                }
+                if (lf != NULL) {
+                    return (lf - start) + 1;
+                }
+                s = e;
+            }
+            *consumed = len;
+            return -1;
+        }
         for (;;) {
             Py_UCS4 ch;
             /* Fast path for non-control chars. The loop always ends
@@ -52,8 +52,12 @@ typedef struct _PyEncoderObject {
     char skipkeys;
     int allow_nan;
     PyCFunction fast_encode;
+    PyObject *key_cache;    /* str key -> its encoded form, or NULL */
 } PyEncoderObject;
 
+/* Maximum number of entries in PyEncoderObject.key_cache */
+#define ENCODER_KEY_CACHE_SIZE 1024
+
 #define PyEncoderObject_CAST(op)    ((PyEncoderObject *)(op))
 
 static PyMemberDef encoder_members[] = {
@@ -360,6 +364,48 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Mask with the high bit of each byte of a size_t set */
+#define UCS1_HIGH_BITS ((size_t)-1 / 0xFF * 0x80)
+
+/* Return the index of the first quote, backslash or control character in
+   buf[start:len], or len if there is none.  Short strings (most object
+   keys) are checked byte by byte, longer runs of plain characters are
+   skipped a whole word at a time. */
+static inline Py_ssize_t
+find_special_ucs1(const Py_UCS1 *buf, Py_ssize_t start, Py_ssize_t len)
+{
+    const size_t ones = (size_t)-1 / 0xFF;
+    Py_ssize_t i = start;
+    Py_ssize_t stop = Py_MIN(len, start + (Py_ssize_t)sizeof(size_t));
+    for (; i < stop; i++) {
+        Py_UCS1 c = buf[i];
+        if (c == '"' || c == '\\' || c <= 0x1f) {
+            return i;
+        }
+    }
+    while (len - i >= (Py_ssize_t)sizeof(size_t)) {
+        size_t w, quote, backslash;
+        memcpy(&w, buf + i, sizeof(w));
+        quote = w ^ (ones * '"');
+        backslash = w ^ (ones * '\\');
+        /* Some byte's high bit is set here iff some byte of w is a quote,
+           a backslash or less than 0x20. */
+        if ((((quote - ones) & ~quote) |
+             ((backslash - ones) & ~backslash) |
+             ((w - ones * 0x20) & ~w)) & UCS1_HIGH_BITS) {
+            break;
+        }
+        i += sizeof(size_t);
+    }
+    for (; i < len; i++) {
+        Py_UCS1 c = buf[i];
+        if (c == '"' || c == '\\' || c <= 0x1f) {
+            break;
+        }
+    }
+    return i;
+}
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -394,7 +440,11 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
+            next = end;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                next = find_special_ucs1(buf, next, len);
+            }
+            for (; next < len; next++) {
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -1246,11 +1296,20 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->skipkeys = skipkeys;
     s->allow_nan = allow_nan;
     s->fast_encode = NULL;
+    s->key_cache = NULL;
 
     if (PyCFunction_Check(s->encoder)) {
         PyCFunction f = PyCFunction_GetFunction(s->encoder);
         if (f == py_encode_basestring_ascii || f == py_encode_basestring) {
             s->fast_encode = f;
+            /* Lists of similar dicts repeat the same keys, so remember
+               how they encode.  Only the builtin encoders are known to
+               be deterministic. */
+            s->key_cache = PyDict_New();
+            if (s->key_cache == NULL) {
+                Py_DECREF(s);
+                return NULL;
+            }
         }
     }
 
@@ -1451,6 +1510,29 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
     return encoded;
 }
 
+static PyObject *
+encoder_encode_key(PyEncoderObject *s, PyObject *key)
+{
+    /* Return the JSON representation of a str dict key */
+    PyObject *encoded;
+
+    /* Once the cache is full, the keys are too varied for lookups to
+       pay off, so stop using it. */
+    if (s->key_cache == NULL || !PyUnicode_CheckExact(key) ||
+        PyDict_GET_SIZE(s->key_cache) >= ENCODER_KEY_CACHE_SIZE)
+    {
+        return encoder_encode_string(s, key);
+    }
+    if (PyDict_GetItemRef(s->key_cache, key, &encoded) != 0) {
+        return encoded;
+    }
+    encoded = encoder_encode_string(s, key);
+    if (encoded != NULL && PyDict_SetItem(s->key_cache, key, encoded) < 0) {
+        Py_CLEAR(encoded);
+    }
+    return encoded;
+}
+
 static int
 _steal_accumulate(PyUnicodeWriter *writer, PyObject *stolen)
 {
@@ -1617,7 +1699,7 @@ encoder_encode_key_value(PyEncoderObject *s, PyUnicodeWriter *writer, bool *firs
         }
     }
 
-    encoded = encoder_encode_string(s, keystr);
+    encoded = encoder_encode_key(s, keystr);
     Py_DECREF(keystr);
     if (encoded == NULL) {
         return -1;
@@ -1841,6 +1923,7 @@ encoder_traverse(PyObject *op, visitproc visit, void *arg)
     Py_VISIT(self->indent);
     Py_VISIT(self->key_separator);
     Py_VISIT(self->item_separator);
+    Py_VISIT(self->key_cache);
     return 0;
 }
 
@@ -1855,6 +1938,7 @@ encoder_clear(PyObject *op)
     Py_CLEAR(self->indent);
     Py_CLEAR(self->key_separator);
     Py_CLEAR(self->item_separator);
+    Py_CLEAR(self->key_cache);
     return 0;
 }
 
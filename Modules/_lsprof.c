@@ -5,13 +5,12 @@
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_SetProfile()
+#include "pycore_hashtable.h"     // _Py_hashtable_t
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_time.h"          // _PyTime_FromLong()
 #include "pycore_typeobject.h"    // _PyType_GetModuleState()
 #include "pycore_unicodeobject.h" // _PyUnicode_EqualToASCIIString()
 
-#include "rotatingtree.h"
-
 /************************************************************/
 /* Written by Brett Rosen and Ted Czotter */
 
@@ -19,7 +18,6 @@ struct _ProfilerEntry;
 
 /* represents a function called from another function */
 typedef struct _ProfilerSubEntry {
-    rotating_node_t header;
     PyTime_t tt;
     PyTime_t it;
     long callcount;
@@ -29,14 +27,15 @@ typedef struct _ProfilerSubEntry {
 
 /* represents a function or user defined block */
 typedef struct _ProfilerEntry {
-    rotating_node_t header;
+    void *key; /* PyCodeObject or PyMethodDef pointer */
     PyObject *userObj; /* PyCodeObject, or a descriptive str for builtins */
     PyTime_t tt; /* total time in this entry */
     PyTime_t it; /* inline time in this entry (not in subcalls) */
     long callcount; /* how many times this was called */
     long recursivecallcount; /* how many times called recursively */
     long recursionLevel;
-    rotating_node_t *calls;
+    /* ProfilerEntry of the callee -> ProfilerSubEntry, or NULL */
+    _Py_hashtable_t *calls;
 } ProfilerEntry;
 
 typedef struct _ProfilerContext {
@@ -44,11 +43,13 @@ typedef struct _ProfilerContext {
     PyTime_t subt;
     struct _ProfilerContext *previous;
     ProfilerEntry *ctxEntry;
+    ProfilerSubEntry *subEntry; /* ctxEntry in its caller's calls, or NULL */
 } ProfilerContext;
 
 typedef struct {
     PyObject_HEAD
-    rotating_node_t *profilerEntries;
+    /* key -> ProfilerEntry, or NULL */
+    _Py_hashtable_t *profilerEntries;
     ProfilerContext *currentProfilerContext;
     ProfilerContext *freelistProfilerContext;
     int flags;
@@ -211,10 +212,36 @@ normalizeUserObj(PyObject *obj)
     }
 }
 
+static void
+freeEntry(void *ptr)
+{
+    ProfilerEntry *entry = (ProfilerEntry*) ptr;
+    if (entry->calls != NULL) {
+        _Py_hashtable_destroy(entry->calls);
+    }
+    Py_DECREF(entry->userObj);
+    PyMem_Free(entry);
+}
+
+static _Py_hashtable_t *
+newEntryTable(_Py_hashtable_destroy_func value_destroy_func)
+{
+    return _Py_hashtable_new_full(_Py_hashtable_hash_ptr,
+                                  _Py_hashtable_compare_direct,
+                                  NULL, value_destroy_func, NULL);
+}
+
 static ProfilerEntry*
 newProfilerEntry(ProfilerObject *pObj, void *key, PyObject *userObj)
 {
     ProfilerEntry *self;
+    if (pObj->profilerEntries == NULL) {
+        pObj->profilerEntries = newEntryTable(freeEntry);
+        if (pObj->profilerEntries == NULL) {
+            pObj->flags |= POF_NOMEMORY;
+            return NULL;
+        }
+    }
     self = (ProfilerEntry*) PyMem_Malloc(sizeof(ProfilerEntry));
     if (self == NULL) {
         pObj->flags |= POF_NOMEMORY;
@@ -227,70 +254,76 @@ newProfilerEntry(ProfilerObject *pObj, void *key, PyObject *userObj)
         pObj->flags |= POF_NOMEMORY;
         return NULL;
     }
-    self->header.key = key;
+    self->key = key;
     self->userObj = userObj;
     self->tt = 0;
     self->it = 0;
     self->callcount = 0;
     self->recursivecallcount = 0;
     self->recursionLevel = 0;
-    self->calls = EMPTY_ROTATING_TREE;
-    RotatingTree_Add(&pObj->profilerEntries, &self->header);
+    self->calls = NULL;
+    if (_Py_hashtable_set(pObj->profilerEntries, key, self) < 0) {
+        Py_DECREF(userObj);
+        PyMem_Free(self);
+        pObj->flags |= POF_NOMEMORY;
+        return NULL;
+    }
     return self;
 }
 
 static ProfilerEntry*
 getEntry(ProfilerObject *pObj, void *key)
 {
-    return (ProfilerEntry*) RotatingTree_Get(&pObj->profilerEntries, key);
+    if (pObj->profilerEntries == NULL) {
+        return NULL;
+    }
+    return (ProfilerEntry*) _Py_hashtable_get(pObj->profilerEntries, key);
 }
 
 static ProfilerSubEntry *
 getSubEntry(ProfilerObject *pObj, ProfilerEntry *caller, ProfilerEntry* entry)
 {
-    return (ProfilerSubEntry*) RotatingTree_Get(&caller->calls,
-                                                (void *)entry);
+    if (caller->calls == NULL) {
+        return NULL;
+    }
+    return (ProfilerSubEntry*) _Py_hashtable_get(caller->calls, entry);
 }
 
 static ProfilerSubEntry *
 newSubEntry(ProfilerObject *pObj,  ProfilerEntry *caller, ProfilerEntry* entry)
 {
     ProfilerSubEntry *self;
+    if (caller->calls == NULL) {
+        caller->calls = newEntryTable(PyMem_Free);
+        if (caller->calls == NULL) {
+            pObj->flags |= POF_NOMEMORY;
+            return NULL;
+        }
+    }
     self = (ProfilerSubEntry*) PyMem_Malloc(sizeof(ProfilerSubEntry));
     if (self == NULL) {
         pObj->flags |= POF_NOMEMORY;
         return NULL;
     }
-    self->header.key = (void *)entry;
     self->tt = 0;
     self->it = 0;
     self->callcount = 0;
     self->recursivecallcount = 0;
     self->recursionLevel = 0;
-    RotatingTree_Add(&caller->calls, &self->header);
+    if (_Py_hashtable_set(caller->calls, entry, self) < 0) {
+        PyMem_Free(self);
+        pObj->flags |= POF_NOMEMORY;
+        return NULL;
+    }
     return self;
 }
 
-static int freeSubEntry(rotating_node_t *header, void *arg)
-{
-    ProfilerSubEntry *subentry = (ProfilerSubEntry*) header;
-    PyMem_Free(subentry);
-    return 0;
-}
-
-static int freeEntry(rotating_node_t *header, void *arg)
-{
-    ProfilerEntry *entry = (ProfilerEntry*) header;
-    RotatingTree_Enum(entry->calls, freeSubEntry, NULL);
-    Py_DECREF(entry->userObj);
-    PyMem_Free(entry);
-    return 0;
-}
-
 static void clearEntries(ProfilerObject *pObj)
 {
-    RotatingTree_Enum(pObj->profilerEntries, freeEntry, NULL);
-    pObj->profilerEntries = EMPTY_ROTATING_TREE;
+    if (pObj->profilerEntries != NULL) {
+        _Py_hashtable_destroy(pObj->profilerEntries);
+        pObj->profilerEntries = NULL;
+    }
     /* release the memory hold by the ProfilerContexts */
     if (pObj->currentProfilerContext) {
         PyMem_Free(pObj->currentProfilerContext);
@@ -310,6 +343,7 @@ initContext(ProfilerObject *pObj, ProfilerContext *self, ProfilerEntry *entry)
     self->ctxEntry = entry;
     self->subt = 0;
     self->previous = pObj->currentProfilerContext;
+    self->subEntry = NULL;
     pObj->currentProfilerContext = self;
     ++entry->recursionLevel;
     if ((pObj->flags & POF_SUBCALLS) && self->previous) {
@@ -320,6 +354,8 @@ initContext(ProfilerObject *pObj, ProfilerContext *self, ProfilerEntry *entry)
             subentry = newSubEntry(pObj, caller, entry);
         if (subentry)
             ++subentry->recursionLevel;
+        /* remember it for Stop() */
+        self->subEntry = subentry;
     }
     self->t0 = call_timer(pObj);
 }
@@ -339,9 +375,12 @@ Stop(ProfilerObject *pObj, ProfilerContext *self, ProfilerEntry *entry)
     entry->it += it;
     entry->callcount++;
     if ((pObj->flags & POF_SUBCALLS) && self->previous) {
-        /* find or create an entry for me in my caller's entry */
-        ProfilerEntry *caller = self->previous->ctxEntry;
-        ProfilerSubEntry *subentry = getSubEntry(pObj, caller, entry);
+        /* find the entry for me in my caller's entry */
+        ProfilerSubEntry *subentry = self->subEntry;
+        if (subentry == NULL || entry != self->ctxEntry) {
+            ProfilerEntry *caller = self->previous->ctxEntry;
+            subentry = getSubEntry(pObj, caller, entry);
+        }
         if (subentry) {
             if (--subentry->recursionLevel == 0)
                 subentry->tt += tt;
@@ -357,7 +396,8 @@ static void
 ptrace_enter_call(PyObject *self, void *key, PyObject *userObj)
 {
     /* entering a call to the function identified by 'key'
-       (which can be a PyCodeObject or a PyMethodDef pointer) */
+       (which can be a PyCodeObject or a PyMethodDef pointer);
+       'userObj' may be NULL if there is already an entry for it */
     ProfilerObject *pObj = (ProfilerObject*)self;
     ProfilerEntry *profEntry;
     ProfilerContext *pContext;
@@ -407,7 +447,10 @@ ptrace_leave_call(PyObject *self, void *key)
     pContext = pObj->currentProfilerContext;
     if (pContext == NULL)
         return;
-    profEntry = getEntry(pObj, key);
+    /* usually we are leaving the function of the current context */
+    profEntry = pContext->ctxEntry;
+    if (profEntry == NULL || profEntry->key != key)
+        profEntry = getEntry(pObj, key);
     if (profEntry) {
         Stop(pObj, pContext, profEntry);
     }
@@ -473,11 +516,12 @@ typedef struct {
     _lsprof_state *state;
 } statscollector_t;
 
-static int statsForSubEntry(rotating_node_t *node, void *arg)
+static int statsForSubEntry(_Py_hashtable_t *ht, const void *key,
+                            const void *value, void *arg)
 {
-    ProfilerSubEntry *sentry = (ProfilerSubEntry*) node;
+    ProfilerSubEntry *sentry = (ProfilerSubEntry*) value;
     statscollector_t *collect = (statscollector_t*) arg;
-    ProfilerEntry *entry = (ProfilerEntry*) sentry->header.key;
+    ProfilerEntry *entry = (ProfilerEntry*) key;
     int err;
     PyObject *sinfo;
     sinfo = PyObject_CallFunction((PyObject*) collect->state->stats_subentry_type,
@@ -494,21 +538,22 @@ static int statsForSubEntry(rotating_node_t *node, void *arg)
     return err;
 }
 
-static int statsForEntry(rotating_node_t *node, void *arg)
+static int statsForEntry(_Py_hashtable_t *ht, const void *key,
+                         const void *value, void *arg)
 {
-    ProfilerEntry *entry = (ProfilerEntry*) node;
+    ProfilerEntry *entry = (ProfilerEntry*) value;
     statscollector_t *collect = (statscollector_t*) arg;
     PyObject *info;
     int err;
     if (entry->callcount == 0)
         return 0;   /* skip */
 
-    if (entry->calls != EMPTY_ROTATING_TREE) {
+    if (entry->calls != NULL) {
         collect->sublist = PyList_New(0);
         if (collect->sublist == NULL)
             return -1;
-        if (RotatingTree_Enum(entry->calls,
-                              statsForSubEntry, collect) != 0) {
+        if (_Py_hashtable_foreach(entry->calls,
+                                  statsForSubEntry, collect) != 0) {
             Py_DECREF(collect->sublist);
             return -1;
         }
@@ -583,8 +628,9 @@ _lsprof_Profiler_getstats_impl(ProfilerObject *self, PyTypeObject *cls)
     collect.list = PyList_New(0);
     if (collect.list == NULL)
         return NULL;
-    if (RotatingTree_Enum(self->profilerEntries, statsForEntry, &collect)
-        != 0) {
+    if (self->profilerEntries != NULL &&
+        _Py_hashtable_foreach(self->profilerEntries, statsForEntry,
+                              &collect) != 0) {
         Py_DECREF(collect.list);
         return NULL;
     }
@@ -702,6 +748,26 @@ PyObject* get_cfunc_from_callable(PyObject* callable, PyObject* self_arg, PyObje
     return NULL;
 }
 
+/* Return the PyMethodDef of the function get_cfunc_from_callable() would
+   return, without creating a bound method: it is the key of the entry. */
+static PyMethodDef *
+get_cfunc_method_def(PyObject *callable, PyObject *self_arg, PyObject *missing)
+{
+    if (PyCFunction_Check(callable)) {
+        return ((PyCFunctionObject *)callable)->m_ml;
+    }
+    if (Py_TYPE(callable) == &PyMethodDescr_Type) {
+        PyMethodDescrObject *descr = (PyMethodDescrObject *)callable;
+        if (self_arg == missing ||
+            !PyObject_TypeCheck(self_arg, PyDescr_TYPE(descr)))
+        {
+            return NULL;
+        }
+        return descr->d_method;
+    }
+    return NULL;
+}
+
 /*[clinic input]
 _lsprof.Profiler._ccall_callback
 
@@ -720,6 +786,16 @@ _lsprof_Profiler__ccall_callback_impl(ProfilerObject *self, PyObject *code,
 /*[clinic end generated code: output=152db83cabd18cad input=0e66687cfb95c001]*/
 {
     if (self->flags & POF_BUILTINS) {
+        PyMethodDef *ml = get_cfunc_method_def(callable, self_arg,
+                                               self->missing);
+        if (ml == NULL) {
+            Py_RETURN_NONE;
+        }
+        if (getEntry(self, ml) != NULL) {
+            /* the function object is only needed to create the entry */
+            ptrace_enter_call((PyObject*)self, ml, NULL);
+            Py_RETURN_NONE;
+        }
         PyObject* cfunc = get_cfunc_from_callable(callable, self_arg, self->missing);
 
         if (cfunc) {
@@ -751,12 +827,10 @@ _lsprof_Profiler__creturn_callback_impl(ProfilerObject *self, PyObject *code,
 /*[clinic end generated code: output=1e886dde8fed8fb0 input=b18afe023746923a]*/
 {
     if (self->flags & POF_BUILTINS) {
-        PyObject* cfunc = get_cfunc_from_callable(callable, self_arg, self->missing);
-
-        if (cfunc) {
-            ptrace_leave_call((PyObject*)self,
-                              ((PyCFunctionObject *)cfunc)->m_ml);
-            Py_DECREF(cfunc);
+        PyMethodDef *ml = get_cfunc_method_def(callable, self_arg,
+                                               self->missing);
+        if (ml) {
+            ptrace_leave_call((PyObject*)self, ml);
         }
     }
     Py_RETURN_NONE;
@@ -657,10 +657,36 @@ _lzma_LZMACompressor_flush_impl(Compressor *self)
 
 static int
 Compressor_init_xz(_lzma_state *state, lzma_stream *lzs,
-                   int check, uint32_t preset, PyObject *filterspecs)
+                   int check, uint32_t preset, PyObject *filterspecs,
+                   uint32_t threads)
 {
     lzma_ret lzret;
 
+#ifdef HAVE_LZMA_STREAM_ENCODER_MT
+    if (threads != 1) {
+        lzma_filter filters[LZMA_FILTERS_MAX + 1];
+        lzma_mt mt = {0};
+
+        if (threads == 0) {
+            threads = lzma_cputhreads();
+            if (threads == 0) {
+                threads = 1;
+            }
+        }
+        mt.threads = threads;
+        mt.preset = preset;
+        mt.check = check;
+        if (filterspecs != Py_None) {
+            if (parse_filter_chain_spec(state, filters, filterspecs) == -1)
+                return -1;
+            mt.filters = filters;
+        }
+        lzret = lzma_stream_encoder_mt(lzs, &mt);
+        if (filterspecs != Py_None) {
+            free_filter_chain(filters);
+        }
+    } else
+#endif
     if (filterspecs == Py_None) {
         lzret = lzma_easy_encoder(lzs, preset, check);
     } else {
@@ -762,6 +788,11 @@ _lzma.LZMACompressor.__new__
         have an entry for "id" indicating the ID of the filter, plus
         additional entries for options to the filter.
 
+    *
+    threads: int = 1
+        The number of worker threads to use for FORMAT_XZ.  Zero
+        means one thread per processor core.
+
 Create a compressor object for compressing data incrementally.
 
 The settings used by the compressor can be specified either as a
@@ -776,23 +807,50 @@ For one-shot compression, use the compress() function instead.
 static PyObject *
 Compressor_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 {
-    static char *arg_names[] = {"format", "check", "preset", "filters", NULL};
+    static char *arg_names[] = {"format", "check", "preset", "filters",
+                                "threads", NULL};
     int format = FORMAT_XZ;
     int check = -1;
     uint32_t preset = LZMA_PRESET_DEFAULT;
     PyObject *preset_obj = Py_None;
     PyObject *filterspecs = Py_None;
+    int threads = 1;
     Compressor *self;
 
     _lzma_state *state = PyType_GetModuleState(type);
     assert(state != NULL);
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-                                     "|iiOO:LZMACompressor", arg_names,
+                                     "|iiOO$i:LZMACompressor", arg_names,
                                      &format, &check, &preset_obj,
-                                     &filterspecs)) {
+                                     &filterspecs, &threads)) {
         return NULL;
     }
 
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "threads must be a non-negative integer");
+        return NULL;
+    }
+
+    if (format != FORMAT_XZ && threads != 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multi-threaded compression is only supported "
+                        "by FORMAT_XZ");
+        return NULL;
+    }
+
+#ifndef HAVE_LZMA_STREAM_ENCODER_MT
+    /* liblzma was built without the multi-threaded encoder: "one thread
+       per core" degrades to the calling thread, more threads is an error. */
+    if (threads > 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multi-threaded compression is not supported "
+                        "by this build of liblzma");
+        return NULL;
+    }
+    threads = 1;
+#endif
+
     if (format != FORMAT_XZ && check != -1 && check != LZMA_CHECK_NONE) {
         PyErr_SetString(PyExc_ValueError,
                         "Integrity checks are only supported by FORMAT_XZ");
@@ -833,7 +891,8 @@ Compressor_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
             if (check == -1) {
                 check = LZMA_CHECK_CRC64;
             }
-            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs) != 0) {
+            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs,
+                                   (uint32_t)threads) != 0) {
                 goto error;
             }
             break;
@@ -890,7 +949,8 @@ Compressor_traverse(PyObject *self, visitproc visit, void *arg)
 }
 
 PyDoc_STRVAR(Compressor_doc,
-"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None)\n"
+"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None,\n"
+"               *, threads=1)\n"
 "\n"
 "Create a compressor object for compressing data incrementally.\n"
 "\n"
@@ -915,6 +975,12 @@ PyDoc_STRVAR(Compressor_doc,
 "have an entry for \"id\" indicating the ID of the filter, plus\n"
 "additional entries for options to the filter.\n"
 "\n"
+"threads is the number of worker threads to use for FORMAT_XZ. Zero\n"
+"means one thread per processor core. Multi-threaded compression\n"
+"splits the data into independently compressed blocks. It is not\n"
+"available if liblzma was built without it; threads=0 then uses the\n"
+"calling thread.\n"
+"\n"
 "For one-shot compression, use the compress() function instead.\n");
 
 static PyType_Slot lzma_compressor_type_slots[] = {
@@ -153,6 +153,143 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_multiprocessing_ring_put__doc__,
+"ring_put($module, shared, data, wait, /)\n"
+"--\n"
+"\n"
+"Append a message to the ring buffer in shared.\n"
+"\n"
+"Return None if there is no room for it, after setting the waiting flag of\n"
+"the producer if wait is true.  Otherwise return whether a consumer waits\n"
+"for the message and must be woken up.");
+
+#define _MULTIPROCESSING_RING_PUT_METHODDEF    \
+    {"ring_put", _PyCFunction_CAST(_multiprocessing_ring_put), METH_FASTCALL, _multiprocessing_ring_put__doc__},
+
+static PyObject *
+_multiprocessing_ring_put_impl(PyObject *module, Py_buffer *shared,
+                               Py_buffer *data, int wait);
+
+static PyObject *
+_multiprocessing_ring_put(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer shared = {NULL, NULL};
+    Py_buffer data = {NULL, NULL};
+    int wait;
+
+    if (!_PyArg_CheckPositional("ring_put", nargs, 3, 3)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &shared, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("ring_put", "argument 1", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    wait = PyObject_IsTrue(args[2]);
+    if (wait < 0) {
+        goto exit;
+    }
+    return_value = _multiprocessing_ring_put_impl(module, &shared, &data, wait);
+
+exit:
+    /* Cleanup for shared */
+    if (shared.obj) {
+       PyBuffer_Release(&shared);
+    }
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_multiprocessing_ring_get__doc__,
+"ring_get($module, shared, wait, /)\n"
+"--\n"
+"\n"
+"Remove the oldest message from the ring buffer in shared.\n"
+"\n"
+"Return None if there is no message, after setting the waiting flag of the\n"
+"consumer if wait is true.  Otherwise return a tuple of the message and of\n"
+"whether a producer waits for room and must be woken up.");
+
+#define _MULTIPROCESSING_RING_GET_METHODDEF    \
+    {"ring_get", _PyCFunction_CAST(_multiprocessing_ring_get), METH_FASTCALL, _multiprocessing_ring_get__doc__},
+
+static PyObject *
+_multiprocessing_ring_get_impl(PyObject *module, Py_buffer *shared, int wait);
+
+static PyObject *
+_multiprocessing_ring_get(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer shared = {NULL, NULL};
+    int wait;
+
+    if (!_PyArg_CheckPositional("ring_get", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &shared, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("ring_get", "argument 1", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    wait = PyObject_IsTrue(args[1]);
+    if (wait < 0) {
+        goto exit;
+    }
+    return_value = _multiprocessing_ring_get_impl(module, &shared, wait);
+
+exit:
+    /* Cleanup for shared */
+    if (shared.obj) {
+       PyBuffer_Release(&shared);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_multiprocessing_ring_empty__doc__,
+"ring_empty($module, shared, /)\n"
+"--\n"
+"\n"
+"Return whether the ring buffer in shared holds no message.");
+
+#define _MULTIPROCESSING_RING_EMPTY_METHODDEF    \
+    {"ring_empty", (PyCFunction)_multiprocessing_ring_empty, METH_O, _multiprocessing_ring_empty__doc__},
+
+static int
+_multiprocessing_ring_empty_impl(PyObject *module, Py_buffer *shared);
+
+static PyObject *
+_multiprocessing_ring_empty(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer shared = {NULL, NULL};
+    int _return_value;
+
+    if (PyObject_GetBuffer(arg, &shared, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("ring_empty", "argument", "read-write bytes-like object", arg);
+        goto exit;
+    }
+    _return_value = _multiprocessing_ring_empty_impl(module, &shared);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    /* Cleanup for shared */
+    if (shared.obj) {
+       PyBuffer_Release(&shared);
+    }
+
+    return return_value;
+}
+
 #ifndef _MULTIPROCESSING_CLOSESOCKET_METHODDEF
     #define _MULTIPROCESSING_CLOSESOCKET_METHODDEF
 #endif /* !defined(_MULTIPROCESSING_CLOSESOCKET_METHODDEF) */
@@ -164,4 +301,4 @@ exit:
 #ifndef _MULTIPROCESSING_SEND_METHODDEF
     #define _MULTIPROCESSING_SEND_METHODDEF
 #endif /* !defined(_MULTIPROCESSING_SEND_METHODDEF) */
-/*[clinic end generated code: output=73b4cb8428d816da input=a9049054013a1b77]*/
+/*[clinic end generated code: output=6037a68688bc0d22 input=a9049054013a1b77]*/
@@ -171,6 +171,198 @@ _multiprocessing_sem_unlink_impl(PyObject *module, const char *name)
     return _PyMp_sem_unlink(name);
 }
 
+/*
+ * Ring buffer in shared memory used by queues.SharedMemoryQueue
+ *
+ * A message is stored as its 32-bit length followed by its data, padded
+ * to a multiple of 8 bytes, and may wrap around the end of the buffer.
+ * head and tail are byte offsets which only grow: producers (serialized by
+ * the caller) own the tail and consumers (likewise serialized) own the
+ * head, so putting and getting need no lock between the two sides.
+ *
+ * A side which finds the buffer full or empty sets its waiting flag and
+ * checks again before it sleeps on a semaphore; the other side clears the
+ * flag after moving its offset and asks the caller to wake the sleeper.
+ * All the offset and flag accesses are sequentially consistent so that
+ * one of the two sides sees the other.
+ */
+
+typedef struct {
+    uint64_t head;
+    int producer_waiting;
+    char pad1[64 - sizeof(uint64_t) - sizeof(int)];
+    uint64_t tail;
+    int consumer_waiting;
+    char pad2[64 - sizeof(uint64_t) - sizeof(int)];
+} ring_header;
+
+#define RING_HEADER_SIZE ((Py_ssize_t)sizeof(ring_header))
+#define RING_ALIGN(n) (((n) + 7) & ~(uint64_t)7)
+
+static ring_header *
+ring_from_buffer(Py_buffer *shared, uint64_t *capacity)
+{
+    if (shared->len < RING_HEADER_SIZE + 8
+        || (uintptr_t)shared->buf % _Alignof(ring_header) != 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "invalid ring buffer");
+        return NULL;
+    }
+    *capacity = (uint64_t)(shared->len - RING_HEADER_SIZE) & ~(uint64_t)7;
+    return (ring_header *)shared->buf;
+}
+
+static void
+ring_copy_in(char *data, uint64_t capacity, uint64_t pos,
+             const char *src, uint64_t size)
+{
+    uint64_t first = Py_MIN(size, capacity - pos);
+    memcpy(data + pos, src, first);
+    memcpy(data, src + first, size - first);
+}
+
+static void
+ring_copy_out(const char *data, uint64_t capacity, uint64_t pos,
+              char *dst, uint64_t size)
+{
+    uint64_t first = Py_MIN(size, capacity - pos);
+    memcpy(dst, data + pos, first);
+    memcpy(dst + first, data, size - first);
+}
+
+/*[clinic input]
+_multiprocessing.ring_put
+
+    shared: Py_buffer(accept={rwbuffer})
+    data: Py_buffer
+    wait: bool
+    /
+
+Append a message to the ring buffer in shared.
+
+Return None if there is no room for it, after setting the waiting flag of
+the producer if wait is true.  Otherwise return whether a consumer waits
+for the message and must be woken up.
+[clinic start generated code]*/
+
+static PyObject *
+_multiprocessing_ring_put_impl(PyObject *module, Py_buffer *shared,
+                               Py_buffer *data, int wait)
+/*[clinic end generated code: output=f9663f682a92d045 input=1394736d60186211]*/
+{
+    uint64_t capacity;
+    ring_header *ring = ring_from_buffer(shared, &capacity);
+    if (ring == NULL) {
+        return NULL;
+    }
+    uint64_t need = RING_ALIGN(sizeof(uint32_t) + (uint64_t)data->len);
+    if ((uint64_t)data->len > UINT32_MAX || need > capacity) {
+        PyErr_Format(PyExc_ValueError,
+                     "message of %zd bytes does not fit in the buffer",
+                     data->len);
+        return NULL;
+    }
+    uint64_t tail = _Py_atomic_load_uint64(&ring->tail);
+    if (capacity - (tail - _Py_atomic_load_uint64(&ring->head)) < need) {
+        if (!wait) {
+            Py_RETURN_NONE;
+        }
+        _Py_atomic_store_int(&ring->producer_waiting, 1);
+        if (capacity - (tail - _Py_atomic_load_uint64(&ring->head)) < need) {
+            Py_RETURN_NONE;
+        }
+    }
+    char *buf = (char *)shared->buf + RING_HEADER_SIZE;
+    uint64_t pos = tail % capacity;
+    uint32_t size = (uint32_t)data->len;
+    /* pos and capacity are multiples of 8: the length never wraps */
+    memcpy(buf + pos, &size, sizeof(size));
+    ring_copy_in(buf, capacity, (pos + sizeof(size)) % capacity,
+                 data->buf, size);
+    _Py_atomic_store_uint64(&ring->tail, tail + need);
+    int wake = (_Py_atomic_load_int(&ring->consumer_waiting)
+                && _Py_atomic_exchange_int(&ring->consumer_waiting, 0));
+    return PyBool_FromLong(wake);
+}
+
+/*[clinic input]
+_multiprocessing.ring_get
+
+    shared: Py_buffer(accept={rwbuffer})
+    wait: bool
+    /
+
+Remove the oldest message from the ring buffer in shared.
+
+Return None if there is no message, after setting the waiting flag of the
+consumer if wait is true.  Otherwise return a tuple of the message and of
+whether a producer waits for room and must be woken up.
+[clinic start generated code]*/
+
+static PyObject *
+_multiprocessing_ring_get_impl(PyObject *module, Py_buffer *shared, int wait)
+/*[clinic end generated code: output=37dedb2c0ffa6207 input=5f43760a80a191ac]*/
+{
+    uint64_t capacity;
+    ring_header *ring = ring_from_buffer(shared, &capacity);
+    if (ring == NULL) {
+        return NULL;
+    }
+    uint64_t head = _Py_atomic_load_uint64(&ring->head);
+    uint64_t tail = _Py_atomic_load_uint64(&ring->tail);
+    if (head == tail) {
+        if (!wait) {
+            Py_RETURN_NONE;
+        }
+        _Py_atomic_store_int(&ring->consumer_waiting, 1);
+        tail = _Py_atomic_load_uint64(&ring->tail);
+        if (head == tail) {
+            Py_RETURN_NONE;
+        }
+    }
+    const char *buf = (const char *)shared->buf + RING_HEADER_SIZE;
+    uint64_t pos = head % capacity;
+    uint32_t size;
+    memcpy(&size, buf + pos, sizeof(size));
+    uint64_t need = RING_ALIGN(sizeof(size) + (uint64_t)size);
+    if (need > tail - head) {
+        PyErr_SetString(PyExc_RuntimeError, "corrupted ring buffer");
+        return NULL;
+    }
+    PyObject *message = PyBytes_FromStringAndSize(NULL, size);
+    if (message == NULL) {
+        return NULL;
+    }
+    ring_copy_out(buf, capacity, (pos + sizeof(size)) % capacity,
+                  PyBytes_AS_STRING(message), size);
+    _Py_atomic_store_uint64(&ring->head, head + need);
+    int wake = (_Py_atomic_load_int(&ring->producer_waiting)
+                && _Py_atomic_exchange_int(&ring->producer_waiting, 0));
+    return Py_BuildValue("(NO)", message, wake ? Py_True : Py_False);
+}
+
+/*[clinic input]
+_multiprocessing.ring_empty -> bool
+
+    shared: Py_buffer(accept={rwbuffer})
+    /
+
+Return whether the ring buffer in shared holds no message.
+[clinic start generated code]*/
+
+static int
+_multiprocessing_ring_empty_impl(PyObject *module, Py_buffer *shared)
+/*[clinic end generated code: output=bac117ce54b72086 input=643d42c4bb542dfc]*/
+{
+    uint64_t capacity;
+    ring_header *ring = ring_from_buffer(shared, &capacity);
+    if (ring == NULL) {
+        return -1;
+    }
+    return (_Py_atomic_load_uint64(&ring->head)
+            == _Py_atomic_load_uint64(&ring->tail));
+}
+
 /*
  * Function table
  */
@@ -184,6 +376,9 @@ static PyMethodDef module_methods[] = {
 #if !defined(POSIX_SEMAPHORES_NOT_ENABLED)
     _MULTIPROCESSING_SEM_UNLINK_METHODDEF
 #endif
+    _MULTIPROCESSING_RING_PUT_METHODDEF
+    _MULTIPROCESSING_RING_GET_METHODDEF
+    _MULTIPROCESSING_RING_EMPTY_METHODDEF
     {NULL}
 };
 
@@ -271,6 +466,11 @@ multiprocessing_exec(PyObject *module)
         return -1;
     }
 
+    if (PyModule_AddIntConstant(module, "RING_HEADER_SIZE",
+                                RING_HEADER_SIZE) < 0) {
+        return -1;
+    }
+
     return 0;
 }
 
@@ -1,4 +1,5 @@
 #include "Python.h"
+#include "pycore_list.h"          // _PyList_GetItemRef()
 #include "pycore_modsupport.h"    // _PyArg_NoKwnames()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
@@ -1145,6 +1146,13 @@ itemgetter_call_impl(itemgetterobject *ig, PyObject *obj)
             result = PyTuple_GET_ITEM(obj, ig->index);
             return Py_NewRef(result);
         }
+        if (ig->index >= 0 && PyList_CheckExact(obj)) {
+            result = _PyList_GetItemRef((PyListObject *)obj, ig->index);
+            if (result != NULL) {
+                return result;
+            }
+            // Out of range: let PyObject_GetItem() raise the IndexError.
+        }
         return PyObject_GetItem(obj, ig->item);
     }
 
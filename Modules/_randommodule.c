@@ -130,34 +130,33 @@ class _random.Random "RandomObject *" "_randomstate_type(type)->Random_Type"
 /* Random methods */
 
 
-/* generates a random number on [0,0xffffffff]-interval */
-static uint32_t
-genrand_uint32(RandomObject *self)
+/* generates the next N words of the state at one time */
+static void
+next_state(RandomObject *self)
 {
     uint32_t y;
     static const uint32_t mag01[2] = {0x0U, MATRIX_A};
     /* mag01[x] = x * MATRIX_A  for x=0,1 */
-    uint32_t *mt;
+    uint32_t *mt = self->state;
+    int kk;
 
-    mt = self->state;
-    if (self->index >= N) { /* generate N words at one time */
-        int kk;
-
-        for (kk=0;kk<N-M;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1U];
-        }
-        for (;kk<N-1;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1U];
-        }
-        y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
-        mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1U];
-
-        self->index = 0;
+    for (kk=0;kk<N-M;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1U];
+    }
+    for (;kk<N-1;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1U];
     }
+    y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
+    mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1U];
+
+    self->index = 0;
+}
 
-    y = mt[self->index++];
+static inline uint32_t
+temper(uint32_t y)
+{
     y ^= (y >> 11);
     y ^= (y << 7) & 0x9d2c5680U;
     y ^= (y << 15) & 0xefc60000U;
@@ -165,6 +164,35 @@ genrand_uint32(RandomObject *self)
     return y;
 }
 
+/* generates a random number on [0,0xffffffff]-interval */
+static uint32_t
+genrand_uint32(RandomObject *self)
+{
+    if (self->index >= N) {
+        next_state(self);
+    }
+    return temper(self->state[self->index++]);
+}
+
+/* same as calling genrand_uint32() n times */
+static void
+genrand_fill(RandomObject *self, uint32_t *out, Py_ssize_t n)
+{
+    while (n > 0) {
+        if (self->index >= N) {
+            next_state(self);
+        }
+        Py_ssize_t i, chunk = Py_MIN(n, N - self->index);
+        const uint32_t *mt = self->state + self->index;
+        for (i = 0; i < chunk; i++) {
+            out[i] = temper(mt[i]);
+        }
+        self->index += (int)chunk;
+        out += chunk;
+        n -= chunk;
+    }
+}
+
 /* random_random is the function named genrand_res53 in the original code;
  * generates a random number on [0,1) with 53-bit resolution; note that
  * 9007199254740992 == 2**53; I assume they're spelling "/2**53" as
@@ -507,8 +535,7 @@ static PyObject *
 _random_Random_getrandbits_impl(RandomObject *self, uint64_t k)
 /*[clinic end generated code: output=c30ef8435f3433cf input=64226ac13bb4d2a3]*/
 {
-    Py_ssize_t i, words;
-    uint32_t r;
+    Py_ssize_t words;
     uint32_t *wordarray;
     PyObject *result;
 
@@ -518,6 +545,14 @@ _random_Random_getrandbits_impl(RandomObject *self, uint64_t k)
     if (k <= 32)  /* Fast path */
         return PyLong_FromUnsignedLong(genrand_uint32(self) >> (32 - k));
 
+    if (k <= 64) {
+        /* Same bits as the general case below: the first word is the
+           least significant one. */
+        uint64_t lo = genrand_uint32(self);
+        uint64_t hi = genrand_uint32(self) >> (64 - k);
+        return PyLong_FromUnsignedLongLong((hi << 32) | lo);
+    }
+
     if ((k - 1u) / 32u + 1u > PY_SSIZE_T_MAX / 4u) {
         PyErr_NoMemory();
         return NULL;
@@ -531,17 +566,17 @@ _random_Random_getrandbits_impl(RandomObject *self, uint64_t k)
 
     /* Fill-out bits of long integer, by 32-bit words, from least significant
        to most significant. */
-#if PY_LITTLE_ENDIAN
-    for (i = 0; i < words; i++, k -= 32)
-#else
-    for (i = words - 1; i >= 0; i--, k -= 32)
-#endif
-    {
-        r = genrand_uint32(self);
-        if (k < 32)
-            r >>= (32 - k);  /* Drop least significant bits */
-        wordarray[i] = r;
+    genrand_fill(self, wordarray, words);
+    if (k % 32)
+        wordarray[words - 1] >>= (32 - k % 32);  /* Drop least significant bits */
+#if !PY_LITTLE_ENDIAN
+    /* Most significant word first */
+    for (Py_ssize_t i = 0; i < words / 2; i++) {
+        uint32_t r = wordarray[i];
+        wordarray[i] = wordarray[words - 1 - i];
+        wordarray[words - 1 - i] = r;
     }
+#endif
 
     result = _PyLong_FromByteArray((unsigned char *)wordarray, words * 4,
                                    PY_LITTLE_ENDIAN, 0 /* unsigned */);
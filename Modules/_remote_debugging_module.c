@@ -57,6 +57,9 @@
 #define SIZEOF_UNICODE_OBJ sizeof(PyUnicodeObject)
 #define SIZEOF_LONG_OBJ sizeof(PyLongObject)
 
+/* Size of the chunks used to read the table of a set of tasks */
+#define SET_TABLE_CHUNK_SIZE (64 * 1024)
+
 // Calculate the minimum buffer size needed to read interpreter state fields
 // We need to read code_object_generation and potentially tlbc_generation
 #ifndef MAX
@@ -1096,33 +1099,21 @@ parse_task(
 static int
 process_set_entry(
     RemoteUnwinderObject *unwinder,
-    uintptr_t table_ptr,
+    const char *entry,
     PyObject *awaited_by,
     int recurse_task
 ) {
-    uintptr_t key_addr;
-    if (read_py_ptr(unwinder, table_ptr, &key_addr)) {
-        set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read set entry key");
-        return -1;
-    }
+    // The first member of a set entry is the key
+    uintptr_t key_addr = GET_MEMBER_NO_TAG(uintptr_t, entry, 0);
 
     if ((void*)key_addr != NULL) {
-        Py_ssize_t ref_cnt;
-        if (read_Py_ssize_t(unwinder, table_ptr, &ref_cnt)) {
-            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read set entry reference count");
+        if (parse_task(unwinder, key_addr, awaited_by, recurse_task)) {
+            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to parse task in set entry");
             return -1;
         }
-
-        if (ref_cnt) {
-            // if 'ref_cnt=0' it's a set dummy marker
-            if (parse_task(unwinder, key_addr, awaited_by, recurse_task)) {
-                set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to parse task in set entry");
-                return -1;
-            }
-            return 1; // Successfully processed a valid entry
-        }
+        return 1; // Successfully processed a valid entry
     }
-    return 0; // Entry was NULL or dummy marker
+    return 0; // Entry was NULL
 }
 
 static int
@@ -1147,23 +1138,46 @@ parse_tasks_in_set(
     Py_ssize_t set_len = GET_MEMBER(Py_ssize_t, set_object, unwinder->debug_offsets.set_object.mask) + 1; // The set contains the `mask+1` element slots.
     uintptr_t table_ptr = GET_MEMBER(uintptr_t, set_object, unwinder->debug_offsets.set_object.table);
 
+    // Read the table in chunks rather than entry by entry: the table of a
+    // large set spans many pages which are only read once.
+    const size_t entry_size = sizeof(void*) * 2;
+    const Py_ssize_t chunk_len = SET_TABLE_CHUNK_SIZE / entry_size;
+    char *chunk = PyMem_RawMalloc(SET_TABLE_CHUNK_SIZE);
+    if (chunk == NULL) {
+        PyErr_NoMemory();
+        set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate set table buffer");
+        return -1;
+    }
+
     Py_ssize_t i = 0;
     Py_ssize_t els = 0;
     while (i < set_len && els < num_els) {
-        int result = process_set_entry(unwinder, table_ptr, awaited_by, recurse_task);
-
-        if (result < 0) {
-            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to process set entry");
-            return -1;
+        Py_ssize_t n = Py_MIN(chunk_len, set_len - i);
+        if (_Py_RemoteDebug_ReadRemoteMemory(&unwinder->handle,
+                                             table_ptr + i * entry_size,
+                                             n * entry_size, chunk) < 0) {
+            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read set table");
+            goto error;
         }
-        if (result > 0) {
-            els++;
+        for (Py_ssize_t j = 0; j < n && els < num_els; j++) {
+            int result = process_set_entry(unwinder, chunk + j * entry_size,
+                                           awaited_by, recurse_task);
+            if (result < 0) {
+                set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to process set entry");
+                goto error;
+            }
+            if (result > 0) {
+                els++;
+            }
         }
-
-        table_ptr += sizeof(void*) * 2;
-        i++;
+        i += n;
     }
+    PyMem_RawFree(chunk);
     return 0;
+
+error:
+    PyMem_RawFree(chunk);
+    return -1;
 }
 
 
@@ -2271,7 +2285,7 @@ append_awaited_by_for_thread(
     }
 
     size_t iteration_count = 0;
-    const size_t MAX_ITERATIONS = 2 << 15;  // A reasonable upper bound
+    const size_t MAX_ITERATIONS = 1 << 24;  // A reasonable upper bound
 
     while (GET_MEMBER(uintptr_t, task_node, unwinder->debug_offsets.llist_node.next) != head_addr) {
         if (++iteration_count > MAX_ITERATIONS) {
@@ -2664,6 +2678,8 @@ _remote_debugging_RemoteUnwinder_get_stack_trace_impl(RemoteUnwinderObject *self
 /*[clinic end generated code: output=666192b90c69d567 input=f756f341206f9116]*/
 {
     PyObject* result = NULL;
+    // Each call takes a fresh snapshot of the remote memory
+    _Py_RemoteDebug_ClearCache(&self->handle);
     // Read interpreter state into opaque buffer
     char interp_state_buffer[INTERP_STATE_BUFFER_SIZE];
     if (_Py_RemoteDebug_PagedReadRemoteMemory(
@@ -2813,6 +2829,7 @@ static PyObject *
 _remote_debugging_RemoteUnwinder_get_all_awaited_by_impl(RemoteUnwinderObject *self)
 /*[clinic end generated code: output=6a49cd345e8aec53 input=a452c652bb00701a]*/
 {
+    _Py_RemoteDebug_ClearCache(&self->handle);
     if (!self->async_debug_offsets_available) {
         PyErr_SetString(PyExc_RuntimeError, "AsyncioDebug section not available");
         set_exception_cause(self, PyExc_RuntimeError, "AsyncioDebug section unavailable in get_all_awaited_by");
@@ -2923,6 +2940,7 @@ static PyObject *
 _remote_debugging_RemoteUnwinder_get_async_stack_trace_impl(RemoteUnwinderObject *self)
 /*[clinic end generated code: output=6433d52b55e87bbe input=11b7150c59d4c60f]*/
 {
+    _Py_RemoteDebug_ClearCache(&self->handle);
     if (!self->async_debug_offsets_available) {
         PyErr_SetString(PyExc_RuntimeError, "AsyncioDebug section not available");
         set_exception_cause(self, PyExc_RuntimeError, "AsyncioDebug section unavailable in get_async_stack_trace");
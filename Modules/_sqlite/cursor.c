@@ -338,9 +338,10 @@ _pysqlite_fetch_one_row(pysqlite_Cursor* self)
     const char* colname;
     PyObject* error_msg;
 
-    Py_BEGIN_ALLOW_THREADS
+    /* sqlite3_data_count() and sqlite3_column_type() only read the
+       current row, which sqlite3_step() has already produced, so they are
+       called without releasing the GIL. */
     numcols = sqlite3_data_count(self->statement->st);
-    Py_END_ALLOW_THREADS
 
     row = PyTuple_New(numcols);
     if (!row)
@@ -383,9 +384,7 @@ _pysqlite_fetch_one_row(pysqlite_Cursor* self)
                 Py_DECREF(item);
             }
         } else {
-            Py_BEGIN_ALLOW_THREADS
             coltype = sqlite3_column_type(self->statement->st, i);
-            Py_END_ALLOW_THREADS
             if (coltype == SQLITE_NULL) {
                 converted = Py_NewRef(Py_None);
             } else if (coltype == SQLITE_INTEGER) {
@@ -628,8 +627,9 @@ need_adapt(pysqlite_state *state, PyObject *obj)
         return 1;
     }
 
-    if (PyLong_CheckExact(obj) || PyFloat_CheckExact(obj)
-          || PyUnicode_CheckExact(obj) || PyByteArray_CheckExact(obj)) {
+    if (obj == Py_None || PyLong_CheckExact(obj) || PyFloat_CheckExact(obj)
+          || PyUnicode_CheckExact(obj) || PyBytes_CheckExact(obj)
+          || PyByteArray_CheckExact(obj)) {
         return 0;
     } else {
         return 1;
@@ -648,9 +648,7 @@ bind_parameters(pysqlite_state *state, pysqlite_Statement *self,
     int num_params_needed;
     Py_ssize_t num_params;
 
-    Py_BEGIN_ALLOW_THREADS
     num_params_needed = sqlite3_bind_parameter_count(self->st);
-    Py_END_ALLOW_THREADS
 
     if (PyTuple_CheckExact(parameters) || PyList_CheckExact(parameters) || (!PyDict_Check(parameters) && PySequence_Check(parameters))) {
         /* parameters passed as sequence */
@@ -722,9 +720,7 @@ bind_parameters(pysqlite_state *state, pysqlite_Statement *self,
     } else if (PyDict_Check(parameters)) {
         /* parameters passed as dictionary */
         for (i = 1; i <= num_params_needed; i++) {
-            Py_BEGIN_ALLOW_THREADS
             binding_name = sqlite3_bind_parameter_name(self->st, i);
-            Py_END_ALLOW_THREADS
             if (!binding_name) {
                 PyErr_Format(state->ProgrammingError,
                              "Binding %d has no name, but you supplied a "
@@ -777,8 +773,8 @@ bind_parameters(pysqlite_state *state, pysqlite_Statement *self,
 PyObject *
 _pysqlite_query_execute(pysqlite_Cursor* self, int multiple, PyObject* operation, PyObject* second_argument)
 {
-    PyObject* parameters_list = NULL;
     PyObject* parameters_iter = NULL;
+    PyObject* parameters_once = NULL;
     PyObject* parameters = NULL;
     int i;
     int rc;
@@ -802,30 +798,13 @@ _pysqlite_query_execute(pysqlite_Cursor* self, int multiple, PyObject* operation
                 goto error;
             }
         }
-    } else {
-        parameters_list = PyList_New(0);
-        if (!parameters_list) {
-            goto error;
-        }
-
-        if (second_argument == NULL) {
-            second_argument = PyTuple_New(0);
-            if (!second_argument) {
-                goto error;
-            }
-        } else {
-            Py_INCREF(second_argument);
-        }
-        if (PyList_Append(parameters_list, second_argument) != 0) {
-            Py_DECREF(second_argument);
-            goto error;
-        }
-        Py_DECREF(second_argument);
-
-        parameters_iter = PyObject_GetIter(parameters_list);
-        if (!parameters_iter) {
+    } else if (second_argument == NULL) {
+        parameters_once = PyTuple_New(0);
+        if (!parameters_once) {
             goto error;
         }
+    } else {
+        parameters_once = Py_NewRef(second_argument);
     }
 
     /* reset description */
@@ -875,7 +854,14 @@ _pysqlite_query_execute(pysqlite_Cursor* self, int multiple, PyObject* operation
 
     assert(!sqlite3_stmt_busy(self->statement->st));
     while (1) {
-        parameters = PyIter_Next(parameters_iter);
+        if (multiple) {
+            parameters = PyIter_Next(parameters_iter);
+        }
+        else {
+            /* execute() runs the statement once with the given parameters */
+            parameters = parameters_once;
+            parameters_once = NULL;
+        }
         if (!parameters) {
             break;
         }
@@ -906,9 +892,7 @@ _pysqlite_query_execute(pysqlite_Cursor* self, int multiple, PyObject* operation
         }
 
         assert(rc == SQLITE_ROW || rc == SQLITE_DONE);
-        Py_BEGIN_ALLOW_THREADS
         numcols = sqlite3_column_count(self->statement->st);
-        Py_END_ALLOW_THREADS
         if (self->description == Py_None && numcols > 0) {
             Py_SETREF(self->description, PyTuple_New(numcols));
             if (!self->description) {
@@ -959,7 +943,7 @@ _pysqlite_query_execute(pysqlite_Cursor* self, int multiple, PyObject* operation
 error:
     Py_XDECREF(parameters);
     Py_XDECREF(parameters_iter);
-    Py_XDECREF(parameters_list);
+    Py_XDECREF(parameters_once);
 
     self->locked = 0;
 
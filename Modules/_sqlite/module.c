@@ -119,7 +119,8 @@ pysqlite_register_adapter_impl(PyObject *module, PyTypeObject *type,
     /* a basic type is adapted; there's a performance optimization if that's not the case
      * (99 % of all usages) */
     if (type == &PyLong_Type || type == &PyFloat_Type
-            || type == &PyUnicode_Type || type == &PyByteArray_Type) {
+            || type == &PyUnicode_Type || type == &PyBytes_Type
+            || type == &PyByteArray_Type || type == Py_TYPE(Py_None)) {
         pysqlite_state *state = pysqlite_get_state(module);
         state->BaseTypeAdapted = 1;
     }
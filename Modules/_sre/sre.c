@@ -241,7 +241,8 @@ static void
 data_stack_dealloc(SRE_STATE* state)
 {
     if (state->data_stack) {
-        PyMem_Free(state->data_stack);
+        if (state->data_stack != (char *)state->small_data_stack)
+            PyMem_Free(state->data_stack);
         state->data_stack = NULL;
     }
     state->data_stack_size = state->data_stack_base = 0;
@@ -256,9 +257,22 @@ data_stack_grow(SRE_STATE* state, Py_ssize_t size)
     cursize = state->data_stack_size;
     if (cursize < minsize) {
         void* stack;
+        if (state->data_stack == NULL &&
+            (size_t)minsize <= sizeof(state->small_data_stack))
+        {
+            state->data_stack = (char *)state->small_data_stack;
+            state->data_stack_size = sizeof(state->small_data_stack);
+            return 0;
+        }
         cursize = minsize+minsize/4+1024;
         TRACE(("allocate/grow stack %zd\n", cursize));
-        stack = PyMem_Realloc(state->data_stack, cursize);
+        if (state->data_stack == (char *)state->small_data_stack) {
+            stack = PyMem_Malloc(cursize);
+            if (stack)
+                memcpy(stack, state->data_stack, state->data_stack_size);
+        }
+        else
+            stack = PyMem_Realloc(state->data_stack, cursize);
         if (!stack) {
             data_stack_dealloc(state);
             return SRE_ERROR_MEMORY;
@@ -545,12 +559,16 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     int isbytes, charsize;
     const void* ptr;
 
-    memset(state, 0, sizeof(SRE_STATE));
+    memset(state, 0, offsetof(SRE_STATE, small_mark));
 
-    state->mark = PyMem_New(const void *, pattern->groups * 2);
-    if (!state->mark) {
-        PyErr_NoMemory();
-        goto err;
+    if (pattern->groups * 2 <= SRE_SMALL_MARKS)
+        state->mark = state->small_mark;
+    else {
+        state->mark = PyMem_New(const void *, pattern->groups * 2);
+        if (!state->mark) {
+            PyErr_NoMemory();
+            goto err;
+        }
     }
     state->lastmark = -1;
     state->lastindex = -1;
@@ -607,7 +625,8 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     /* We add an explicit cast here because MSVC has a bug when
        compiling C code where it believes that `const void**` cannot be
        safely casted to `void*`, see bpo-39943 for details. */
-    PyMem_Free((void*) state->mark);
+    if (state->mark != state->small_mark)
+        PyMem_Free((void*) state->mark);
     state->mark = NULL;
     if (state->buffer.buf)
         PyBuffer_Release(&state->buffer);
@@ -622,7 +641,8 @@ state_fini(SRE_STATE* state)
     Py_XDECREF(state->string);
     data_stack_dealloc(state);
     /* See above PyMem_Free() for why we explicitly cast here. */
-    PyMem_Free((void*) state->mark);
+    if (state->mark != state->small_mark)
+        PyMem_Free((void*) state->mark);
     state->mark = NULL;
     /* SRE_REPEAT pool */
     repeat_pool_clear(state);
@@ -1234,6 +1254,7 @@ pattern_subx(_sremodulestate* module_state,
     PyObject* item;
     PyObject* filter;
     PyObject* match;
+    PyUnicodeWriter* writer = NULL;
     const void* ptr;
     Py_ssize_t status;
     Py_ssize_t n;
@@ -1317,6 +1338,27 @@ pattern_subx(_sremodulestate* module_state,
         b = STATE_OFFSET(&state, state.start);
         e = STATE_OFFSET(&state, state.ptr);
 
+        if (filter_type == LITERAL && !state.isbytes &&
+            PyUnicode_Check(filter))
+        {
+            /* literal replacement in a str: write the segments and the
+               replacement directly instead of collecting slices */
+            if (writer == NULL) {
+                writer = PyUnicodeWriter_Create(state.endpos);
+                if (writer == NULL)
+                    goto error;
+            }
+            if (PyUnicodeWriter_WriteSubstring(writer, string, i, b) < 0 ||
+                PyUnicodeWriter_WriteSubstring(writer, filter, 0,
+                        PyUnicode_GET_LENGTH(filter)) < 0)
+                goto error;
+            i = e;
+            n = n + 1;
+            state.must_advance = (state.ptr == state.start);
+            state.start = state.ptr;
+            continue;
+        }
+
         if (i < b) {
             /* get segment before this match */
             item = getslice(state.isbytes, state.beginning,
@@ -1365,6 +1407,24 @@ pattern_subx(_sremodulestate* module_state,
         state.start = state.ptr;
     }
 
+    if (writer != NULL) {
+        assert(PyList_GET_SIZE(list) == 0);
+        Py_DECREF(list);
+        state_fini(&state);
+        Py_DECREF(filter);
+        if (PyUnicodeWriter_WriteSubstring(writer, string, i,
+                                           state.endpos) < 0) {
+            PyUnicodeWriter_Discard(writer);
+            return NULL;
+        }
+        item = PyUnicodeWriter_Finish(writer);
+        if (!item)
+            return NULL;
+        if (subn)
+            return Py_BuildValue("Nn", item, n);
+        return item;
+    }
+
     /* get segment following last match */
     if (i < state.endpos) {
         item = getslice(state.isbytes, state.beginning,
@@ -1408,6 +1468,7 @@ pattern_subx(_sremodulestate* module_state,
     return item;
 
 error:
+    PyUnicodeWriter_Discard(writer);
     Py_DECREF(list);
     state_fini(&state);
     Py_DECREF(filter);
@@ -2008,8 +2069,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
             {
                 /* A minimal info field is
                    <INFO> <1=skip> <2=flags> <3=min> <4=max>;
-                   If SRE_INFO_PREFIX or SRE_INFO_CHARSET is in the flags,
-                   more follows. */
+                   If SRE_INFO_REQUIRED, SRE_INFO_PREFIX or SRE_INFO_CHARSET
+                   is in the flags, more follows. */
                 SRE_CODE flags, i;
                 SRE_CODE *newcode;
                 GET_SKIP;
@@ -2020,7 +2081,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 /* Check that only valid flags are present */
                 if ((flags & ~(SRE_INFO_PREFIX |
                                SRE_INFO_LITERAL |
-                               SRE_INFO_CHARSET)) != 0)
+                               SRE_INFO_CHARSET |
+                               SRE_INFO_REQUIRED)) != 0)
                     FAIL;
                 /* PREFIX and CHARSET are mutually exclusive */
                 if ((flags & SRE_INFO_PREFIX) &&
@@ -2030,6 +2092,22 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 if ((flags & SRE_INFO_LITERAL) &&
                     !(flags & SRE_INFO_PREFIX))
                     FAIL;
+                /* PREFIX and REQUIRED are mutually exclusive */
+                if ((flags & SRE_INFO_PREFIX) &&
+                    (flags & SRE_INFO_REQUIRED))
+                    FAIL;
+                /* Validate the required literal */
+                if (flags & SRE_INFO_REQUIRED) {
+                    SRE_CODE required_len;
+                    GET_ARG; required_len = arg;
+                    if (required_len == 0)
+                        FAIL;
+                    GET_ARG;
+                    /* Here comes the literal */
+                    if (required_len > (uintptr_t)(newcode - code))
+                        FAIL;
+                    code += required_len;
+                }
                 /* Validate the prefix */
                 if (flags & SRE_INFO_PREFIX) {
                     SRE_CODE prefix_len;
@@ -24,6 +24,11 @@
 # define SRE_MAXGROUPS ((SRE_CODE)PY_SSIZE_T_MAX / SIZEOF_VOID_P / 2)
 #endif
 
+/* sizes of the buffers in SRE_STATE that are used instead of allocating
+   memory for patterns with few groups and little backtracking */
+#define SRE_SMALL_MARKS 16
+#define SRE_SMALL_DATA_STACK 64
+
 typedef struct {
     PyObject_VAR_HEAD
     Py_ssize_t groups; /* must be first! */
@@ -111,6 +116,10 @@ typedef struct {
     int fail_after_count;
     PyObject *fail_after_exc;
 #endif
+    /* preallocated storage for mark and data_stack (must be last, it is
+       not cleared by state_init()) */
+    const void* small_mark[SRE_SMALL_MARKS];
+    void* small_data_stack[SRE_SMALL_DATA_STACK];
 } SRE_STATE;
 
 typedef struct {
@@ -1688,6 +1688,43 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
 #define RESET_CAPTURE_GROUP() \
     do { state->lastmark = state->lastindex = -1; } while (0)
 
+/* Find the first occurrence of the required literal that a match starting
+   at ptr could contain, or return NULL if there is none. */
+LOCAL(const SRE_CHAR*)
+SRE(find_required)(SRE_STATE* state, const SRE_CHAR* ptr,
+                   SRE_CODE* required, Py_ssize_t required_len,
+                   Py_ssize_t required_offset)
+{
+    const SRE_CHAR* end = (const SRE_CHAR *)state->end;
+    SRE_CHAR c = (SRE_CHAR) required[0];
+    Py_ssize_t i;
+
+    if (end - ptr < required_offset + required_len)
+        return NULL;
+    ptr += required_offset;
+    end -= required_len - 1;
+    while (ptr < end) {
+#if SIZEOF_SRE_CHAR == 1
+        ptr = memchr(ptr, c, end - ptr);
+        if (ptr == NULL)
+            return NULL;
+#else
+        while (*ptr != c) {
+            if (++ptr >= end)
+                return NULL;
+        }
+#endif
+        for (i = 1; i < required_len; i++) {
+            if (ptr[i] != (SRE_CHAR) required[i])
+                break;
+        }
+        if (i == required_len)
+            return ptr;
+        ptr++;
+    }
+    return NULL;
+}
+
 LOCAL(Py_ssize_t)
 SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 {
@@ -1699,6 +1736,10 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     SRE_CODE* prefix = NULL;
     SRE_CODE* charset = NULL;
     SRE_CODE* overlap = NULL;
+    Py_ssize_t required_len = 0;
+    Py_ssize_t required_offset = 0;
+    SRE_CODE* required = NULL;
+    const SRE_CHAR* required_ptr = NULL;
     int flags = 0;
     INIT_TRACE(state);
 
@@ -1724,17 +1765,31 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
                 end = ptr;
         }
 
+        SRE_CODE* info = pattern + 5;
+        if (flags & SRE_INFO_REQUIRED) {
+            /* pattern contains a known literal */
+            /* <length> <offset> <literal data> */
+            required_len = info[0];
+            required_offset = info[1];
+            required = info + 2;
+            info = required + required_len;
+#if SIZEOF_SRE_CHAR < 4
+            for (Py_ssize_t i = 0; i < required_len; i++)
+                if ((SRE_CODE)(SRE_CHAR) required[i] != required[i])
+                    return 0; /* literal can't match: doesn't fit in char width */
+#endif
+        }
         if (flags & SRE_INFO_PREFIX) {
             /* pattern starts with a known prefix */
             /* <length> <skip> <prefix data> <overlap data> */
-            prefix_len = pattern[5];
-            prefix_skip = pattern[6];
-            prefix = pattern + 7;
+            prefix_len = info[0];
+            prefix_skip = info[1];
+            prefix = info + 2;
             overlap = prefix + prefix_len - 1;
         } else if (flags & SRE_INFO_CHARSET)
             /* pattern starts with a character from a known set */
             /* <charset> */
-            charset = pattern + 5;
+            charset = info;
 
         pattern += 1 + pattern[1];
     }
@@ -1831,6 +1886,14 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
                 ptr++;
             if (ptr >= end)
                 return 0;
+            if (required_len && (required_ptr == NULL ||
+                                 required_ptr - ptr < required_offset)) {
+                required_ptr = SRE(find_required)(state, ptr, required,
+                                                  required_len,
+                                                  required_offset);
+                if (required_ptr == NULL)
+                    return 0;
+            }
             TRACE(("|%p|%p|SEARCH CHARSET\n", pattern, ptr));
             state->start = ptr;
             state->ptr = ptr;
@@ -1840,9 +1903,62 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
             ptr++;
             RESET_CAPTURE_GROUP();
         }
+    } else if ((pattern[0] == SRE_OP_REPEAT_ONE ||
+                pattern[0] == SRE_OP_MIN_REPEAT_ONE) &&
+               pattern[3] == SRE_MAXREPEAT) {
+        /* pattern starts with an unbounded repeat of a single character */
+        /* <REPEAT_ONE|MIN_REPEAT_ONE> <skip> <1=min> <2=max> item ... */
+        /* A match starting inside the run of characters matched by item
+           could also be found from the start of the run with a longer
+           repetition, so only the start of each run has to be tried. */
+        Py_ssize_t n;
+        int toplevel = 1;
+        if (required_len) {
+            required_ptr = SRE(find_required)(state, ptr, required,
+                                              required_len, required_offset);
+            if (required_ptr == NULL)
+                return 0;
+        }
+        for (;;) {
+            state->ptr = ptr;
+            n = SRE(count)(state, pattern + 4, SRE_MAXREPEAT);
+            if (n < 0)
+                return n;
+            if (n >= (Py_ssize_t) pattern[2]) {
+                if (required_len && required_ptr - ptr < required_offset) {
+                    required_ptr = SRE(find_required)(state, ptr, required,
+                                                      required_len,
+                                                      required_offset);
+                    if (required_ptr == NULL)
+                        return 0;
+                }
+                TRACE(("|%p|%p|SEARCH REPEAT\n", pattern, ptr));
+                state->start = state->ptr = ptr;
+                status = SRE(match)(state, pattern, toplevel);
+                if (status != 0)
+                    return status;
+                if (toplevel && state->must_advance) {
+                    /* the first attempt may only have failed because
+                       an empty match is not allowed there */
+                    n = 0;
+                }
+                RESET_CAPTURE_GROUP();
+            }
+            toplevel = 0;
+            state->must_advance = 0;
+            if (n >= end - ptr)
+                return 0;
+            ptr += n + 1;
+        }
     } else {
         /* general case */
         assert(ptr <= end);
+        if (required_len) {
+            required_ptr = SRE(find_required)(state, ptr, required,
+                                              required_len, required_offset);
+            if (required_ptr == NULL)
+                return 0;
+        }
         TRACE(("|%p|%p|SEARCH\n", pattern, ptr));
         state->start = state->ptr = ptr;
         status = SRE(match)(state, pattern, 1);
@@ -1856,6 +1972,13 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         }
         while (status == 0 && ptr < end) {
             ptr++;
+            if (required_len && required_ptr - ptr < required_offset) {
+                required_ptr = SRE(find_required)(state, ptr, required,
+                                                  required_len,
+                                                  required_offset);
+                if (required_ptr == NULL)
+                    return 0;
+            }
             RESET_CAPTURE_GROUP();
             TRACE(("|%p|%p|SEARCH\n", pattern, ptr));
             state->start = state->ptr = ptr;
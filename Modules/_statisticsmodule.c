@@ -7,6 +7,10 @@
 #endif
 
 #include "Python.h"
+
+#include <stdlib.h>               // qsort()
+#include <string.h>               // memcpy()
+
 #include "clinic/_statisticsmodule.c.h"
 
 /*[clinic input]
@@ -125,9 +129,454 @@ _statistics__normal_dist_inv_cdf_impl(PyObject *module, double p, double mu,
     return -1.0;
 }
 
+/*
+ * Exact sums of floats.
+ *
+ * A finite double is m * 2**(k - 1074) for an integer |m| < 2**53 and
+ * 0 <= k <= 2045, so a sum of doubles is an integer multiple of
+ * 2**-1074 and a sum of their squares a multiple of 2**-2148.  Both are
+ * accumulated exactly in fixed-size arrays of 32-bit digits, each held
+ * in an int64_t so that carries only need to be propagated now and then.
+ */
+
+#define DIGIT_BITS 32
+#define DIGIT_MASK ((int64_t)0xffffffff)
+/* Enough digits for 2**63 terms of at most 2**2098 and 2**4196. */
+#define SUM_DIGITS 72
+#define SQUARES_DIGITS 136
+/* Each term adds less than 2**32 to a digit at most 4 times, so an
+   int64_t digit can take 2**26 terms between normalizations. */
+#define TERMS_PER_NORMALIZATION (1 << 26)
+
+/* Add sign * v * 2**pos to acc, where 0 <= v < 2**32. */
+static inline void
+acc_add(int64_t *acc, uint64_t v, int pos, int sign)
+{
+    uint64_t w = v << (pos % DIGIT_BITS);
+    int64_t lo = (int64_t)(w & (uint64_t)DIGIT_MASK);
+    int64_t hi = (int64_t)(w >> DIGIT_BITS);
+    int i = pos / DIGIT_BITS;
+    if (sign < 0) {
+        acc[i] -= lo;
+        acc[i + 1] -= hi;
+    }
+    else {
+        acc[i] += lo;
+        acc[i + 1] += hi;
+    }
+}
+
+/* Propagate carries so that every digit but the last is in
+   [0, 2**32). */
+static void
+acc_normalize(int64_t *acc, int ndigits)
+{
+    int64_t carry = 0;
+    for (int i = 0; i < ndigits - 1; i++) {
+        int64_t v = acc[i] + carry;
+        acc[i] = v & DIGIT_MASK;
+        carry = (v - acc[i]) / ((int64_t)1 << DIGIT_BITS);
+    }
+    acc[ndigits - 1] += carry;
+}
+
+static PyObject *
+acc_as_long(int64_t *acc, int ndigits)
+{
+    acc_normalize(acc, ndigits);
+    int i = ndigits - 1;
+    while (i > 0 && acc[i] == 0) {
+        i--;
+    }
+    PyObject *result = PyLong_FromLongLong(acc[i]);
+    if (result == NULL) {
+        return NULL;
+    }
+    PyObject *shift = PyLong_FromLong(DIGIT_BITS);
+    if (shift == NULL) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    while (result != NULL && --i >= 0) {
+        PyObject *shifted = PyNumber_Lshift(result, shift);
+        Py_DECREF(result);
+        result = NULL;
+        if (shifted == NULL) {
+            break;
+        }
+        PyObject *digit = PyLong_FromLongLong(acc[i]);
+        if (digit != NULL) {
+            result = PyNumber_Or(shifted, digit);
+            Py_DECREF(digit);
+        }
+        Py_DECREF(shifted);
+    }
+    Py_DECREF(shift);
+    return result;
+}
+
+/* Store the value of an exact float or exact int in *x if it is a finite
+   double (for ints, if the conversion is exact).  Return 1 if it is, and
+   0 if not. */
+static int
+item_as_double(PyObject *item, double *x, int *is_float)
+{
+    if (PyFloat_CheckExact(item)) {
+        *x = PyFloat_AsDouble(item);
+        *is_float = 1;
+        return isfinite(*x);
+    }
+    if (PyLong_CheckExact(item)) {
+        int overflow;
+        long long v = PyLong_AsLongLongAndOverflow(item, &overflow);
+        if (overflow || v > (1LL << 53) || v < -(1LL << 53)) {
+            return 0;
+        }
+        *x = (double)v;
+        return 1;
+    }
+    return 0;
+}
+
+/*[clinic input]
+_statistics._float_sums
+   data: object
+   squares: bool
+   /
+
+Return the exact sum of data, and of its squares if squares is true.
+
+The result is a tuple (type, count, sum, sum_of_squares) where the sums
+are integers in units of 2**-1074 and 2**-2148, and sum_of_squares is
+None if squares is false.  type is float if data contains a float and
+int otherwise.  Return None if data is not a list or tuple of floats
+and ints which are exactly representable as finite floats.
+[clinic start generated code]*/
+
+static PyObject *
+_statistics__float_sums_impl(PyObject *module, PyObject *data, int squares)
+/*[clinic end generated code: output=a14cc63875f070b5 input=61c1175dbfd72dbf]*/
+{
+    if (!PyList_Check(data) && !PyTuple_Check(data)) {
+        Py_RETURN_NONE;
+    }
+    /* Work on a snapshot, in case a list changes size. */
+    PyObject *items = PySequence_Tuple(data);
+    if (items == NULL) {
+        return NULL;
+    }
+    Py_ssize_t n = PyTuple_Size(items);
+    int64_t sum[SUM_DIGITS] = {0};
+    int64_t sum_squares[SQUARES_DIGITS] = {0};
+    int has_float = 0;
+    Py_ssize_t pending = 0;
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        double x;
+        if (!item_as_double(PyTuple_GetItem(items, i), &x, &has_float)) {
+            Py_DECREF(items);
+            Py_RETURN_NONE;
+        }
+        if (x == 0.0) {
+            continue;
+        }
+        int e;
+        double f = frexp(fabs(x), &e);
+        /* x == sign * m * 2**(k - 1074) */
+        uint64_t m = (uint64_t)ldexp(f, 53);
+        int k = e - 53 + 1074;
+        if (k < 0) {
+            /* Subnormal: the low bits of m are zero. */
+            m >>= -k;
+            k = 0;
+        }
+        int sign = x < 0.0 ? -1 : 1;
+        uint64_t mlo = m & (uint64_t)DIGIT_MASK;
+        uint64_t mhi = m >> DIGIT_BITS;
+        acc_add(sum, mlo, k, sign);
+        acc_add(sum, mhi, k + DIGIT_BITS, sign);
+        if (squares) {
+            /* m*m == mhi*mhi * 2**64 + 2*mhi*mlo * 2**32 + mlo*mlo */
+            uint64_t parts[3] = {mlo * mlo, 2 * mhi * mlo, mhi * mhi};
+            for (int j = 0; j < 3; j++) {
+                int pos = 2 * k + j * DIGIT_BITS;
+                acc_add(sum_squares, parts[j] & (uint64_t)DIGIT_MASK, pos, 1);
+                acc_add(sum_squares, parts[j] >> DIGIT_BITS,
+                        pos + DIGIT_BITS, 1);
+            }
+        }
+        if (++pending == TERMS_PER_NORMALIZATION) {
+            acc_normalize(sum, SUM_DIGITS);
+            acc_normalize(sum_squares, SQUARES_DIGITS);
+            pending = 0;
+        }
+    }
+    Py_DECREF(items);
+
+    PyObject *total = acc_as_long(sum, SUM_DIGITS);
+    if (total == NULL) {
+        return NULL;
+    }
+    PyObject *total_squares;
+    if (squares) {
+        total_squares = acc_as_long(sum_squares, SQUARES_DIGITS);
+        if (total_squares == NULL) {
+            Py_DECREF(total);
+            return NULL;
+        }
+    }
+    else {
+        total_squares = Py_NewRef(Py_None);
+    }
+    PyObject *type = has_float ? (PyObject *)&PyFloat_Type
+                               : (PyObject *)&PyLong_Type;
+    return Py_BuildValue("(OnNN)", type, n, total, total_squares);
+}
+
+/* An item of the data being selected from: ordering by value, then
+   by position matches the order of a stable sort. */
+typedef struct {
+    double value;
+    Py_ssize_t index;
+} select_item;
+
+static inline int
+select_lt(const select_item *a, const select_item *b)
+{
+    return a->value < b->value
+           || (a->value == b->value && a->index < b->index);
+}
+
+static int
+select_cmp(const void *a, const void *b)
+{
+    if (select_lt(a, b)) {
+        return -1;
+    }
+    return select_lt(b, a);
+}
+
+static inline void
+select_swap(select_item *a, select_item *b)
+{
+    select_item tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/* Partially sort v[lo:hi] so that v[r] holds the item of rank r for
+   every r in ranks[rlo:rhi], which are sorted and within [lo, hi).
+   Quickselect on all the ranks at once, falling back to qsort() when
+   the partitions stop shrinking, and to insertion sort for short
+   ranges. */
+static void
+select_ranks(select_item *v, Py_ssize_t lo, Py_ssize_t hi,
+             const Py_ssize_t *ranks, Py_ssize_t rlo, Py_ssize_t rhi,
+             int depth)
+{
+    while (rlo < rhi) {
+        if (hi - lo <= 16) {
+            for (Py_ssize_t i = lo + 1; i < hi; i++) {
+                select_item item = v[i];
+                Py_ssize_t j = i;
+                for (; j > lo && select_lt(&item, &v[j - 1]); j--) {
+                    v[j] = v[j - 1];
+                }
+                v[j] = item;
+            }
+            return;
+        }
+        if (depth-- == 0) {
+            qsort(v + lo, hi - lo, sizeof(select_item), select_cmp);
+            return;
+        }
+        /* Median of three as the pivot, moved to v[hi - 1]. */
+        Py_ssize_t mid = lo + (hi - lo) / 2;
+        if (select_lt(&v[mid], &v[lo])) {
+            select_swap(&v[mid], &v[lo]);
+        }
+        if (select_lt(&v[hi - 1], &v[lo])) {
+            select_swap(&v[hi - 1], &v[lo]);
+        }
+        if (select_lt(&v[mid], &v[hi - 1])) {
+            select_swap(&v[mid], &v[hi - 1]);
+        }
+        /* Branch-free Lomuto partition: v[lo:p] is less than the pivot
+           and v[p:i] is not, so swapping v[i] with v[p] unconditionally
+           keeps that true whether or not p advances. */
+        select_item pivot = v[hi - 1];
+        Py_ssize_t p = lo;
+        for (Py_ssize_t i = lo; i < hi - 1; i++) {
+            select_item item = v[i];
+            int less = select_lt(&item, &pivot);
+            v[i] = v[p];
+            v[p] = item;
+            p += less;
+        }
+        select_swap(&v[p], &v[hi - 1]);
+
+        /* Ranks below p are left of the pivot, ranks above it right. */
+        Py_ssize_t rmid = rlo;
+        while (rmid < rhi && ranks[rmid] < p) {
+            rmid++;
+        }
+        Py_ssize_t rright = rmid;
+        while (rright < rhi && ranks[rright] == p) {
+            rright++;
+        }
+        if (rmid - rlo < rhi - rright) {
+            select_ranks(v, lo, p, ranks, rlo, rmid, depth);
+            lo = p + 1;
+            rlo = rright;
+        }
+        else {
+            select_ranks(v, p + 1, hi, ranks, rright, rhi, depth);
+            hi = p;
+            rhi = rmid;
+        }
+    }
+}
+
+static int
+compare_ranks(const void *a, const void *b)
+{
+    Py_ssize_t x = *(const Py_ssize_t *)a, y = *(const Py_ssize_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*[clinic input]
+_statistics._select
+   data: object
+   ranks: object
+   /
+
+Return the items of sorted(data) at the positions in ranks.
+
+Data which are floats and ints exactly representable as floats are
+selected from without sorting them fully.
+[clinic start generated code]*/
+
+static PyObject *
+_statistics__select_impl(PyObject *module, PyObject *data, PyObject *ranks)
+/*[clinic end generated code: output=a9601ab62aa65ee9 input=407f035dadf6e88e]*/
+{
+    PyObject *items = NULL, *positions = NULL, *result = NULL;
+    select_item *v = NULL;
+    Py_ssize_t *want = NULL;
+
+    positions = PySequence_Tuple(ranks);
+    if (positions == NULL) {
+        goto done;
+    }
+    Py_ssize_t nranks = PyTuple_Size(positions);
+
+    int fast = PyList_Check(data) || PyTuple_Check(data);
+    if (fast) {
+        items = PySequence_Tuple(data);
+    }
+    else {
+        items = PySequence_List(data);
+    }
+    if (items == NULL) {
+        goto done;
+    }
+    Py_ssize_t n = PySequence_Size(items);
+
+    if (fast) {
+        v = PyMem_Malloc((n ? n : 1) * sizeof(select_item));
+        if (v == NULL) {
+            PyErr_NoMemory();
+            goto done;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            int is_float;
+            if (!item_as_double(PyTuple_GetItem(items, i), &v[i].value,
+                                &is_float))
+            {
+                fast = 0;
+                break;
+            }
+            v[i].index = i;
+        }
+        if (!fast) {
+            PyObject *list = PySequence_List(items);
+            Py_DECREF(items);
+            items = list;
+            if (items == NULL) {
+                goto done;
+            }
+        }
+    }
+    if (!fast) {
+        if (PyList_Sort(items) < 0) {
+            goto done;
+        }
+    }
+
+    /* The ranks as given, followed by a sorted copy. */
+    want = PyMem_Malloc((nranks ? 2 * nranks : 1) * sizeof(Py_ssize_t));
+    if (want == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < nranks; i++) {
+        Py_ssize_t r = PyNumber_AsSsize_t(PyTuple_GetItem(positions, i),
+                                          PyExc_IndexError);
+        if (r == -1 && PyErr_Occurred()) {
+            goto done;
+        }
+        if (r < 0) {
+            r += n;
+        }
+        if (r < 0 || r >= n) {
+            PyErr_SetString(PyExc_IndexError, "list index out of range");
+            goto done;
+        }
+        want[i] = r;
+    }
+
+    result = PyList_New(nranks);
+    if (result == NULL) {
+        goto done;
+    }
+    if (fast) {
+        Py_ssize_t *sorted_ranks = want + nranks;
+        memcpy(sorted_ranks, want, nranks * sizeof(Py_ssize_t));
+        qsort(sorted_ranks, nranks, sizeof(Py_ssize_t), compare_ranks);
+        int depth = 0;
+        for (Py_ssize_t m = n; m > 0; m >>= 1) {
+            depth += 2;
+        }
+        select_ranks(v, 0, n, sorted_ranks, 0, nranks, depth);
+        for (Py_ssize_t i = 0; i < nranks; i++) {
+            PyObject *item = PyTuple_GetItem(items, v[want[i]].index);
+            PyList_SetItem(result, i, Py_NewRef(item));
+        }
+    }
+    else {
+        for (Py_ssize_t i = 0; i < nranks; i++) {
+            PyObject *item = PyList_GetItemRef(items, want[i]);
+            if (item == NULL) {
+                Py_CLEAR(result);
+                goto done;
+            }
+            PyList_SetItem(result, i, item);
+        }
+    }
+
+  done:
+    PyMem_Free(want);
+    PyMem_Free(v);
+    Py_XDECREF(items);
+    Py_XDECREF(positions);
+    return result;
+}
+
 
 static PyMethodDef statistics_methods[] = {
     _STATISTICS__NORMAL_DIST_INV_CDF_METHODDEF
+    _STATISTICS__FLOAT_SUMS_METHODDEF
+    _STATISTICS__SELECT_METHODDEF
     {NULL, NULL, 0, NULL}
 };
 
@@ -11,6 +11,7 @@
 #include "pycore_pylifecycle.h"
 #include "pycore_pystate.h"       // _PyThreadState_SetCurrent()
 #include "pycore_time.h"          // _PyTime_FromSeconds()
+#include "pycore_unicodeobject.h" // _PyUnicode_Equal()
 #include "pycore_weakref.h"       // _PyWeakref_GET_REF()
 
 #include <stddef.h>               // offsetof()
@@ -1697,6 +1698,17 @@ _ldict(localobject *self, thread_module_state *state)
     return ldict;
 }
 
+/* Return 1 if name is "__dict__", 0 if not, and -1 on error.  Attribute
+   names are nearly always exact strings, so avoid the rich comparison. */
+static int
+local_name_is_dict(PyObject *name)
+{
+    if (PyUnicode_CheckExact(name)) {
+        return _PyUnicode_Equal(name, &_Py_ID(__dict__));
+    }
+    return PyObject_RichCompareBool(name, &_Py_ID(__dict__), Py_EQ);
+}
+
 static int
 local_setattro(PyObject *op, PyObject *name, PyObject *v)
 {
@@ -1710,7 +1722,7 @@ local_setattro(PyObject *op, PyObject *name, PyObject *v)
         goto err;
     }
 
-    int r = PyObject_RichCompareBool(name, &_Py_ID(__dict__), Py_EQ);
+    int r = local_name_is_dict(name);
     if (r == -1) {
         goto err;
     }
@@ -1769,7 +1781,7 @@ local_getattro(PyObject *op, PyObject *name)
     if (ldict == NULL)
         return NULL;
 
-    int r = PyObject_RichCompareBool(name, &_Py_ID(__dict__), Py_EQ);
+    int r = local_name_is_dict(name);
     if (r == 1) {
         return ldict;
     }
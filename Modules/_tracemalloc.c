@@ -85,18 +85,31 @@ _tracemalloc.start
 
     nframe: int = 1
     /
+    *
+    sample_rate_bytes: Py_ssize_t = 0
 
 Start tracing Python memory allocations.
 
 Also set the maximum number of frames stored in the traceback of a
 trace to nframe.
+
+If sample_rate_bytes is greater than 0, only trace a sample of the
+allocations: on average one every sample_rate_bytes allocated bytes.
+The size of a sampled trace is scaled to estimate the size of all
+allocations.
 [clinic start generated code]*/
 
 static PyObject *
-_tracemalloc_start_impl(PyObject *module, int nframe)
-/*[clinic end generated code: output=caae05c23c159d3c input=40d849b5b29d1933]*/
+_tracemalloc_start_impl(PyObject *module, int nframe,
+                        Py_ssize_t sample_rate_bytes)
+/*[clinic end generated code: output=7d3137e4d1ce782d input=d0140c5ad282ae25]*/
 {
-    if (_PyTraceMalloc_Start(nframe) < 0) {
+    if (sample_rate_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "sample_rate_bytes must be non-negative");
+        return NULL;
+    }
+    if (_PyTraceMalloc_Start(nframe, (size_t)sample_rate_bytes) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
@@ -40,6 +40,10 @@ typedef struct {
     TransitionRuleType *start;
     TransitionRuleType *end;
     unsigned char std_only;
+    // Transitions of the last year looked up; 0 is not a valid year
+    int cached_year;
+    int64_t cached_start;
+    int64_t cached_end;
 } _tzrule;
 
 typedef struct {
@@ -1454,8 +1458,21 @@ tzrule_transitions(_tzrule *rule, int year, int64_t *start, int64_t *end)
 {
     assert(rule->start != NULL);
     assert(rule->end != NULL);
+#ifndef Py_GIL_DISABLED
+    // Conversions tend to come in runs within the same year.
+    if (rule->cached_year == year) {
+        *start = rule->cached_start;
+        *end = rule->cached_end;
+        return;
+    }
+#endif
     *start = rule->start->year_to_timestamp(rule->start, year);
     *end = rule->end->year_to_timestamp(rule->end, year);
+#ifndef Py_GIL_DISABLED
+    rule->cached_year = year;
+    rule->cached_start = *start;
+    rule->cached_end = *end;
+#endif
 }
 
 /* Calculate the _ttinfo that applies at a given local time from a _tzrule.
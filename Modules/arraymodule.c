@@ -11,6 +11,7 @@
 #include "pycore_bytesobject.h"   // _PyBytes_Repeat
 #include "pycore_call.h"          // _PyObject_CallMethod()
 #include "pycore_ceval.h"         // _PyEval_GetBuiltin()
+#include "pycore_long.h"          // _PyLong_IsCompact()
 #include "pycore_modsupport.h"    // _PyArg_NoKeywords()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_weakref.h"       // FT_CLEAR_WEAKREFS()
@@ -205,6 +206,20 @@ Note that the basic Get and Set functions do NOT check that the index is
 in bounds; that's the responsibility of the caller.
 ****************************************************************************/
 
+/* The integer setitem functions first try this fast path for exact ints
+   small enough to be stored inline (at least 30 bits).  Values that don't
+   fit the item type fall through to the generic conversion below, which
+   raises the usual OverflowError. */
+static inline int
+compact_long(PyObject *v, long *px)
+{
+    if (PyLong_CheckExact(v) && _PyLong_IsCompact((PyLongObject *)v)) {
+        *px = (long)_PyLong_CompactValue((PyLongObject *)v);
+        return 1;
+    }
+    return 0;
+}
+
 static PyObject *
 b_getitem(arrayobject *ap, Py_ssize_t i)
 {
@@ -216,10 +231,14 @@ static int
 b_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     short x;
+    long lx;
+    if (compact_long(v, &lx) && -128 <= lx && lx <= 127) {
+        x = (short)lx;
+    }
     /* PyArg_Parse's 'b' formatter is for an unsigned char, therefore
        must use the next size up that is signed ('h') and manually do
        the overflow checking */
-    if (!PyArg_Parse(v, "h;array item must be integer", &x))
+    else if (!PyArg_Parse(v, "h;array item must be integer", &x))
         return -1;
     else if (x < -128) {
         PyErr_SetString(PyExc_OverflowError,
@@ -247,8 +266,12 @@ static int
 BB_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     unsigned char x;
+    long lx;
+    if (compact_long(v, &lx) && 0 <= lx && lx <= UCHAR_MAX) {
+        x = (unsigned char)lx;
+    }
     /* 'B' == unsigned char, maps to PyArg_Parse's 'b' formatter */
-    if (!PyArg_Parse(v, "b;array item must be integer", &x))
+    else if (!PyArg_Parse(v, "b;array item must be integer", &x))
         return -1;
     if (i >= 0)
         ((unsigned char *)ap->ob_item)[i] = x;
@@ -339,8 +362,12 @@ static int
 h_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     short x;
+    long lx;
+    if (compact_long(v, &lx) && SHRT_MIN <= lx && lx <= SHRT_MAX) {
+        x = (short)lx;
+    }
     /* 'h' == signed short, maps to PyArg_Parse's 'h' formatter */
-    if (!PyArg_Parse(v, "h;array item must be integer", &x))
+    else if (!PyArg_Parse(v, "h;array item must be integer", &x))
         return -1;
     if (i >= 0)
                  ((short *)ap->ob_item)[i] = x;
@@ -357,9 +384,13 @@ static int
 HH_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     int x;
+    long lx;
+    if (compact_long(v, &lx) && 0 <= lx && lx <= USHRT_MAX) {
+        x = (int)lx;
+    }
     /* PyArg_Parse's 'h' formatter is for a signed short, therefore
        must use the next size up and manually do the overflow checking */
-    if (!PyArg_Parse(v, "i;array item must be integer", &x))
+    else if (!PyArg_Parse(v, "i;array item must be integer", &x))
         return -1;
     else if (x < 0) {
         PyErr_SetString(PyExc_OverflowError,
@@ -386,8 +417,12 @@ static int
 i_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     int x;
+    long lx;
+    if (compact_long(v, &lx) && INT_MIN <= lx && lx <= INT_MAX) {
+        x = (int)lx;
+    }
     /* 'i' == signed int, maps to PyArg_Parse's 'i' formatter */
-    if (!PyArg_Parse(v, "i;array item must be integer", &x))
+    else if (!PyArg_Parse(v, "i;array item must be integer", &x))
         return -1;
     if (i >= 0)
                  ((int *)ap->ob_item)[i] = x;
@@ -448,7 +483,8 @@ static int
 l_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     long x;
-    if (!PyArg_Parse(v, "l;array item must be integer", &x))
+    if (!compact_long(v, &x) &&
+        !PyArg_Parse(v, "l;array item must be integer", &x))
         return -1;
     if (i >= 0)
                  ((long *)ap->ob_item)[i] = x;
@@ -500,7 +536,11 @@ static int
 q_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     long long x;
-    if (!PyArg_Parse(v, "L;array item must be integer", &x))
+    long lx;
+    if (compact_long(v, &lx)) {
+        x = lx;
+    }
+    else if (!PyArg_Parse(v, "L;array item must be integer", &x))
         return -1;
     if (i >= 0)
         ((long long *)ap->ob_item)[i] = x;
@@ -553,7 +593,10 @@ static int
 f_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     float x;
-    if (!PyArg_Parse(v, "f;array item must be float", &x))
+    if (PyFloat_CheckExact(v)) {
+        x = (float)PyFloat_AS_DOUBLE(v);
+    }
+    else if (!PyArg_Parse(v, "f;array item must be float", &x))
         return -1;
     if (i >= 0)
                  ((float *)ap->ob_item)[i] = x;
@@ -570,7 +613,10 @@ static int
 d_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     double x;
-    if (!PyArg_Parse(v, "d;array item must be float", &x))
+    if (PyFloat_CheckExact(v)) {
+        x = PyFloat_AS_DOUBLE(v);
+    }
+    else if (!PyArg_Parse(v, "d;array item must be float", &x))
         return -1;
     if (i >= 0)
                  ((double *)ap->ob_item)[i] = x;
@@ -1046,14 +1092,41 @@ array_ass_item(PyObject *op, Py_ssize_t i, PyObject *v)
     return (*a->ob_descr->setitem)(a, i, v);
 }
 
+/* Extend from a list or tuple.  Items that are exact ints or floats are
+   converted without running Python code, so the array is resized once
+   and they are stored in place.  From the first other item on, this falls
+   back to appending items one at a time, like iterating would. */
 static int
-setarrayitem(PyObject *a, Py_ssize_t i, PyObject *v)
+array_seq_extend(arrayobject *self, PyObject *seq)
 {
-#ifndef NDEBUG
-    array_state *state = find_array_state_by_type(Py_TYPE(a));
-    assert(array_Check(a, state));
-#endif
-    return array_ass_item(a, i, v);
+    Py_ssize_t i, old_size = Py_SIZE(self);
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+
+    if (n > PY_SSIZE_T_MAX - old_size) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (array_resize(self, old_size + n) == -1)
+        return -1;
+    for (i = 0; i < n; i++) {
+        PyObject *v = PySequence_Fast_GET_ITEM(seq, i);
+        if (!PyLong_CheckExact(v) && !PyFloat_CheckExact(v))
+            break;
+        if ((*self->ob_descr->setitem)(self, old_size + i, v) != 0) {
+            array_resize(self, old_size + i);
+            return -1;
+        }
+    }
+    if (i < n && array_resize(self, old_size + i) == -1)
+        return -1;
+    for (; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        PyObject *v = Py_NewRef(PySequence_Fast_GET_ITEM(seq, i));
+        int res = ins1(self, Py_SIZE(self), v);
+        Py_DECREF(v);
+        if (res != 0)
+            return -1;
+    }
+    return 0;
 }
 
 static int
@@ -1061,6 +1134,12 @@ array_iter_extend(arrayobject *self, PyObject *bb)
 {
     PyObject *it, *v;
 
+    if ((PyList_CheckExact(bb) || PyTuple_CheckExact(bb))
+        && self->ob_exports == 0)
+    {
+        return array_seq_extend(self, bb);
+    }
+
     it = PyObject_GetIter(bb);
     if (it == NULL)
         return -1;
@@ -2796,14 +2875,23 @@ array_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
             if (len > 0 && !array_Check(initial, state)) {
                 Py_ssize_t i;
+                int exact = PyList_CheckExact(initial)
+                            || PyTuple_CheckExact(initial);
                 for (i = 0; i < len; i++) {
-                    PyObject *v =
-                        PySequence_GetItem(initial, i);
-                    if (v == NULL) {
-                        Py_DECREF(a);
-                        return NULL;
+                    PyObject *v;
+                    /* The list may shrink while items are converted. */
+                    if (exact && i < PySequence_Fast_GET_SIZE(initial)) {
+                        v = Py_NewRef(PySequence_Fast_GET_ITEM(initial, i));
+                    }
+                    else {
+                        v = PySequence_GetItem(initial, i);
+                        if (v == NULL) {
+                            Py_DECREF(a);
+                            return NULL;
+                        }
                     }
-                    if (setarrayitem(a, i, v) != 0) {
+                    /* 'a' is not shared yet: no need for bounds checks. */
+                    if ((*descr->setitem)((arrayobject *)a, i, v) != 0) {
                         Py_DECREF(v);
                         Py_DECREF(a);
                         return NULL;
@@ -80,7 +80,7 @@ static const unsigned char table_a2b_base64[] = {
     -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
     -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
     -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,62, -1,-1,-1,63,
-    52,53,54,55, 56,57,58,59, 60,61,-1,-1, -1, 0,-1,-1, /* Note PAD->0 */
+    52,53,54,55, 56,57,58,59, 60,61,-1,-1, -1,-1,-1,-1,
     -1, 0, 1, 2,  3, 4, 5, 6,  7, 8, 9,10, 11,12,13,14,
     15,16,17,18, 19,20,21,22, 23,24,25,-1, -1,-1,-1,-1,
     -1,26,27,28, 29,30,31,32, 33,34,35,36, 37,38,39,40,
@@ -406,6 +406,29 @@ binascii_a2b_base64_impl(PyObject *module, Py_buffer *data, int strict_mode)
     unsigned char leftchar = 0;
     int pads = 0;
     for (size_t i = 0; i < ascii_len; i++) {
+        /* Fast path: decode whole quads of valid characters at once.
+        ** Anything else (padding, invalid characters) is left to the
+        ** character by character loop below.
+        */
+        if (quad_pos == 0 && !padding_started) {
+            while (ascii_len - i >= 4) {
+                unsigned char c0 = table_a2b_base64[ascii_data[i]];
+                unsigned char c1 = table_a2b_base64[ascii_data[i+1]];
+                unsigned char c2 = table_a2b_base64[ascii_data[i+2]];
+                unsigned char c3 = table_a2b_base64[ascii_data[i+3]];
+                if ((c0 | c1 | c2 | c3) >= 64) {
+                    break;
+                }
+                *bin_data++ = (c0 << 2) | (c1 >> 4);
+                *bin_data++ = (c1 << 4) | (c2 >> 2);
+                *bin_data++ = (c2 << 6) | c3;
+                i += 4;
+            }
+            if (i == ascii_len) {
+                break;
+            }
+        }
+
         unsigned char this_ch = ascii_data[i];
 
         /* Check for pad sequences and ignore
@@ -551,16 +574,26 @@ binascii_b2a_base64_impl(PyObject *module, Py_buffer *data, int newline)
         return NULL;
     }
 
-    /* We're lazy and allocate too much (fixed up later).
-       "+2" leaves room for up to two pad characters.
-       Note that 'b' gets encoded as 'Yg==\n' (1 in, 5 out). */
-    out_len = bin_len*2 + 2;
+    /* Every started group of three bytes takes four characters. */
+    out_len = (bin_len + 2) / 3 * 4;
     if (newline)
         out_len++;
     ascii_data = _PyBytesWriter_Alloc(&writer, out_len);
     if (ascii_data == NULL)
         return NULL;
 
+    /* Encode whole groups of three bytes */
+    for ( ; bin_len >= 3 ; bin_len -= 3, bin_data += 3) {
+        unsigned int group = ((unsigned int)bin_data[0] << 16) |
+                             ((unsigned int)bin_data[1] << 8) |
+                             bin_data[2];
+        ascii_data[0] = table_b2a_base64[group >> 18];
+        ascii_data[1] = table_b2a_base64[(group >> 12) & 0x3f];
+        ascii_data[2] = table_b2a_base64[(group >> 6) & 0x3f];
+        ascii_data[3] = table_b2a_base64[group & 0x3f];
+        ascii_data += 4;
+    }
+
     for( ; bin_len > 0 ; bin_len--, bin_data++ ) {
         /* Shift the data into our buffer */
         leftchar = (leftchar << 8) | *bin_data;
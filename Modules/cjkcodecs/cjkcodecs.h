@@ -155,8 +155,11 @@ get_module_state(PyObject *mod)
 
 #define OUTCHAR(c)                                                         \
     do {                                                                   \
-        if (_PyUnicodeWriter_WriteChar(writer, (c)) < 0)                   \
-            return MBERR_EXCEPTION;                                         \
+        Py_UCS4 _c = (c);                                                  \
+        if (_PyUnicodeWriter_Prepare(writer, 1, _c) < 0)                   \
+            return MBERR_EXCEPTION;                                        \
+        PyUnicode_WRITE(writer->kind, writer->data, writer->pos, _c);      \
+        writer->pos++;                                                     \
     } while (0)
 
 #define OUTCHAR2(c1, c2)                                                   \
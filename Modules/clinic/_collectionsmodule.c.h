@@ -596,6 +596,68 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_collections__count_mapping__doc__,
+"_count_mapping($module, mapping, other, /)\n"
+"--\n"
+"\n"
+"Add the counts from the other mapping to the mapping");
+
+#define _COLLECTIONS__COUNT_MAPPING_METHODDEF    \
+    {"_count_mapping", _PyCFunction_CAST(_collections__count_mapping), METH_FASTCALL, _collections__count_mapping__doc__},
+
+static PyObject *
+_collections__count_mapping_impl(PyObject *module, PyObject *mapping,
+                                 PyObject *other);
+
+static PyObject *
+_collections__count_mapping(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *mapping;
+    PyObject *other;
+
+    if (!_PyArg_CheckPositional("_count_mapping", nargs, 2, 2)) {
+        goto exit;
+    }
+    mapping = args[0];
+    other = args[1];
+    return_value = _collections__count_mapping_impl(module, mapping, other);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_collections__most_common__doc__,
+"_most_common($module, mapping, n, /)\n"
+"--\n"
+"\n"
+"List the n items of the mapping with the largest counts, largest first");
+
+#define _COLLECTIONS__MOST_COMMON_METHODDEF    \
+    {"_most_common", _PyCFunction_CAST(_collections__most_common), METH_FASTCALL, _collections__most_common__doc__},
+
+static PyObject *
+_collections__most_common_impl(PyObject *module, PyObject *mapping,
+                               PyObject *n_obj);
+
+static PyObject *
+_collections__most_common(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *mapping;
+    PyObject *n_obj;
+
+    if (!_PyArg_CheckPositional("_most_common", nargs, 2, 2)) {
+        goto exit;
+    }
+    mapping = args[0];
+    n_obj = args[1];
+    return_value = _collections__most_common_impl(module, mapping, n_obj);
+
+exit:
+    return return_value;
+}
+
 static PyObject *
 tuplegetter_new_impl(PyTypeObject *type, Py_ssize_t index, PyObject *doc);
 
@@ -632,4 +694,4 @@ tuplegetter_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=b9d4d647c221cb9f input=a9049054013a1b77]*/
+/*[clinic end generated code: output=f7f0ebf7a8d5b2ba input=a9049054013a1b77]*/
@@ -48,4 +48,78 @@ _statistics__normal_dist_inv_cdf(PyObject *module, PyObject *const *args, Py_ssi
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=0f0c849d51f16f1b input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_statistics__float_sums__doc__,
+"_float_sums($module, data, squares, /)\n"
+"--\n"
+"\n"
+"Return the exact sum of data, and of its squares if squares is true.\n"
+"\n"
+"The result is a tuple (type, count, sum, sum_of_squares) where the sums\n"
+"are integers in units of 2**-1074 and 2**-2148, and sum_of_squares is\n"
+"None if squares is false.  type is float if data contains a float and\n"
+"int otherwise.  Return None if data is not a list or tuple of floats\n"
+"and ints which are exactly representable as finite floats.");
+
+#define _STATISTICS__FLOAT_SUMS_METHODDEF    \
+    {"_float_sums", (PyCFunction)(void(*)(void))_statistics__float_sums, METH_FASTCALL, _statistics__float_sums__doc__},
+
+static PyObject *
+_statistics__float_sums_impl(PyObject *module, PyObject *data, int squares);
+
+static PyObject *
+_statistics__float_sums(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *data;
+    int squares;
+
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "_float_sums expected 2 arguments, got %zd", nargs);
+        goto exit;
+    }
+    data = args[0];
+    squares = PyObject_IsTrue(args[1]);
+    if (squares < 0) {
+        goto exit;
+    }
+    return_value = _statistics__float_sums_impl(module, data, squares);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_statistics__select__doc__,
+"_select($module, data, ranks, /)\n"
+"--\n"
+"\n"
+"Return the items of sorted(data) at the positions in ranks.\n"
+"\n"
+"Data which are floats and ints exactly representable as floats are\n"
+"selected from without sorting them fully.");
+
+#define _STATISTICS__SELECT_METHODDEF    \
+    {"_select", (PyCFunction)(void(*)(void))_statistics__select, METH_FASTCALL, _statistics__select__doc__},
+
+static PyObject *
+_statistics__select_impl(PyObject *module, PyObject *data, PyObject *ranks);
+
+static PyObject *
+_statistics__select(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *data;
+    PyObject *ranks;
+
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "_select expected 2 arguments, got %zd", nargs);
+        goto exit;
+    }
+    data = args[0];
+    ranks = args[1];
+    return_value = _statistics__select_impl(module, data, ranks);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=49cfc06d0f295086 input=a9049054013a1b77]*/
@@ -193,6 +193,107 @@ exit:
 
 #endif /* defined(CMSG_LEN) */
 
+#if defined(HAVE_RECVMMSG)
+
+PyDoc_STRVAR(_socket_socket_recvmmsg_into__doc__,
+"recvmmsg_into($self, buffers, flags=0, /)\n"
+"--\n"
+"\n"
+"Receive several messages with a single system call.\n"
+"\n"
+"One message is received into each of the writable buffers in the\n"
+"iterable buffers.  Return as soon as at least one message has been\n"
+"received.  The return value is a list with one (nbytes, address info)\n"
+"tuple per message received, in the order of the buffers used.  The\n"
+"flags argument defaults to 0 and has the same meaning as for recv().");
+
+#define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF    \
+    {"recvmmsg_into", _PyCFunction_CAST(_socket_socket_recvmmsg_into), METH_FASTCALL, _socket_socket_recvmmsg_into__doc__},
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s,
+                                  PyObject *buffers_arg, int flags);
+
+static PyObject *
+_socket_socket_recvmmsg_into(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffers_arg;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recvmmsg_into", nargs, 1, 2)) {
+        goto exit;
+    }
+    buffers_arg = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _socket_socket_recvmmsg_into_impl((PySocketSockObject *)s, buffers_arg, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_RECVMMSG) */
+
+#if defined(HAVE_SENDMMSG)
+
+PyDoc_STRVAR(_socket_socket_sendmmsg__doc__,
+"sendmmsg($self, buffers, flags=0, address=<unrepresentable>, /)\n"
+"--\n"
+"\n"
+"Send several messages with a single system call.\n"
+"\n"
+"Each bytes-like object in the iterable buffers is sent as a separate\n"
+"message.  The flags argument defaults to 0 and has the same meaning as\n"
+"for send().  If address is supplied and not None, it is the destination\n"
+"of all the messages.  Return the number of messages sent, which may be\n"
+"less than the number of buffers.");
+
+#define _SOCKET_SOCKET_SENDMMSG_METHODDEF    \
+    {"sendmmsg", _PyCFunction_CAST(_socket_socket_sendmmsg), METH_FASTCALL, _socket_socket_sendmmsg__doc__},
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *buffers_arg,
+                             int flags, PyObject *addr_arg);
+
+static PyObject *
+_socket_socket_sendmmsg(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffers_arg;
+    int flags = 0;
+    PyObject *addr_arg = NULL;
+
+    if (!_PyArg_CheckPositional("sendmmsg", nargs, 1, 3)) {
+        goto exit;
+    }
+    buffers_arg = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    addr_arg = args[2];
+skip_optional:
+    return_value = _socket_socket_sendmmsg_impl((PySocketSockObject *)s, buffers_arg, flags, addr_arg);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_SENDMMSG) */
+
 static int
 sock_initobj_impl(PySocketSockObject *self, int family, int type, int proto,
                   PyObject *fdobj);
@@ -527,6 +628,14 @@ exit:
     #define _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif /* !defined(_SOCKET_SOCKET_SENDMSG_METHODDEF) */
 
+#ifndef _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    #define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF) */
+
+#ifndef _SOCKET_SOCKET_SENDMMSG_METHODDEF
+    #define _SOCKET_SOCKET_SENDMMSG_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_SENDMMSG_METHODDEF) */
+
 #ifndef _SOCKET_INET_NTOA_METHODDEF
     #define _SOCKET_INET_NTOA_METHODDEF
 #endif /* !defined(_SOCKET_INET_NTOA_METHODDEF) */
@@ -538,4 +647,4 @@ exit:
 #ifndef _SOCKET_IF_INDEXTONAME_METHODDEF
     #define _SOCKET_IF_INDEXTONAME_METHODDEF
 #endif /* !defined(_SOCKET_IF_INDEXTONAME_METHODDEF) */
-/*[clinic end generated code: output=0376c46b76ae2bce input=a9049054013a1b77]*/
+/*[clinic end generated code: output=e72122a6f1ab6c60 input=a9049054013a1b77]*/
@@ -1,6 +1,8 @@
 #include "Python.h"
 #include "pycore_ceval.h"         // _PyEval_IsGILEnabled()
 #include "pycore_initconfig.h"    // _PyStatus_ERR()
+#include "pycore_lock.h"          // _PyMutex_at_fork_reinit()
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pyerrors.h"      // _Py_DumpExtensionModules()
 #include "pycore_fileutils.h"     // _PyFile_Flush
 #include "pycore_pystate.h"       // _PyThreadState_GET()
@@ -19,6 +21,10 @@
 #endif
 #ifdef MS_WINDOWS
 #  include <windows.h>
+#  include <io.h>                 // _lseek()
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#  include <sys/mman.h>           // memfd_create()
 #endif
 #ifdef HAVE_SYS_RESOURCE_H
 #  include <sys/resource.h>       // setrlimit()
@@ -49,6 +55,7 @@ typedef struct {
 
 #define fatal_error _PyRuntime.faulthandler.fatal_error
 #define thread _PyRuntime.faulthandler.thread
+#define slow _PyRuntime.faulthandler.slow
 
 #ifdef FAULTHANDLER_USER
 #define user_signals _PyRuntime.faulthandler.user_signals
@@ -840,6 +847,427 @@ faulthandler_cancel_dump_traceback_later_py(PyObject *self,
 }
 
 
+/* Slow sections: a thread arms a deadline with start_slow_section() and
+   disarms it with end_slow_section().  A watchdog thread records the
+   traceback of the thread in a ring buffer if the deadline expires.  As with
+   dump_traceback_later(), the watchdog reads the frames of a running thread
+   without holding the GIL, so the traceback is a best-effort snapshot. */
+
+static int
+slow_open_fd(void)
+{
+#ifdef HAVE_MEMFD_CREATE
+    int fd = memfd_create("faulthandler", MFD_CLOEXEC);
+    if (fd >= 0) {
+        return fd;
+    }
+#endif
+    FILE *fp = tmpfile();
+    if (fp == NULL) {
+        return -1;
+    }
+    int fd2 = dup(fileno(fp));
+    fclose(fp);
+    return fd2;
+}
+
+/* Read the traceback written into slow.fd.  Return a string allocated by
+   PyMem_RawMalloc(), or NULL on error. */
+static char*
+slow_read_traceback(size_t *size)
+{
+    off_t end = lseek(slow.fd, 0, SEEK_CUR);
+    if (end <= 0 || lseek(slow.fd, 0, SEEK_SET) != 0) {
+        return NULL;
+    }
+    char *buffer = PyMem_RawMalloc((size_t)end);
+    if (buffer == NULL) {
+        return NULL;
+    }
+    size_t len = 0;
+    while (len < (size_t)end) {
+        Py_ssize_t n = read(slow.fd, buffer + len, (size_t)end - len);
+        if (n <= 0) {
+            break;
+        }
+        len += (size_t)n;
+    }
+    *size = len;
+    return buffer;
+}
+
+/* Check that the thread state of the section still exists.  Must be called
+   with the runtime HEAD_LOCK held, which prevents it from being freed. */
+static int
+slow_section_alive(struct _faulthandler_slow_section *section)
+{
+    PyInterpreterState *interp = _PyRuntime.interpreters.head;
+    while (interp != NULL && interp != section->interp) {
+        interp = interp->next;
+    }
+    if (interp == NULL) {
+        return 0;
+    }
+    for (PyThreadState *t = interp->threads.head; t != NULL; t = t->next) {
+        if (t == section->tstate) {
+            return t->thread_id == section->thread_id;
+        }
+    }
+    return 0;
+}
+
+/* Record the traceback of the thread of an expired section.
+   Return -1 if the thread no longer exists. */
+static int
+slow_record(struct _faulthandler_slow_section *section, PyTime_t now)
+{
+    if (slow.fd < 0) {
+        slow.fd = slow_open_fd();
+    }
+
+    char *traceback = NULL;
+    size_t size = 0;
+    HEAD_LOCK(&_PyRuntime);
+    if (!slow_section_alive(section)) {
+        HEAD_UNLOCK(&_PyRuntime);
+        return -1;
+    }
+    if (slow.fd >= 0 && lseek(slow.fd, 0, SEEK_SET) == 0) {
+        _Py_DumpTraceback(slow.fd, section->tstate);
+        traceback = slow_read_traceback(&size);
+    }
+    HEAD_UNLOCK(&_PyRuntime);
+
+    struct _faulthandler_slow_record *record;
+    record = &slow.records[slow.nrecords % _Py_FAULTHANDLER_SLOW_RECORDS];
+    PyMem_RawFree(record->traceback);
+    record->thread_id = section->thread_id;
+    record->elapsed = now - section->start;
+    record->traceback = traceback;
+    record->size = size;
+    slow.nrecords++;
+    section->nrecorded++;
+    return 0;
+}
+
+static void
+faulthandler_slow_thread(void *unused)
+{
+#if defined(HAVE_PTHREAD_SIGMASK) && !defined(HAVE_BROKEN_PTHREAD_SIGMASK)
+    sigset_t set;
+
+    /* we don't want to receive any signal */
+    sigfillset(&set);
+    pthread_sigmask(SIG_SETMASK, &set, NULL);
+#endif
+
+    PyMutex_Lock(&slow.mutex);
+    while (!slow.stop) {
+        PyTime_t now;
+        (void)PyTime_MonotonicRaw(&now);
+
+        PyTime_t next = PyTime_MAX;
+        struct _faulthandler_slow_section **link = &slow.sections;
+        while (*link != NULL) {
+            struct _faulthandler_slow_section *section = *link;
+            if (section->deadline <= now) {
+                if (slow_record(section, now) < 0) {
+                    /* the thread exited without ending its section */
+                    *link = section->next;
+                    PyMem_RawFree(section);
+                    continue;
+                }
+                if (section->repeat) {
+                    section->deadline = Py_MAX(section->deadline + section->timeout,
+                                               now + 1);
+                }
+                else {
+                    section->deadline = PyTime_MAX;
+                }
+            }
+            next = Py_MIN(next, section->deadline);
+            link = &section->next;
+        }
+
+        int wakeup = slow.wakeup;
+        PyMutex_Unlock(&slow.mutex);
+        PyTime_t timeout = (next == PyTime_MAX) ? -1 : next - now;
+        (void)_PyParkingLot_Park(&slow.wakeup, &wakeup, sizeof(wakeup),
+                                 timeout, NULL, 0);
+        PyMutex_Lock(&slow.mutex);
+    }
+    PyMutex_Unlock(&slow.mutex);
+
+    /* The only way out */
+    PyThread_release_lock(slow.running);
+}
+
+/* Must be called with slow.mutex held */
+static void
+slow_wakeup(void)
+{
+    _Py_atomic_add_int(&slow.wakeup, 1);
+    _PyParkingLot_UnparkAll(&slow.wakeup);
+}
+
+static void
+slow_clear_records(void)
+{
+    for (size_t i = 0; i < _Py_FAULTHANDLER_SLOW_RECORDS; i++) {
+        PyMem_RawFree(slow.records[i].traceback);
+        slow.records[i].traceback = NULL;
+    }
+    slow.nrecords = 0;
+}
+
+/* Must be called with slow.mutex held */
+static struct _faulthandler_slow_section**
+slow_find_section(PyThreadState *tstate)
+{
+    struct _faulthandler_slow_section **link = &slow.sections;
+    while (*link != NULL && (*link)->tstate != tstate) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+/* The watchdog thread does not exist in a child process: forget the state
+   of the parent. */
+static void
+slow_check_fork(void)
+{
+#ifdef HAVE_FORK
+    if (slow.running && slow.pid != getpid()) {
+        _PyMutex_at_fork_reinit(&slow.mutex);
+        slow.sections = NULL;
+        slow.fd = -1;
+        slow.running = NULL;
+    }
+#endif
+}
+
+static int
+slow_start_thread(void)
+{
+    if (slow.running) {
+        return 0;
+    }
+
+    slow.running = PyThread_allocate_lock();
+    if (!slow.running) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    PyThread_acquire_lock(slow.running, 1);
+    slow.stop = 0;
+    slow.fd = -1;
+#ifdef HAVE_FORK
+    slow.pid = getpid();
+#endif
+    if (PyThread_start_new_thread(faulthandler_slow_thread, NULL) == PYTHREAD_INVALID_THREAD_ID) {
+        PyThread_release_lock(slow.running);
+        PyThread_free_lock(slow.running);
+        slow.running = NULL;
+        PyErr_SetString(PyExc_RuntimeError,
+                        "unable to start watchdog thread");
+        return -1;
+    }
+    return 0;
+}
+
+static void
+slow_stop_thread(void)
+{
+    slow_check_fork();
+    if (slow.running) {
+        PyMutex_Lock(&slow.mutex);
+        slow.stop = 1;
+        slow_wakeup();
+        PyMutex_Unlock(&slow.mutex);
+
+        /* Wait for thread to join */
+        PyThread_acquire_lock(slow.running, 1);
+        PyThread_release_lock(slow.running);
+        PyThread_free_lock(slow.running);
+        slow.running = NULL;
+    }
+
+    while (slow.sections != NULL) {
+        struct _faulthandler_slow_section *section = slow.sections;
+        slow.sections = section->next;
+        PyMem_RawFree(section);
+    }
+    if (slow.fd >= 0) {
+        close(slow.fd);
+        slow.fd = -1;
+    }
+    slow_clear_records();
+}
+
+static PyObject*
+faulthandler_start_slow_section(PyObject *self,
+                                PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"timeout", "repeat", NULL};
+    PyObject *timeout_obj;
+    PyTime_t timeout;
+    int repeat = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs,
+        "O|p:start_slow_section", kwlist,
+        &timeout_obj, &repeat))
+        return NULL;
+
+    if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                  _PyTime_ROUND_TIMEOUT) < 0) {
+        return NULL;
+    }
+    if (timeout <= 0) {
+        PyErr_SetString(PyExc_ValueError, "timeout must be greater than 0");
+        return NULL;
+    }
+
+    PyThreadState *tstate = get_thread_state();
+    if (tstate == NULL) {
+        return NULL;
+    }
+    PyTime_t now;
+    if (PyTime_Monotonic(&now) < 0) {
+        return NULL;
+    }
+    if (now > PyTime_MAX - timeout) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "timeout value is too large");
+        return NULL;
+    }
+
+    slow_check_fork();
+    if (slow_start_thread() < 0) {
+        return NULL;
+    }
+
+    PyMutex_Lock(&slow.mutex);
+    struct _faulthandler_slow_section **link = slow_find_section(tstate);
+    struct _faulthandler_slow_section *section = *link;
+    if (section == NULL) {
+        section = PyMem_RawMalloc(sizeof(*section));
+        if (section == NULL) {
+            PyMutex_Unlock(&slow.mutex);
+            return PyErr_NoMemory();
+        }
+        section->next = NULL;
+        *link = section;
+    }
+    section->interp = tstate->interp;
+    section->tstate = tstate;
+    section->thread_id = tstate->thread_id;
+    section->start = now;
+    section->timeout = timeout;
+    section->deadline = now + timeout;
+    section->repeat = repeat;
+    section->nrecorded = 0;
+    slow_wakeup();
+    PyMutex_Unlock(&slow.mutex);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject*
+faulthandler_end_slow_section(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    slow_check_fork();
+    PyThreadState *tstate = get_thread_state();
+    if (tstate == NULL) {
+        return NULL;
+    }
+    if (slow.running == NULL) {
+        return PyLong_FromLong(0);
+    }
+
+    int nrecorded = 0;
+    PyMutex_Lock(&slow.mutex);
+    struct _faulthandler_slow_section **link = slow_find_section(tstate);
+    struct _faulthandler_slow_section *section = *link;
+    if (section != NULL) {
+        nrecorded = section->nrecorded;
+        *link = section->next;
+        PyMem_RawFree(section);
+    }
+    PyMutex_Unlock(&slow.mutex);
+
+    return PyLong_FromLong(nrecorded);
+}
+
+static PyObject*
+faulthandler_get_slow_tracebacks(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    slow_check_fork();
+    PyObject *result = PyList_New(0);
+    if (result == NULL || slow.running == NULL) {
+        return result;
+    }
+
+    /* Copy the records with the raw allocator, and only create Python
+       objects once the mutex is released: an allocation can run the GC,
+       and a finalizer could enter a slow section and take the mutex. */
+    struct _faulthandler_slow_record records[_Py_FAULTHANDLER_SLOW_RECORDS];
+    int nomem = 0;
+    PyMutex_Lock(&slow.mutex);
+    size_t n = Py_MIN(slow.nrecords, (size_t)_Py_FAULTHANDLER_SLOW_RECORDS);
+    for (size_t i = 0; i < n; i++) {
+        size_t index = (slow.nrecords - n + i) % _Py_FAULTHANDLER_SLOW_RECORDS;
+        records[i] = slow.records[index];
+        if (records[i].traceback != NULL) {
+            char *traceback = PyMem_RawMalloc(records[i].size + 1);
+            if (traceback == NULL) {
+                nomem = 1;
+            }
+            else {
+                memcpy(traceback, records[i].traceback, records[i].size);
+            }
+            records[i].traceback = traceback;
+        }
+    }
+    PyMutex_Unlock(&slow.mutex);
+
+    if (nomem) {
+        PyErr_NoMemory();
+        Py_CLEAR(result);
+    }
+    for (size_t i = 0; i < n && result != NULL; i++) {
+        struct _faulthandler_slow_record *record = &records[i];
+        PyObject *item = Py_BuildValue(
+            "(kNN)", record->thread_id,
+            PyFloat_FromDouble(PyTime_AsSecondsDouble(record->elapsed)),
+            PyUnicode_DecodeASCII(record->traceback ? record->traceback : "",
+                                  (Py_ssize_t)record->size, "replace"));
+        if (item == NULL || PyList_Append(result, item) < 0) {
+            Py_XDECREF(item);
+            Py_CLEAR(result);
+            break;
+        }
+        Py_DECREF(item);
+    }
+    for (size_t i = 0; i < n; i++) {
+        PyMem_RawFree(records[i].traceback);
+    }
+    return result;
+}
+
+static PyObject*
+faulthandler_clear_slow_tracebacks(PyObject *self,
+                                   PyObject *Py_UNUSED(ignored))
+{
+    slow_check_fork();
+    if (slow.running != NULL) {
+        PyMutex_Lock(&slow.mutex);
+        slow_clear_records();
+        PyMutex_Unlock(&slow.mutex);
+    }
+    Py_RETURN_NONE;
+}
+
+
 #ifdef FAULTHANDLER_USER
 static int
 faulthandler_register(int signum, int chain, _Py_sighandler_t *previous_p)
@@ -1279,6 +1707,26 @@ static PyMethodDef module_methods[] = {
      faulthandler_cancel_dump_traceback_later_py, METH_NOARGS,
      PyDoc_STR("cancel_dump_traceback_later($module, /)\n--\n\n"
                "Cancel the previous call to dump_traceback_later().")},
+    {"start_slow_section",
+     _PyCFunction_CAST(faulthandler_start_slow_section), METH_VARARGS|METH_KEYWORDS,
+     PyDoc_STR("start_slow_section($module, /, timeout, repeat=False)\n--\n\n"
+               "Record the traceback of the current thread if it does not call\n"
+               "end_slow_section() within timeout seconds, or each timeout\n"
+               "seconds if repeat is True.")},
+    {"end_slow_section",
+     faulthandler_end_slow_section, METH_NOARGS,
+     PyDoc_STR("end_slow_section($module, /)\n--\n\n"
+               "End the slow section of the current thread and return the number\n"
+               "of tracebacks recorded for it.")},
+    {"get_slow_tracebacks",
+     faulthandler_get_slow_tracebacks, METH_NOARGS,
+     PyDoc_STR("get_slow_tracebacks($module, /)\n--\n\n"
+               "Get the recorded tracebacks of slow sections as a list of\n"
+               "(thread_id, elapsed, traceback) tuples, oldest first.")},
+    {"clear_slow_tracebacks",
+     faulthandler_clear_slow_tracebacks, METH_NOARGS,
+     PyDoc_STR("clear_slow_tracebacks($module, /)\n--\n\n"
+               "Clear the recorded tracebacks of slow sections.")},
 #ifdef FAULTHANDLER_USER
     {"register",
      _PyCFunction_CAST(faulthandler_register_py), METH_VARARGS|METH_KEYWORDS,
@@ -1412,6 +1860,8 @@ _PyFaulthandler_Init(int enable)
 #endif
 
     memset(&thread, 0, sizeof(thread));
+    memset(&slow, 0, sizeof(slow));
+    slow.fd = -1;
 
     if (enable) {
         if (faulthandler_init_enable() < 0) {
@@ -1435,6 +1885,9 @@ void _PyFaulthandler_Fini(void)
         thread.running = NULL;
     }
 
+    /* slow sections */
+    slow_stop_thread();
+
 #ifdef FAULTHANDLER_USER
     /* user */
     if (user_signals != NULL) {
@@ -2,6 +2,7 @@
 #include "pycore_call.h"              // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"             // _PyEval_GetBuiltin()
 #include "pycore_critical_section.h"  // Py_BEGIN_CRITICAL_SECTION()
+#include "pycore_list.h"              // _PyListIterObject
 #include "pycore_long.h"              // _PyLong_GetZero()
 #include "pycore_moduleobject.h"      // _PyModule_GetState()
 #include "pycore_typeobject.h"        // _PyType_GetModuleState()
@@ -95,6 +96,40 @@ class itertools.pairwise "pairwiseobject *" "clinic_state()->pairwise_type"
 #undef clinic_state
 
 
+#ifndef Py_GIL_DISABLED
+/* If it is an exact list or tuple iterator, return a pointer to the items it
+   has not produced yet, store their number in *count and the address of the
+   iterator's index in *pindex.  Callers may take up to *count items and then
+   advance the index themselves, which is what next() would have done.
+   Otherwise return NULL. */
+static PyObject **
+seqiter_remaining(PyObject *it, Py_ssize_t **pindex, Py_ssize_t *count)
+{
+    if (Py_IS_TYPE(it, &PyListIter_Type)) {
+        _PyListIterObject *li = (_PyListIterObject *)it;
+        if (li->it_seq == NULL || li->it_index < 0 ||
+            li->it_index >= PyList_GET_SIZE(li->it_seq)) {
+            return NULL;
+        }
+        *pindex = &li->it_index;
+        *count = PyList_GET_SIZE(li->it_seq) - li->it_index;
+        return li->it_seq->ob_item + li->it_index;
+    }
+    if (Py_IS_TYPE(it, &PyTupleIter_Type)) {
+        _PyTupleIterObject *ti = (_PyTupleIterObject *)it;
+        if (ti->it_seq == NULL ||
+            ti->it_index >= PyTuple_GET_SIZE(ti->it_seq)) {
+            return NULL;
+        }
+        *pindex = &ti->it_index;
+        *count = PyTuple_GET_SIZE(ti->it_seq) - ti->it_index;
+        return ti->it_seq->ob_item + ti->it_index;
+    }
+    return NULL;
+}
+#endif
+
+
 /* batched object ************************************************************/
 
 typedef struct {
@@ -203,8 +238,21 @@ batched_next(PyObject *op)
     if (result == NULL) {
         return NULL;
     }
-    iternextfunc iternext = *Py_TYPE(it)->tp_iternext;
     PyObject **items = _PyTuple_ITEMS(result);
+#ifndef Py_GIL_DISABLED
+    /* Copy full batches straight out of a list or tuple.  A short final
+       batch goes through next() so that exhaustion is handled as usual. */
+    Py_ssize_t *pindex, count;
+    PyObject **src = seqiter_remaining(it, &pindex, &count);
+    if (src != NULL && count >= n) {
+        for (i = 0; i < n; i++) {
+            items[i] = Py_NewRef(src[i]);
+        }
+        *pindex += n;
+        return result;
+    }
+#endif
+    iternextfunc iternext = *Py_TYPE(it)->tp_iternext;
     for (i=0 ; i < n ; i++) {
         item = iternext(it);
         if (item == NULL) {
@@ -1625,6 +1673,17 @@ islice_next(PyObject *op)
     if (it == NULL)
         return NULL;
 
+#ifndef Py_GIL_DISABLED
+    if (lz->cnt < lz->next) {
+        /* Jump over the skipped items of a list or tuple. */
+        Py_ssize_t *pindex, count;
+        if (seqiter_remaining(it, &pindex, &count) != NULL) {
+            Py_ssize_t skip = Py_MIN(lz->next - lz->cnt, count);
+            *pindex += skip;
+            lz->cnt += skip;
+        }
+    }
+#endif
     iternext = *Py_TYPE(it)->tp_iternext;
     while (lz->cnt < lz->next) {
         item = iternext(it);
@@ -72,6 +72,19 @@ raised for division by zero and mod by zero.
 
 #include "clinic/mathmodule.c.h"
 
+typedef struct {
+    /* array.array, looked up on first use by get_double_buffer() */
+    PyObject *array_type;
+} math_module_state;
+
+static inline math_module_state*
+get_math_module_state(PyObject *module)
+{
+    void *state = _PyModule_GetState(module);
+    assert(state != NULL);
+    return (math_module_state *)state;
+}
+
 /*[clinic input]
 module math
 [clinic start generated code]*/
@@ -218,6 +231,84 @@ static const double logpi = 1.144729885849400174143427351353058711647;
         }                                                  \
     }
 
+/*
+   fsum(), sumprod() and dist() read C doubles directly, without creating a
+   float object per item, when given a one-dimensional memoryview or an
+   array.array with format 'd'.  Iterating such an object yields exactly
+   those values, so the result is the same.  Subclasses of array.array
+   may override __iter__ and are not accepted.
+
+   Return 1 and fill *view on success, 0 if the fast path does not apply.
+*/
+static int
+is_exact_array(PyObject *module, PyObject *obj)
+{
+    math_module_state *state = get_math_module_state(module);
+    PyObject *array_type = _Py_atomic_load_ptr_acquire(&state->array_type);
+    if (array_type != NULL) {
+        return Py_IS_TYPE(obj, (PyTypeObject *)array_type);
+    }
+    PyTypeObject *tp = Py_TYPE(obj);
+    if (tp->tp_as_buffer == NULL || tp->tp_as_buffer->bf_getbuffer == NULL) {
+        return 0;
+    }
+    /* Look the type up in the array module of this interpreter and keep
+       it.  If that module has not been imported, obj cannot be an array. */
+    PyObject *array_module;
+    if (PyDict_GetItemStringRef(PyImport_GetModuleDict(), "array",
+                                &array_module) <= 0)
+    {
+        PyErr_Clear();
+        return 0;
+    }
+    array_type = PyObject_GetAttrString(array_module, "array");
+    Py_DECREF(array_module);
+    if (array_type == NULL || !PyType_Check(array_type)) {
+        PyErr_Clear();
+        Py_XDECREF(array_type);
+        return 0;
+    }
+    int res = Py_IS_TYPE(obj, (PyTypeObject *)array_type);
+    void *expected = NULL;
+    if (!_Py_atomic_compare_exchange_ptr(&state->array_type, &expected,
+                                         array_type))
+    {
+        /* Another thread stored it first */
+        Py_DECREF(array_type);
+    }
+    return res;
+}
+
+static int
+get_double_buffer(PyObject *module, PyObject *obj, Py_buffer *view)
+{
+    if (!PyMemoryView_Check(obj) && !is_exact_array(module, obj)) {
+        return 0;
+    }
+    if (PyObject_GetBuffer(obj, view, PyBUF_FULL_RO) < 0) {
+        /* Let the iteration report the error, if any. */
+        PyErr_Clear();
+        return 0;
+    }
+    if (view->ndim == 1 && view->suboffsets == NULL
+        && view->itemsize == sizeof(double)
+        && (strcmp(view->format, "d") == 0
+            || strcmp(view->format, "@d") == 0))
+    {
+        return 1;
+    }
+    PyBuffer_Release(view);
+    return 0;
+}
+
+static inline double
+double_buffer_item(Py_buffer *view, Py_ssize_t i)
+{
+    double x;
+    memcpy(&x, (char *)view->buf + i * view->strides[0], sizeof(double));
+    return x;
+}
+
 static double
 m_sinpi(double x)
 {
@@ -1380,29 +1471,40 @@ static PyObject *
 math_fsum(PyObject *module, PyObject *seq)
 /*[clinic end generated code: output=ba5c672b87fe34fc input=4506244ded6057dc]*/
 {
-    PyObject *item, *iter, *sum = NULL;
-    Py_ssize_t i, j, n = 0, m = NUM_PARTIALS;
+    PyObject *item, *iter = NULL, *sum = NULL;
+    Py_ssize_t i, j, k, n = 0, m = NUM_PARTIALS;
     double x, y, t, ps[NUM_PARTIALS], *p = ps;
     double xsave, special_sum = 0.0, inf_sum = 0.0;
     double hi, yr, lo = 0.0;
+    Py_buffer view;
+    int use_buffer = get_double_buffer(module, seq, &view);
 
-    iter = PyObject_GetIter(seq);
-    if (iter == NULL)
-        return NULL;
+    if (!use_buffer) {
+        iter = PyObject_GetIter(seq);
+        if (iter == NULL)
+            return NULL;
+    }
 
-    for(;;) {           /* for x in iterable */
+    for(k = 0;; k++) {  /* for x in iterable */
         assert(0 <= n && n <= m);
         assert((m == NUM_PARTIALS && p == ps) ||
                (m >  NUM_PARTIALS && p != NULL));
 
-        item = PyIter_Next(iter);
-        if (item == NULL) {
-            if (PyErr_Occurred())
-                goto _fsum_error;
-            break;
+        if (use_buffer) {
+            if (k >= view.shape[0])
+                break;
+            x = double_buffer_item(&view, k);
+        }
+        else {
+            item = PyIter_Next(iter);
+            if (item == NULL) {
+                if (PyErr_Occurred())
+                    goto _fsum_error;
+                break;
+            }
+            ASSIGN_DOUBLE(x, item, error_with_item);
+            Py_DECREF(item);
         }
-        ASSIGN_DOUBLE(x, item, error_with_item);
-        Py_DECREF(item);
 
         xsave = x;
         for (i = j = 0; j < n; j++) {       /* for y in partials */
@@ -1484,7 +1586,9 @@ math_fsum(PyObject *module, PyObject *seq)
     sum = PyFloat_FromDouble(hi);
 
   _fsum_error:
-    Py_DECREF(iter);
+    Py_XDECREF(iter);
+    if (use_buffer)
+        PyBuffer_Release(&view);
     if (p != ps)
         PyMem_Free(p);
     return sum;
@@ -2620,29 +2724,46 @@ math_dist_impl(PyObject *module, PyObject *p, PyObject *q)
     double x, px, qx, result;
     Py_ssize_t i, m, n;
     int found_nan = 0, p_allocated = 0, q_allocated = 0;
+    int use_buffers = 0;
+    Py_buffer p_view, q_view;
     double diffs_on_stack[NUM_STACK_ELEMS];
     double *diffs = diffs_on_stack;
 
-    if (!PyTuple_Check(p)) {
-        p = PySequence_Tuple(p);
-        if (p == NULL) {
-            return NULL;
+    if (get_double_buffer(module, p, &p_view)) {
+        if (get_double_buffer(module, q, &q_view)) {
+            use_buffers = 1;
+        }
+        else {
+            PyBuffer_Release(&p_view);
         }
-        p_allocated = 1;
     }
-    if (!PyTuple_Check(q)) {
-        q = PySequence_Tuple(q);
-        if (q == NULL) {
-            if (p_allocated) {
-                Py_DECREF(p);
+
+    if (use_buffers) {
+        m = p_view.shape[0];
+        n = q_view.shape[0];
+    }
+    else {
+        if (!PyTuple_Check(p)) {
+            p = PySequence_Tuple(p);
+            if (p == NULL) {
+                return NULL;
             }
-            return NULL;
+            p_allocated = 1;
+        }
+        if (!PyTuple_Check(q)) {
+            q = PySequence_Tuple(q);
+            if (q == NULL) {
+                if (p_allocated) {
+                    Py_DECREF(p);
+                }
+                return NULL;
+            }
+            q_allocated = 1;
         }
-        q_allocated = 1;
-    }
 
-    m = PyTuple_GET_SIZE(p);
-    n = PyTuple_GET_SIZE(q);
+        m = PyTuple_GET_SIZE(p);
+        n = PyTuple_GET_SIZE(q);
+    }
     if (m != n) {
         PyErr_SetString(PyExc_ValueError,
                         "both points must have the same number of dimensions");
@@ -2656,10 +2777,16 @@ math_dist_impl(PyObject *module, PyObject *p, PyObject *q)
         }
     }
     for (i=0 ; i<n ; i++) {
-        item = PyTuple_GET_ITEM(p, i);
-        ASSIGN_DOUBLE(px, item, error_exit);
-        item = PyTuple_GET_ITEM(q, i);
-        ASSIGN_DOUBLE(qx, item, error_exit);
+        if (use_buffers) {
+            px = double_buffer_item(&p_view, i);
+            qx = double_buffer_item(&q_view, i);
+        }
+        else {
+            item = PyTuple_GET_ITEM(p, i);
+            ASSIGN_DOUBLE(px, item, error_exit);
+            item = PyTuple_GET_ITEM(q, i);
+            ASSIGN_DOUBLE(qx, item, error_exit);
+        }
         x = fabs(px - qx);
         diffs[i] = x;
         found_nan |= isnan(x);
@@ -2677,6 +2804,10 @@ math_dist_impl(PyObject *module, PyObject *p, PyObject *q)
     if (q_allocated) {
         Py_DECREF(q);
     }
+    if (use_buffers) {
+        PyBuffer_Release(&p_view);
+        PyBuffer_Release(&q_view);
+    }
     return PyFloat_FromDouble(result);
 
   error_exit:
@@ -2689,6 +2820,10 @@ math_dist_impl(PyObject *module, PyObject *p, PyObject *q)
     if (q_allocated) {
         Py_DECREF(q);
     }
+    if (use_buffers) {
+        PyBuffer_Release(&p_view);
+        PyBuffer_Release(&q_view);
+    }
     return NULL;
 }
 
@@ -2766,6 +2901,42 @@ long_add_would_overflow(long a, long b)
     return (a > 0) ? (b > LONG_MAX - a) : (b < LONG_MIN - a);
 }
 
+/* sumprod() of two buffers of C doubles.  This follows the float path
+   of math_sumprod_impl() below: products are accumulated with extended
+   precision until the total stops being finite, then the remaining terms
+   are added with ordinary float arithmetic. */
+static PyObject *
+sumprod_double_buffers(Py_buffer *p_view, Py_buffer *q_view)
+{
+    Py_ssize_t i, n = p_view->shape[0];
+    TripleLength flt_total = tl_zero;
+    double total = 0.0;
+
+    if (n != q_view->shape[0]) {
+        PyErr_Format(PyExc_ValueError, "Inputs are not the same length");
+        return NULL;
+    }
+    if (n == 0) {
+        return PyLong_FromLong(0);
+    }
+    for (i = 0; i < n; i++) {
+        double flt_p = double_buffer_item(p_view, i);
+        double flt_q = double_buffer_item(q_view, i);
+        TripleLength new_flt_total = tl_fma(flt_p, flt_q, flt_total);
+        if (!isfinite(new_flt_total.hi)) {
+            break;
+        }
+        flt_total = new_flt_total;
+    }
+    if (i > 0) {
+        total += tl_to_d(flt_total);
+    }
+    for (; i < n; i++) {
+        total += double_buffer_item(p_view, i) * double_buffer_item(q_view, i);
+    }
+    return PyFloat_FromDouble(total);
+}
+
 /*[clinic input]
 math.sumprod
 
@@ -2795,6 +2966,17 @@ math_sumprod_impl(PyObject *module, PyObject *p, PyObject *q)
     bool flt_path_enabled = true, flt_total_in_use = false;
     long int_total = 0;
     TripleLength flt_total = tl_zero;
+    Py_buffer p_view, q_view;
+
+    if (get_double_buffer(module, p, &p_view)) {
+        if (get_double_buffer(module, q, &q_view)) {
+            total = sumprod_double_buffers(&p_view, &q_view);
+            PyBuffer_Release(&p_view);
+            PyBuffer_Release(&q_view);
+            return total;
+        }
+        PyBuffer_Release(&p_view);
+    }
 
     p_it = PyObject_GetIter(p);
     if (p_it == NULL) {
@@ -4168,6 +4350,28 @@ math_exec(PyObject *module)
     return 0;
 }
 
+static int
+math_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    math_module_state *state = get_math_module_state(module);
+    Py_VISIT(state->array_type);
+    return 0;
+}
+
+static int
+math_clear(PyObject *module)
+{
+    math_module_state *state = get_math_module_state(module);
+    Py_CLEAR(state->array_type);
+    return 0;
+}
+
+static void
+math_free(void *module)
+{
+    math_clear((PyObject *)module);
+}
+
 static PyMethodDef math_methods[] = {
     {"acos",            math_acos,      METH_O,         math_acos_doc},
     {"acosh",           math_acosh,     METH_O,         math_acosh_doc},
@@ -4247,9 +4451,12 @@ static struct PyModuleDef mathmodule = {
     PyModuleDef_HEAD_INIT,
     .m_name = "math",
     .m_doc = module_doc,
-    .m_size = 0,
+    .m_size = sizeof(math_module_state),
     .m_methods = math_methods,
     .m_slots = math_slots,
+    .m_traverse = math_traverse,
+    .m_clear = math_clear,
+    .m_free = math_free,
 };
 
 PyMODINIT_FUNC
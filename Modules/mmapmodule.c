@@ -1964,6 +1964,9 @@ mmap_exec(PyObject *module)
 #ifdef MAP_POPULATE
     ADD_INT_MACRO(module, MAP_POPULATE);
 #endif
+#ifdef MAP_HUGETLB
+    ADD_INT_MACRO(module, MAP_HUGETLB);
+#endif
 #ifdef MAP_STACK
     // Mostly a no-op on Linux and NetBSD, but useful on OpenBSD
     // for stack usage (even on x86 arch)
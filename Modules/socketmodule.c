@@ -5086,6 +5086,259 @@ _socket_socket_sendmsg_impl(PySocketSockObject *s, PyObject *data_arg,
 
 #endif    /* CMSG_LEN */
 
+#if defined(HAVE_RECVMMSG) || defined(HAVE_SENDMMSG)
+struct sock_mmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+#endif
+
+#ifdef HAVE_RECVMMSG
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_mmsg *ctx = data;
+
+    ctx->result = recvmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags, NULL);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.recvmmsg_into
+    self as s: self(type="PySocketSockObject *")
+    buffers as buffers_arg: object
+    flags: int = 0
+    /
+
+Receive several messages with a single system call.
+
+One message is received into each of the writable buffers in the
+iterable buffers.  Return as soon as at least one message has been
+received.  The return value is a list with one (nbytes, address info)
+tuple per message received, in the order of the buffers used.  The
+flags argument defaults to 0 and has the same meaning as for recv().
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s,
+                                  PyObject *buffers_arg, int flags)
+/*[clinic end generated code: output=020b90ce0091b16f input=0b82e45d65138862]*/
+{
+    socklen_t addrlen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *fast, *retval = NULL;
+    struct sock_mmsg ctx;
+
+    if (!getsockaddrlen(s, &addrlen))
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    /* One message header, iovec and address buffer per buffer; save the
+       Py_buffer structs to release afterwards. */
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    memset(addrbufs, 0, nitems * sizeof(sock_addr_t));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+        msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    /* Return as soon as at least one message has arrived, so that a
+       timeout or a blocking socket behaves as for recvfrom(). */
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags | MSG_WAITFORONE;
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyList_New(ctx.result);
+    if (retval == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        PyObject *addr = makesockaddr(get_sock_fd(s),
+                                      SAS2SA(&addrbufs[i]),
+                                      msgvec[i].msg_hdr.msg_namelen,
+                                      s->sock_proto);
+        if (addr == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyObject *item = Py_BuildValue("IN", msgvec[i].msg_len, addr);
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_RECVMMSG */
+
+#ifdef HAVE_SENDMMSG
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_mmsg *ctx = data;
+
+    ctx->result = sendmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.sendmmsg
+    self as s: self(type="PySocketSockObject *")
+    buffers as buffers_arg: object
+    flags: int = 0
+    address as addr_arg: object = NULL
+    /
+
+Send several messages with a single system call.
+
+Each bytes-like object in the iterable buffers is sent as a separate
+message.  The flags argument defaults to 0 and has the same meaning as
+for send().  If address is supplied and not None, it is the destination
+of all the messages.  Return the number of messages sent, which may be
+less than the number of buffers.
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *buffers_arg,
+                             int flags, PyObject *addr_arg)
+/*[clinic end generated code: output=5141b3f4bfbc8598 input=32ac454e64fff573]*/
+{
+    sock_addr_t addrbuf;
+    int addrlen = 0;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *fast = NULL, *retval = NULL;
+    struct sock_mmsg ctx;
+
+    /* Parse destination address. */
+    if (addr_arg != NULL && addr_arg != Py_None) {
+        if (!getsockaddrarg(s, addr_arg, &addrbuf, &addrlen, "sendmmsg"))
+            return NULL;
+        if (PySys_Audit("socket.sendmmsg", "OO", s, addr_arg) < 0)
+            return NULL;
+    }
+    else {
+        if (PySys_Audit("socket.sendmmsg", "OO", s, Py_None) < 0)
+            return NULL;
+    }
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "bytes-like objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+        if (addrlen > 0) {
+            msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbuf);
+            msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+        }
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_XDECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PyObject *s, PyObject *args, PyObject *kwds)
@@ -5443,6 +5696,8 @@ static PyMethodDef sock_methods[] = {
     {"recvmsg_into", sock_recvmsg_into, METH_VARARGS, recvmsg_into_doc},
     _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif
+    _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    _SOCKET_SOCKET_SENDMMSG_METHODDEF
 #ifdef HAVE_SOCKADDR_ALG
     {
         "sendmsg_afalg",
@@ -846,6 +846,207 @@ is_normalized_quickcheck(PyObject *self, PyObject *input, bool nfc, bool k,
     return result;
 }
 
+/* A run of characters which already are normalized must be at least this
+   long before normalize() copies it verbatim rather than normalizing it
+   along with the spans around it. */
+#define NORMALIZE_MIN_RUN 32
+
+/* Return the number of ASCII characters at the start of p[0:n]. */
+static Py_ssize_t
+ascii_prefix_length(const Py_UCS1 *p, Py_ssize_t n)
+{
+    const size_t mask = (size_t)0x8080808080808080ULL;
+    Py_ssize_t i = 0;
+    while (i + (Py_ssize_t)sizeof(size_t) <= n) {
+        size_t word;
+        memcpy(&word, p + i, sizeof(size_t));
+        if (word & mask) {
+            break;
+        }
+        i += sizeof(size_t);
+    }
+    while (i < n && p[i] < 0x80) {
+        i++;
+    }
+    return i;
+}
+
+/* Return -1 if ch fails the quickcheck at quickcheck_shift, or is out of
+   canonical order after a character of combining class *prev_combining.
+   Otherwise return 1 if ch is a starter, which makes it a normalization
+   boundary, and 0 if not.  Update *prev_combining. */
+static inline int
+quickcheck_char(Py_UCS4 ch, int quickcheck_shift,
+                unsigned char *prev_combining)
+{
+    const _PyUnicode_DatabaseRecord *record = _getrecord_ex(ch);
+    unsigned char combining = record->combining;
+    unsigned char prev = *prev_combining;
+    *prev_combining = combining;
+    if ((record->normalization_quick_check & (3 << quickcheck_shift))
+        || (combining && prev > combining))
+    {
+        return -1;
+    }
+    return combining == 0;
+}
+
+static PyObject *
+normalize_span(PyObject *self, PyObject *input, bool nfc, bool k)
+{
+    return nfc ? nfc_nfkc(self, input, k) : nfd_nfkd(self, input, k);
+}
+
+/* Write input[start:end] to writer in normal form. */
+static int
+write_normalized(PyUnicodeWriter *writer, PyObject *self, PyObject *input,
+                 Py_ssize_t start, Py_ssize_t end, bool nfc, bool k)
+{
+    PyObject *span = PyUnicode_Substring(input, start, end);
+    if (span == NULL) {
+        return -1;
+    }
+    PyObject *normalized = normalize_span(self, span, nfc, k);
+    Py_DECREF(span);
+    if (normalized == NULL) {
+        return -1;
+    }
+    int res = PyUnicodeWriter_WriteStr(writer, normalized);
+    Py_DECREF(normalized);
+    return res;
+}
+
+/* Normalize input one span at a time.
+ *
+ * A starter which passes the quickcheck is a normalization boundary:
+ * the text before it and the text from it onwards normalize
+ * independently.  Only the spans around characters which fail the
+ * quickcheck are decomposed and composed again; runs of at least
+ * NORMALIZE_MIN_RUN normalized characters between them are copied
+ * verbatim.  ASCII characters always pass, and are skipped a word at a
+ * time in 1-byte strings.
+ */
+static PyObject *
+normalize_segments(PyObject *self, PyObject *input, bool nfc, bool k)
+{
+    int quickcheck_shift = (nfc ? 4 : 0) + (k ? 2 : 0);
+    int kind = PyUnicode_KIND(input);
+    const void *data = PyUnicode_DATA(input);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(input);
+    PyUnicodeWriter *writer = NULL;
+    /* input[:pos] has been written. */
+    Py_ssize_t pos = 0;
+    /* Start of the span waiting to be normalized, or -1. */
+    Py_ssize_t span = -1;
+    /* Boundary starting the current run of normalized characters, or -1.
+       While no span is waiting, the last boundary seen. */
+    Py_ssize_t run = 0;
+    unsigned char prev_combining = 0;
+    Py_ssize_t i = 0;
+
+    while (i < len) {
+        /* Look for the next character which fails the quickcheck,
+           remembering the last boundary before it. */
+        if (kind == PyUnicode_1BYTE_KIND) {
+            const Py_UCS1 *p = (const Py_UCS1 *)data;
+            while (i < len) {
+                if (p[i] < 0x80) {
+                    i += ascii_prefix_length(p + i, len - i);
+                    run = i - 1;
+                    prev_combining = 0;
+                    continue;
+                }
+                int check = quickcheck_char(p[i], quickcheck_shift,
+                                            &prev_combining);
+                if (check < 0) {
+                    break;
+                }
+                if (check) {
+                    run = i;
+                }
+                i++;
+            }
+        }
+        else {
+            while (i < len) {
+                int check = quickcheck_char(PyUnicode_READ(kind, data, i),
+                                            quickcheck_shift, &prev_combining);
+                if (check < 0) {
+                    break;
+                }
+                if (check) {
+                    run = i;
+                }
+                i++;
+            }
+        }
+        if (i == len) {
+            break;
+        }
+
+        /* Extend the span until it is followed by a long enough run of
+           normalized characters. */
+        span = run;
+        run = -1;
+        while (i < len && (run < 0 || i - run < NORMALIZE_MIN_RUN)) {
+            int check = quickcheck_char(PyUnicode_READ(kind, data, i),
+                                        quickcheck_shift, &prev_combining);
+            if (check < 0) {
+                run = -1;
+            }
+            else if (check && run < 0) {
+                run = i;
+            }
+            i++;
+        }
+        if (run < 0 || i - run < NORMALIZE_MIN_RUN) {
+            break;
+        }
+        if (writer == NULL) {
+            writer = PyUnicodeWriter_Create(len);
+            if (writer == NULL) {
+                return NULL;
+            }
+        }
+        if (PyUnicodeWriter_WriteSubstring(writer, input, pos, span) < 0
+            || write_normalized(writer, self, input, span, run, nfc, k) < 0)
+        {
+            PyUnicodeWriter_Discard(writer);
+            return NULL;
+        }
+        pos = run;
+        span = -1;
+    }
+
+    if (writer == NULL) {
+        if (span < 0) {
+            return PyUnicode_FromObject(input);
+        }
+        if (span == 0 && (run < 0 || len - run < NORMALIZE_MIN_RUN)) {
+            return normalize_span(self, input, nfc, k);
+        }
+        writer = PyUnicodeWriter_Create(len);
+        if (writer == NULL) {
+            return NULL;
+        }
+    }
+    if (span >= 0) {
+        Py_ssize_t end = run >= 0 ? run : len;
+        if (PyUnicodeWriter_WriteSubstring(writer, input, pos, span) < 0
+            || write_normalized(writer, self, input, span, end, nfc, k) < 0)
+        {
+            PyUnicodeWriter_Discard(writer);
+            return NULL;
+        }
+        pos = end;
+    }
+    if (PyUnicodeWriter_WriteSubstring(writer, input, pos, len) < 0) {
+        PyUnicodeWriter_Discard(writer);
+        return NULL;
+    }
+    return PyUnicodeWriter_Finish(writer);
+}
+
 /*[clinic input]
 unicodedata.UCD.is_normalized
 
@@ -938,36 +1139,36 @@ unicodedata_UCD_normalize_impl(PyObject *self, PyObject *form,
         return PyUnicode_FromObject(input);
     }
 
+    bool nfc, k;
     if (PyUnicode_CompareWithASCIIString(form, "NFC") == 0) {
-        if (is_normalized_quickcheck(self, input,
-                                     true,  false, true) == YES) {
-            return PyUnicode_FromObject(input);
-        }
-        return nfc_nfkc(self, input, 0);
+        nfc = true;
+        k = false;
     }
-    if (PyUnicode_CompareWithASCIIString(form, "NFKC") == 0) {
-        if (is_normalized_quickcheck(self, input,
-                                     true,  true,  true) == YES) {
-            return PyUnicode_FromObject(input);
-        }
-        return nfc_nfkc(self, input, 1);
+    else if (PyUnicode_CompareWithASCIIString(form, "NFKC") == 0) {
+        nfc = true;
+        k = true;
     }
-    if (PyUnicode_CompareWithASCIIString(form, "NFD") == 0) {
-        if (is_normalized_quickcheck(self, input,
-                                     false, false, true) == YES) {
-            return PyUnicode_FromObject(input);
-        }
-        return nfd_nfkd(self, input, 0);
+    else if (PyUnicode_CompareWithASCIIString(form, "NFD") == 0) {
+        nfc = false;
+        k = false;
     }
-    if (PyUnicode_CompareWithASCIIString(form, "NFKD") == 0) {
-        if (is_normalized_quickcheck(self, input,
-                                     false, true,  true) == YES) {
-            return PyUnicode_FromObject(input);
-        }
-        return nfd_nfkd(self, input, 1);
+    else if (PyUnicode_CompareWithASCIIString(form, "NFKD") == 0) {
+        nfc = false;
+        k = true;
+    }
+    else {
+        PyErr_SetString(PyExc_ValueError, "invalid normalization form");
+        return NULL;
+    }
+
+    if (UCD_Check(self)) {
+        /* UCD 3.2.0 is requested, quickchecks must be disabled. */
+        return normalize_span(self, input, nfc, k);
+    }
+    if (PyUnicode_IS_ASCII(input)) {
+        return PyUnicode_FromObject(input);
     }
-    PyErr_SetString(PyExc_ValueError, "invalid normalization form");
-    return NULL;
+    return normalize_segments(self, input, nfc, k);
 }
 
 /* -------------------------------------------------------------------- */
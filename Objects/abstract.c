@@ -5,6 +5,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCallTstate()
 #include "pycore_crossinterp.h"   // _Py_CallInInterpreter()
+#include "pycore_floatobject.h"   // _PyFloat_FormatAdvancedWriter()
 #include "pycore_genobject.h"     // _PyGen_FetchStopIterationValue()
 #include "pycore_list.h"          // _PyList_AppendTakeRef()
 #include "pycore_long.h"          // _PyLong_IsNegative()
@@ -13,6 +14,7 @@
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_tuple.h"         // _PyTuple_FromArraySteal()
+#include "pycore_unicodeobject.h" // _PyUnicode_FormatAdvancedWriter()
 #include "pycore_unionobject.h"   // _PyUnion_Check()
 
 #include <stddef.h>               // offsetof()
@@ -868,6 +870,32 @@ PyObject_Format(PyObject *obj, PyObject *format_spec)
         empty = Py_GetConstant(Py_CONSTANT_EMPTY_STR);
         format_spec = empty;
     }
+    else {
+        /* If we know the type exactly, skip the lookup of __format__ and
+           call the formatter directly, as str.format() does. */
+        int (*formatter) (_PyUnicodeWriter*, PyObject *, PyObject *,
+                          Py_ssize_t, Py_ssize_t) = NULL;
+        if (PyUnicode_CheckExact(obj)) {
+            formatter = _PyUnicode_FormatAdvancedWriter;
+        }
+        else if (PyLong_CheckExact(obj)) {
+            formatter = _PyLong_FormatAdvancedWriter;
+        }
+        else if (PyFloat_CheckExact(obj)) {
+            formatter = _PyFloat_FormatAdvancedWriter;
+        }
+
+        if (formatter) {
+            _PyUnicodeWriter writer;
+            _PyUnicodeWriter_Init(&writer);
+            if (formatter(&writer, obj, format_spec,
+                          0, PyUnicode_GET_LENGTH(format_spec)) == -1) {
+                _PyUnicodeWriter_Dealloc(&writer);
+                return NULL;
+            }
+            return _PyUnicodeWriter_Finish(&writer);
+        }
+    }
 
     /* Find the (unbound!) __format__ method */
     meth = _PyObject_LookupSpecial(obj, &_Py_ID(__format__));
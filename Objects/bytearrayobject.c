@@ -228,6 +228,18 @@ bytearray_resize_lock_held(PyObject *self, Py_ssize_t requested_size)
             return 0;
         }
     }
+    else if (logical_offset > 0 && size + (size >> 3) < alloc) {
+        /* The buffer is large enough if the bytes deleted from the front
+           (see bytearray_setslice_linear()) are reclaimed, with at least
+           as much headroom as growing would leave: move the data back to
+           the start of the buffer instead of reallocating it. */
+        memmove(obj->ob_bytes, obj->ob_start,
+                Py_MIN((size_t)requested_size, (size_t)Py_SIZE(self)));
+        obj->ob_start = obj->ob_bytes;
+        Py_SET_SIZE(self, size);
+        obj->ob_bytes[size] = '\0'; /* Trailing null byte */
+        return 0;
+    }
     else {
         /* Need growing, decide on a strategy */
         if (size <= alloc * 1.125) {
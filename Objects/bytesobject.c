@@ -1668,6 +1668,11 @@ bytes_subscript(PyObject *op, PyObject* item)
             return Py_NewRef(self);
         }
         else if (step == 1) {
+            /* Always a copy: the data of a bytes object lives inline in the
+               object and PyBytes_AS_STRING() is a macro compiled into
+               extension modules, so a bytes object cannot refer to the
+               buffer of another one.  memoryview slicing is the zero-copy
+               alternative. */
             return PyBytes_FromStringAndSize(
                 PyBytes_AS_STRING(self) + start,
                 slicelength);
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include "pycore_cell.h"          // PyCell_GetRef()
+#include "pycore_freelist.h"      // _Py_FREELIST_POP()
 #include "pycore_modsupport.h"    // _PyArg_NoKeywords()
 #include "pycore_object.h"
 
@@ -10,11 +11,13 @@
 PyObject *
 PyCell_New(PyObject *obj)
 {
-    PyCellObject *op;
-
-    op = (PyCellObject *)PyObject_GC_New(PyCellObject, &PyCell_Type);
-    if (op == NULL)
-        return NULL;
+    PyCellObject *op = _Py_FREELIST_POP(PyCellObject, cells);
+    if (op == NULL) {
+        op = PyObject_GC_New(PyCellObject, &PyCell_Type);
+        if (op == NULL) {
+            return NULL;
+        }
+    }
     op->ob_ref = Py_XNewRef(obj);
 
     _PyObject_GC_TRACK(op);
@@ -79,7 +82,8 @@ cell_dealloc(PyObject *self)
     PyCellObject *op = _PyCell_CAST(self);
     _PyObject_GC_UNTRACK(op);
     Py_XDECREF(op->ob_ref);
-    PyObject_GC_Del(op);
+    assert(Py_IS_TYPE(self, &PyCell_Type));
+    _Py_FREELIST_FREE(cells, self, PyObject_GC_Del);
 }
 
 static PyObject *
@@ -124,6 +124,7 @@ As a consequence of this, split keys have a maximum size of 16.
 #include "pycore_dict.h"          // export _PyDict_SizeOf()
 #include "pycore_freelist.h"      // _PyFreeListState_GET()
 #include "pycore_gc.h"            // _PyObject_GC_IS_TRACKED()
+#include "pycore_long.h"          // _PyLong_BothAreCompact()
 #include "pycore_object.h"        // _PyObject_GC_TRACK(), _PyDebugAllocatorStats()
 #include "pycore_pyatomic_ft_wrappers.h" // FT_ATOMIC_LOAD_SSIZE_RELAXED
 #include "pycore_pyerrors.h"      // _PyErr_GetRaisedException()
@@ -1109,6 +1110,15 @@ compare_generic(PyDictObject *mp, PyDictKeysObject *dk,
     }
     if (ep->me_hash == hash) {
         PyObject *startkey = ep->me_key;
+        if (PyLong_CheckExact(startkey) && PyLong_CheckExact(key) &&
+            _PyLong_BothAreCompact((PyLongObject *)startkey,
+                                   (PyLongObject *)key))
+        {
+            // Equal ints that are not the same object, e.g. computed ints
+            // outside the small int cache: no need for rich comparison.
+            return (_PyLong_CompactValue((PyLongObject *)startkey) ==
+                    _PyLong_CompactValue((PyLongObject *)key));
+        }
         Py_INCREF(startkey);
         int cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
         Py_DECREF(startkey);
@@ -4138,6 +4148,13 @@ copy_lock_held(PyObject *o)
     return NULL;
 }
 
+/* In the free-threaded build, reads such as lookups and iteration already
+   avoid the per-object lock (see dictiter_iternext_threadsafe()), and so
+   does list.index().  The copy keeps the exclusive critical section: it
+   needs a consistent snapshot of the keys object, and an optimistic
+   (seqlock-style) copy would have to drop and retry every reference it
+   took whenever a writer intervenes.  The lock is held for the duration of
+   a memcpy-like loop, so a shared/exclusive mode would not buy much here. */
 PyObject *
 PyDict_Copy(PyObject *o)
 {
@@ -6764,6 +6781,12 @@ _PyObject_InitInlineValues(PyObject *obj, PyTypeObject *tp)
     PyDictKeysObject *keys = CACHED_KEYS(tp);
     assert(keys != NULL);
     OBJECT_STAT_INC(inline_values);
+    // Each new instance reserves one spare slot fewer than the previous one,
+    // on the assumption that the attributes are known once a few instances
+    // have been initialized.  Attributes that are first assigned after many
+    // instances were created therefore end up in a materialized dict
+    // (dict_materialized_new_key in the stats).  The order of assignment
+    // does not matter: each instance has its own insertion order array.
 #ifdef Py_GIL_DISABLED
     Py_ssize_t usable = _Py_atomic_load_ssize_relaxed(&keys->dk_usable);
     if (usable > 1) {
@@ -135,8 +135,33 @@ PyFloat_FromDouble(double fval)
     return (PyObject *) op;
 }
 
+#ifndef Py_STACKREF_DEBUG
+/* If the stack holds the only reference to an exact float operand, store the
+ * result in that object rather than freeing it and allocating another one.
+ * Borrowed references (LOAD_FAST_BORROW, constants) are not counted on the
+ * object and are never reused. */
+static inline int
+float_is_reusable(_PyStackRef ref)
+{
+    return (!PyStackRef_IsDeferredOrTaggedInt(ref) &&
+            _PyObject_IsUniquelyReferenced(PyStackRef_AsPyObjectBorrow(ref)));
+}
+#endif
+
 _PyStackRef _PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right, double value)
 {
+#ifndef Py_STACKREF_DEBUG
+    if (float_is_reusable(left)) {
+        PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+        ((PyFloatObject *)PyStackRef_AsPyObjectBorrow(left))->ob_fval = value;
+        return left;
+    }
+    if (float_is_reusable(right)) {
+        PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+        ((PyFloatObject *)PyStackRef_AsPyObjectBorrow(right))->ob_fval = value;
+        return right;
+    }
+#endif
     PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
     PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
     return PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(value));
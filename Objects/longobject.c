@@ -31,7 +31,19 @@ class int "PyObject *" "&PyLong_Type"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_INT "Exceeds the limit (%d digits) for integer string conversion: value has %zd digits; use sys.set_int_max_str_digits() to increase the limit"
 #define _MAX_STR_DIGITS_ERROR_FMT_TO_STR "Exceeds the limit (%d digits) for integer string conversion; use sys.set_int_max_str_digits() to increase the limit"
 
-/* If defined, use algorithms from the _pylong.py module */
+/* If defined, use algorithms from the _pylong.py module.
+
+   The subquadratic int <-> decimal string conversions (and the divmod used
+   by them) are written in Python on purpose: they are divide-and-conquer
+   algorithms whose time is spent almost entirely in multiplications and
+   divisions of huge ints, so a C port would save only the interpreter
+   overhead of a few hundred recursive calls.  Above a few hundred thousand
+   digits _pylong switches to the decimal module, whose libmpdec uses
+   number-theoretic transform multiplication.  The cutoffs below (1000
+   PyLong digits for int -> str, 6000 decimal digits for str -> int) are
+   close to where the quadratic C loops and _pylong break even.
+   sys.set_int_max_str_digits() is a denial-of-service guard and applies
+   whichever algorithm is used. */
 #define WITH_PYLONG_MODULE 1
 
 // Forward declarations
@@ -83,6 +95,11 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above TOOM3_CUTOFF digits (in the smaller operand of a balanced product),
+ * k_mul switches from Karatsuba to Toom-Cook 3-way multiplication.
+ */
+#define TOOM3_CUTOFF 300
+
 /* For exponentiation, use the binary left-to-right algorithm unless the
  ^ exponent contains more than HUGE_EXP_CUTOFF bits.  In that case, do
  * (no more than) EXP_WINDOW_SIZE bits at a time.  The potential drawback is
@@ -3997,6 +4014,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *toom3_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -4055,6 +4073,9 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    if (asize > TOOM3_CUTOFF)
+        return toom3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -4276,6 +4297,260 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
 }
 
 
+/* Helpers for Toom-Cook 3-way multiplication (toom3_mul). */
+
+/* Split abs(n) into three pieces so that
+   abs(n) == (n2 << 2*size) + (n1 << size) + n0, viewing the shifts as being
+   by digits.  Returns 0 on success, -1 on failure.
+*/
+static int
+toom3_split(PyLongObject *n, Py_ssize_t size,
+            PyLongObject **n2, PyLongObject **n1, PyLongObject **n0)
+{
+    PyLongObject *hi;
+
+    if (kmul_split(n, size, &hi, n0) < 0)
+        return -1;
+    if (kmul_split(hi, size, n2, n1) < 0) {
+        Py_DECREF(hi);
+        Py_CLEAR(*n0);
+        return -1;
+    }
+    Py_DECREF(hi);
+    return 0;
+}
+
+/* Return x*y, with the sign.  x and y may be small ints. */
+static PyLongObject *
+toom3_signed_mul(PyLongObject *x, PyLongObject *y)
+{
+    PyLongObject *z = k_mul(x, y);
+    if (z != NULL && !_PyLong_SameSign(x, y)) {
+        _PyLong_Negate(&z);
+    }
+    return z;
+}
+
+/* Return n / d, where d is a single digit known to divide n exactly. */
+static PyLongObject *
+toom3_divexact(PyLongObject *n, digit d)
+{
+    Py_ssize_t size = _PyLong_DigitCount(n);
+    PyLongObject *z = long_alloc(size);
+    if (z == NULL)
+        return NULL;
+    digit rem = inplace_divrem1(z->long_value.ob_digit,
+                                n->long_value.ob_digit, size, d);
+    assert(rem == 0);
+    (void)rem;
+    if (size) {
+        _PyLong_SetSignAndDigitCount(z, _PyLong_IsNegative(n) ? -1 : 1,
+                                     size);
+    }
+    return long_normalize(z);
+}
+
+/* Return a op b, consuming the references to a and b.  Either may be NULL
+ * (an earlier step failed), in which case NULL is returned.
+ */
+static PyLongObject *
+toom3_steal(PyLongObject *(*op)(PyLongObject *, PyLongObject *),
+            PyLongObject *a, PyLongObject *b)
+{
+    PyLongObject *z = NULL;
+    if (a != NULL && b != NULL)
+        z = op(a, b);
+    Py_XDECREF(a);
+    Py_XDECREF(b);
+    return z;
+}
+
+/* Toom-Cook 3-way multiplication.  Like k_mul, ignores the input signs and
+ * returns the absolute value of the product (or NULL if error).
+ *
+ * Split both numbers into three pieces of shift digits, so that
+ * A(X) = a2*X**2 + a1*X + a0 with X = BASE**shift, and likewise B(X).  The
+ * product C(X) = A(X)*B(X) has degree 4, so can be recovered from its values
+ * at the five points 0, 1, -1, -2 and infinity, which cost five
+ * multiplications of numbers a third of the size (Karatsuba needs three of
+ * half the size).  The interpolation sequence is Bodrato's, which needs only
+ * additions, subtractions, and exact divisions by 2 and 3.  Intermediate
+ * values can be negative, but the final coefficients of C are not, so they
+ * are added into the result like in k_mul.
+ *
+ * Caller guarantees asize <= bsize < 2*asize and asize > TOOM3_CUTOFF.
+ */
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    const Py_ssize_t shift = (bsize + 2) / 3;
+    PyLongObject *a0 = NULL, *a1 = NULL, *a2 = NULL;
+    PyLongObject *b0 = NULL, *b1 = NULL, *b2 = NULL;
+    PyLongObject *am1 = NULL, *am2 = NULL, *bm1 = NULL, *bm2 = NULL;
+    PyLongObject *t = NULL;
+    PyLongObject *r0 = NULL, *r1 = NULL, *rm1 = NULL, *rm2 = NULL;
+    PyLongObject *r4 = NULL;
+    PyLongObject *c1 = NULL, *c2 = NULL, *c3 = NULL;
+    PyLongObject *ret = NULL;
+    Py_ssize_t i;
+
+    assert(asize <= bsize && bsize < 2 * asize);
+    assert(asize > TOOM3_CUTOFF);
+
+    if (toom3_split(a, shift, &a2, &a1, &a0) < 0) goto fail;
+    if (a == b) {
+        b2 = (PyLongObject*)Py_NewRef(a2);
+        b1 = (PyLongObject*)Py_NewRef(a1);
+        b0 = (PyLongObject*)Py_NewRef(a0);
+    }
+    else if (toom3_split(b, shift, &b2, &b1, &b0) < 0) goto fail;
+
+    /* r0 = A(0)*B(0), r4 = A(inf)*B(inf). */
+    if ((r0 = k_mul(a0, b0)) == NULL) goto fail;
+    if ((r4 = k_mul(a2, b2)) == NULL) goto fail;
+
+    /* A(1) = (a0 + a2) + a1, A(-1) = (a0 + a2) - a1,
+       A(-2) = 2*(A(-1) + a2) - a0; the same for B.  A(1) is
+       computed last, so am1 and am2 can be processed first. */
+    if ((t = x_add(a0, a2)) == NULL) goto fail;
+    if ((am1 = long_sub(t, a1)) == NULL) goto fail;
+    am2 = long_add(am1, a2);
+    am2 = toom3_steal(long_add, am2, (PyLongObject*)Py_XNewRef(am2));
+    am2 = toom3_steal(long_sub, am2, (PyLongObject*)Py_NewRef(a0));
+    if (am2 == NULL) goto fail;
+    Py_SETREF(t, x_add(t, a1));
+    if (t == NULL) goto fail;
+    _Py_DECREF_INT(a0);
+    _Py_DECREF_INT(a1);
+    _Py_DECREF_INT(a2);
+    a0 = a1 = a2 = NULL;
+
+    if (a == b) {
+        bm1 = (PyLongObject*)Py_NewRef(am1);
+        bm2 = (PyLongObject*)Py_NewRef(am2);
+        r1 = k_mul(t, t);
+    }
+    else {
+        PyLongObject *u;
+        if ((u = x_add(b0, b2)) == NULL) goto fail;
+        if ((bm1 = long_sub(u, b1)) == NULL) {
+            Py_DECREF(u);
+            goto fail;
+        }
+        bm2 = long_add(bm1, b2);
+        bm2 = toom3_steal(long_add, bm2, (PyLongObject*)Py_XNewRef(bm2));
+        bm2 = toom3_steal(long_sub, bm2, (PyLongObject*)Py_NewRef(b0));
+        if (bm2 == NULL) {
+            Py_DECREF(u);
+            goto fail;
+        }
+        Py_SETREF(u, x_add(u, b1));
+        if (u == NULL) goto fail;
+        r1 = k_mul(t, u);
+        Py_DECREF(u);
+    }
+    Py_CLEAR(t);
+    Py_CLEAR(b0);
+    Py_CLEAR(b1);
+    Py_CLEAR(b2);
+    if (r1 == NULL) goto fail;
+
+    if ((rm1 = toom3_signed_mul(am1, bm1)) == NULL) goto fail;
+    if ((rm2 = toom3_signed_mul(am2, bm2)) == NULL) goto fail;
+    Py_CLEAR(am1);
+    Py_CLEAR(am2);
+    Py_CLEAR(bm1);
+    Py_CLEAR(bm2);
+
+    /* Interpolate:
+         c3 = (r(-2) - r(1)) / 3
+         c1 = (r(1) - r(-1)) / 2
+         c2 = r(-1) - r(0)
+         c3 = (c2 - c3) / 2 + 2*r(inf)
+         c2 = c2 + c1 - r(inf)
+         c1 = c1 - c3
+       after which ci is the coefficient of X**i in C(X). */
+    if ((t = long_sub(rm2, r1)) == NULL) goto fail;
+    c3 = toom3_divexact(t, 3);
+    Py_CLEAR(t);
+    Py_CLEAR(rm2);
+    if (c3 == NULL) goto fail;
+    if ((t = long_sub(r1, rm1)) == NULL) goto fail;
+    c1 = toom3_divexact(t, 2);
+    Py_CLEAR(t);
+    Py_CLEAR(r1);
+    if (c1 == NULL) goto fail;
+    c2 = long_sub(rm1, r0);
+    Py_CLEAR(rm1);
+    if (c2 == NULL) goto fail;
+    if ((t = long_sub(c2, c3)) == NULL) goto fail;
+    Py_SETREF(c3, toom3_divexact(t, 2));
+    Py_CLEAR(t);
+    if (c3 == NULL) goto fail;
+    c3 = toom3_steal(long_add, c3, x_add(r4, r4));
+    if (c3 == NULL) goto fail;
+    c2 = toom3_steal(long_add, c2, (PyLongObject*)Py_NewRef(c1));
+    c2 = toom3_steal(long_sub, c2, (PyLongObject*)Py_NewRef(r4));
+    if (c2 == NULL) goto fail;
+    c1 = toom3_steal(long_sub, c1, (PyLongObject*)Py_NewRef(c3));
+    if (c1 == NULL) goto fail;
+    assert(!_PyLong_IsNegative(c1));
+    assert(!_PyLong_IsNegative(c2));
+    assert(!_PyLong_IsNegative(c3));
+
+    /* Recompose: r0 and r4 don't overlap, so copy them into a zeroed
+       result, then add in the middle coefficients.  Each ci * X**i is at
+       most the final product, so fits, and there are no carries out of
+       the top digit. */
+    ret = long_alloc(asize + bsize);
+    if (ret == NULL) goto fail;
+    memset(ret->long_value.ob_digit, 0,
+           _PyLong_DigitCount(ret) * sizeof(digit));
+    assert(_PyLong_DigitCount(r0) <= 2*shift);
+    memcpy(ret->long_value.ob_digit, r0->long_value.ob_digit,
+           _PyLong_DigitCount(r0) * sizeof(digit));
+    assert(4*shift + _PyLong_DigitCount(r4) <= _PyLong_DigitCount(ret));
+    memcpy(ret->long_value.ob_digit + 4*shift, r4->long_value.ob_digit,
+           _PyLong_DigitCount(r4) * sizeof(digit));
+    Py_CLEAR(r0);
+    Py_CLEAR(r4);
+    for (i = 1; i <= 3; i++) {
+        PyLongObject *c = i == 1 ? c1 : i == 2 ? c2 : c3;
+        assert(i*shift + _PyLong_DigitCount(c) <= _PyLong_DigitCount(ret));
+        (void)v_iadd(ret->long_value.ob_digit + i*shift,
+                     _PyLong_DigitCount(ret) - i*shift,
+                     c->long_value.ob_digit, _PyLong_DigitCount(c));
+    }
+    Py_DECREF(c1);
+    Py_DECREF(c2);
+    Py_DECREF(c3);
+    return long_normalize(ret);
+
+  fail:
+    Py_XDECREF(a0);
+    Py_XDECREF(a1);
+    Py_XDECREF(a2);
+    Py_XDECREF(b0);
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(am1);
+    Py_XDECREF(am2);
+    Py_XDECREF(bm1);
+    Py_XDECREF(bm2);
+    Py_XDECREF(t);
+    Py_XDECREF(r0);
+    Py_XDECREF(r1);
+    Py_XDECREF(rm1);
+    Py_XDECREF(rm2);
+    Py_XDECREF(r4);
+    Py_XDECREF(c1);
+    Py_XDECREF(c2);
+    Py_XDECREF(c3);
+    return NULL;
+}
+
 static PyLongObject*
 long_mul(PyLongObject *a, PyLongObject *b)
 {
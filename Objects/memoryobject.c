@@ -12,6 +12,7 @@
 
 #include "Python.h"
 #include "pycore_abstract.h"      // _PyIndex_Check()
+#include "pycore_long.h"          // _PyLong_FromUnsignedChar()
 #include "pycore_memoryobject.h"  // _PyManagedBuffer_Type
 #include "pycore_object.h"        // _PyObject_GC_UNTRACK()
 #include "pycore_strhex.h"        // _Py_strhex_with_sep()
@@ -2167,6 +2168,30 @@ adjust_fmt(const Py_buffer *view)
     return NULL;
 }
 
+/* Fill 'lst' from items of a single C type. Like unpack_single(), check
+   for a released view before each item, since creating an object may run
+   arbitrary code through the garbage collector. */
+#define TOLIST_LOOP(type, convert) \
+    do {                                                          \
+        for (i = 0; i < shape[0]; ptr+=strides[0], i++) {         \
+            type x;                                               \
+            if (BASE_INACCESSIBLE(self)) {                        \
+                PyErr_SetString(PyExc_ValueError,                 \
+                    "operation forbidden on released memoryview object"); \
+                Py_DECREF(lst);                                   \
+                return NULL;                                      \
+            }                                                     \
+            memcpy((char *)&x, ptr, sizeof x);                    \
+            item = convert(x);                                    \
+            if (item == NULL) {                                   \
+                Py_DECREF(lst);                                   \
+                return NULL;                                      \
+            }                                                     \
+            PyList_SET_ITEM(lst, i, item);                        \
+        }                                                         \
+        return lst;                                               \
+    } while (0)
+
 /* Base case for multi-dimensional unpacking. Assumption: ndim == 1. */
 static PyObject *
 tolist_base(PyMemoryViewObject *self, const char *ptr, const Py_ssize_t *shape,
@@ -2180,6 +2205,19 @@ tolist_base(PyMemoryViewObject *self, const char *ptr, const Py_ssize_t *shape,
     if (lst == NULL)
         return NULL;
 
+    if (suboffsets == NULL) {
+        /* Fast path for the most common formats: dispatch on the format
+           once instead of once per item. */
+        switch (fmt[0]) {
+        case 'B': TOLIST_LOOP(unsigned char, _PyLong_FromUnsignedChar); break;
+        case 'i': TOLIST_LOOP(int, PyLong_FromLong); break;
+        case 'l': TOLIST_LOOP(long, PyLong_FromLong); break;
+        case 'q': TOLIST_LOOP(long long, PyLong_FromLongLong); break;
+        case 'f': TOLIST_LOOP(float, PyFloat_FromDouble); break;
+        case 'd': TOLIST_LOOP(double, PyFloat_FromDouble); break;
+        }
+    }
+
     for (i = 0; i < shape[0]; ptr+=strides[0], i++) {
         const char *xptr = ADJUST_PTR(ptr, suboffsets, 0);
         item = unpack_single(self, xptr, fmt);
@@ -2193,6 +2231,8 @@ tolist_base(PyMemoryViewObject *self, const char *ptr, const Py_ssize_t *shape,
     return lst;
 }
 
+#undef TOLIST_LOOP
+
 /* Unpack a multi-dimensional array into a nested list.
    Assumption: ndim >= 1. */
 static PyObject *
@@ -3033,6 +3073,20 @@ unpack_cmp(const char *p, const char *q, char fmt,
     return MV_COMPARE_EX;
 }
 
+/* Return 1 if items of the native format 'fmt' compare equal exactly when
+   their bytes do. Floats are excluded because of NaNs and -0.0, and '?' is
+   left to unpack_cmp(). */
+static inline int
+memcmp_is_equality(char fmt)
+{
+    switch (fmt) {
+    case 'c': case 'b': case 'B': case 'h': case 'H': case 'i': case 'I':
+    case 'l': case 'L': case 'q': case 'Q': case 'n': case 'N': case 'P':
+        return 1;
+    }
+    return 0;
+}
+
 /* Base case for recursive array comparisons. Assumption: ndim == 1. */
 static int
 cmp_base(const char *p, const char *q, const Py_ssize_t *shape,
@@ -3157,7 +3211,15 @@ memory_richcompare(PyObject *v, PyObject *w, int op)
         }
     }
 
-    if (vv->ndim == 0) {
+    if (vfmt != '_' && memcmp_is_equality(vfmt) &&
+        PyBuffer_IsContiguous(vv, 'C') && PyBuffer_IsContiguous(ww, 'C'))
+    {
+        /* Integer items are equal exactly if their bytes are: compare the
+           whole buffers at once. */
+        assert(vv->len == ww->len);
+        equal = (memcmp(vv->buf, ww->buf, vv->len) == 0);
+    }
+    else if (vv->ndim == 0) {
         equal = unpack_cmp(vv->buf, ww->buf,
                            vfmt, unpack_v, unpack_w);
     }
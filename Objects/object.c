@@ -941,6 +941,7 @@ _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
     clear_freelist(&freelists->async_gens, is_finalization, free_object);
     clear_freelist(&freelists->async_gen_asends, is_finalization, free_object);
     clear_freelist(&freelists->futureiters, is_finalization, free_object);
+    clear_freelist(&freelists->decimals, is_finalization, free_object);
     if (is_finalization) {
         // Only clear object stack chunks during finalization. We use object
         // stacks during GC, so emptying the free-list is counterproductive.
@@ -951,6 +952,7 @@ _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
     clear_freelist(&freelists->pycfunctionobject, is_finalization, PyObject_GC_Del);
     clear_freelist(&freelists->pycmethodobject, is_finalization, PyObject_GC_Del);
     clear_freelist(&freelists->pymethodobjects, is_finalization, free_object);
+    clear_freelist(&freelists->cells, is_finalization, free_object);
 }
 
 /*
@@ -2731,17 +2733,14 @@ PyUnstable_Object_EnableDeferredRefcount(PyObject *op)
     }
 
     uint8_t bits = _Py_atomic_load_uint8(&op->ob_gc_bits);
-    if ((bits & _PyGC_BITS_DEFERRED) != 0)
-    {
-        // Nothing to do.
-        return 0;
-    }
-
-    if (_Py_atomic_compare_exchange_uint8(&op->ob_gc_bits, &bits, bits | _PyGC_BITS_DEFERRED) == 0)
-    {
-        // Someone beat us to it!
-        return 0;
-    }
+    do {
+        if ((bits & _PyGC_BITS_DEFERRED) != 0) {
+            // Already enabled, possibly by another thread.
+            return 1;
+        }
+        // On failure, bits is updated and the check is repeated.
+    } while (!_Py_atomic_compare_exchange_uint8(&op->ob_gc_bits, &bits,
+                                                bits | _PyGC_BITS_DEFERRED));
     _Py_atomic_add_ssize(&op->ob_ref_shared, _Py_REF_SHARED(_Py_REF_DEFERRED, 0));
     return 1;
 #else
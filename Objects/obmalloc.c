@@ -9,6 +9,7 @@
 #include "pycore_pymem.h"
 #include "pycore_pystate.h"       // _PyInterpreterState_GET
 #include "pycore_stats.h"         // OBJECT_STAT_INC_COND()
+#include "pydtrace.h"             // PyDTrace_OBMALLOC_ARENA_NEW()
 
 #include <stdlib.h>               // malloc()
 #include <stdbool.h>
@@ -451,6 +452,9 @@ _PyMem_DefaultRawWcsdup(const wchar_t *str)
 #    ifdef MAP_ANONYMOUS
 #      define ARENAS_USE_MMAP
 #    endif
+#    if defined(ARENAS_USE_MMAP) && defined(MADV_HUGEPAGE) && ARENA_BITS >= 21
+#      define ARENAS_USE_HUGEPAGES
+#    endif
 #  endif
 #endif
 
@@ -460,6 +464,27 @@ _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
 #ifdef MS_WINDOWS
     return VirtualAlloc(NULL, size,
                         MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#elif defined(ARENAS_USE_HUGEPAGES)
+    if ((size & (size - 1)) != 0) {
+        void *ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
+                         MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        return ptr == MAP_FAILED ? NULL : ptr;
+    }
+    /* Map twice the size and trim both ends, so that the arena is aligned
+     * on its size and every huge page in it is fully inside the arena. */
+    char *base = mmap(NULL, 2 * size, PROT_READ|PROT_WRITE,
+                      MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+    char *ptr = _Py_ALIGN_UP(base, size);
+    if (ptr != base) {
+        munmap(base, ptr - base);
+    }
+    munmap(ptr + size, (base + 2 * size) - (ptr + size));
+    /* Ignore errors: the arena works without huge pages. */
+    (void)madvise(ptr, size, MADV_HUGEPAGE);
+    return ptr;
 #elif defined(ARENAS_USE_MMAP)
     void *ptr;
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
@@ -1280,6 +1305,7 @@ free_delayed(uintptr_t ptr, size_t size)
     buf->array[buf->wr_idx].ptr = ptr;
     buf->array[buf->wr_idx].qsbr_goal = seq;
     buf->wr_idx++;
+    OBJECT_STAT_INC(qsbr_deferred);
 
     if (buf->wr_idx == WORK_ITEMS_PER_CHUNK) {
         // Normally the processing of delayed items is done from the eval
@@ -1986,6 +2012,9 @@ new_arena(OMState *state)
         return NULL;
     }
     arenaobj->address = (uintptr_t)address;
+    if (PyDTrace_OBMALLOC_ARENA_NEW_ENABLED()) {
+        PyDTrace_OBMALLOC_ARENA_NEW(address);
+    }
 
     ++narenas_currently_allocated;
     ++ntimes_arena_allocated;
@@ -2159,6 +2188,9 @@ allocate_from_new_pool(OMState *state, uint size)
         nfp2lasta[usable_arenas->nfreepools] = usable_arenas;
     }
     assert(usable_arenas->address != 0);
+    if (PyDTrace_OBMALLOC_POOL_NEW_ENABLED()) {
+        PyDTrace_OBMALLOC_POOL_NEW(INDEX2SIZE(size));
+    }
 
     /* This arena already had the smallest nfreepools value, so decreasing
      * nfreepools doesn't change that, and we don't need to rearrange the
@@ -2463,6 +2495,9 @@ insert_to_freepool(OMState *state, poolp pool)
 #endif
 
         /* Free the entire arena. */
+        if (PyDTrace_OBMALLOC_ARENA_FREE_ENABLED()) {
+            PyDTrace_OBMALLOC_ARENA_FREE((void *)ao->address);
+        }
         _PyObject_Arena.free(_PyObject_Arena.ctx,
                              (void *)ao->address, ARENA_SIZE);
         ao->address = 0;                        /* mark unassociated */
@@ -3449,16 +3484,8 @@ static bool _collect_alloc_stats(
 }
 
 static void
-py_mimalloc_print_stats(FILE *out)
+py_mimalloc_print_heap_stats(FILE *out, mi_heap_t *heap)
 {
-    fprintf(out, "Small block threshold = %zu, in %u size classes.\n",
-        (size_t)MI_SMALL_OBJ_SIZE_MAX, MI_BIN_HUGE);
-    fprintf(out, "Medium block threshold = %zu\n",
-            (size_t)MI_MEDIUM_OBJ_SIZE_MAX);
-    fprintf(out, "Large object max size = %zu\n",
-            (size_t)MI_LARGE_OBJ_SIZE_MAX);
-
-    mi_heap_t *heap = mi_heap_get_default();
     struct _alloc_stats stats;
     memset(&stats, 0, sizeof(stats));
     mi_heap_visit_blocks(heap, false, &_collect_alloc_stats, &stats);
@@ -3469,6 +3496,43 @@ py_mimalloc_print_stats(FILE *out)
     fprintf(out, "    Bytes Reserved: %zd\n", stats.bytes_reserved);
     fprintf(out, "    Bytes Committed: %zd\n", stats.bytes_committed);
 }
+
+static void
+py_mimalloc_print_stats(FILE *out)
+{
+    fprintf(out, "Small block threshold = %zu, in %u size classes.\n",
+        (size_t)MI_SMALL_OBJ_SIZE_MAX, MI_BIN_HUGE);
+    fprintf(out, "Medium block threshold = %zu\n",
+            (size_t)MI_MEDIUM_OBJ_SIZE_MAX);
+    fprintf(out, "Large object max size = %zu\n",
+            (size_t)MI_LARGE_OBJ_SIZE_MAX);
+
+    fprintf(out, "Purge delay = %ld ms, purge decommits = %ld\n",
+            mi_option_get(mi_option_purge_delay),
+            mi_option_get(mi_option_purge_decommits));
+
+#ifdef Py_GIL_DISABLED
+    // Python allocations go to the heaps of the current thread state, not
+    // to mimalloc's default heap.  Other threads' heaps can't be visited
+    // safely while they are running.
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (tstate != NULL) {
+        static const char *heap_names[_Py_MIMALLOC_HEAP_COUNT] = {
+            [_Py_MIMALLOC_HEAP_MEM] = "mem",
+            [_Py_MIMALLOC_HEAP_OBJECT] = "object",
+            [_Py_MIMALLOC_HEAP_GC] = "gc",
+            [_Py_MIMALLOC_HEAP_GC_PRE] = "gc_pre",
+        };
+        _PyThreadStateImpl *tstate_impl = (_PyThreadStateImpl *)tstate;
+        for (int i = 0; i < _Py_MIMALLOC_HEAP_COUNT; i++) {
+            fprintf(out, "Heap '%s' of the current thread:\n", heap_names[i]);
+            py_mimalloc_print_heap_stats(out, &tstate_impl->mimalloc.heaps[i]);
+        }
+        return;
+    }
+#endif
+    py_mimalloc_print_heap_stats(out, mi_heap_get_default());
+}
 #endif
 
 
@@ -29,6 +29,13 @@
    about membership testing where the presence of an element is not known in
    advance.  Accordingly, the set implementation needs to optimize for both
    the found and not-found case.
+
+   The set-to-set loops in intersection, difference, issubset and isdisjoint
+   walk one table and probe the other.  Each lookup only depends on the hash
+   stored in the walked table, so the CPU already overlaps the cache misses
+   of consecutive lookups.  Software prefetching the slots that later lookups
+   will start at was measured to make these loops slower, even for tables
+   far larger than the cache.
 */
 
 #include "Python.h"
@@ -1008,11 +1015,69 @@ set_update_dict_lock_held(PySetObject *so, PyObject *other)
     return 0;
 }
 
+/* Number of keys hashed ahead of insertion by
+   set_update_sequence_lock_held().  Computing a batch of hashes first keeps
+   the hash functions' loops free of table probes, so the probes for the
+   batch that follows can overlap instead of each stalling on a cache miss
+   behind the next hash computation. */
+#define SET_UPDATE_BATCH 16
+
+/* Add the items of an exact list or tuple to the set, hashing them in
+   batches.  A strong reference to every key in the batch is held while
+   it is hashed and inserted, since __hash__ and __eq__ may mutate a list.
+   The size of a list is re-read for every batch for the same reason. */
+static int
+set_update_sequence_lock_held(PySetObject *so, PyObject *seq)
+{
+    PyObject *keys[SET_UPDATE_BATCH];
+    Py_hash_t hashes[SET_UPDATE_BATCH];
+    Py_ssize_t i = 0;
+
+    while (i < PySequence_Fast_GET_SIZE(seq)) {
+        Py_ssize_t n = Py_MIN(SET_UPDATE_BATCH,
+                              PySequence_Fast_GET_SIZE(seq) - i);
+        PyObject **items = PySequence_Fast_ITEMS(seq) + i;
+        for (Py_ssize_t j = 0; j < n; j++) {
+            keys[j] = Py_NewRef(items[j]);
+        }
+
+        int status = 0;
+        for (Py_ssize_t j = 0; j < n; j++) {
+            hashes[j] = _PyObject_HashFast(keys[j]);
+            if (hashes[j] == -1) {
+                set_unhashable_type(keys[j]);
+                status = -1;
+                break;
+            }
+        }
+        for (Py_ssize_t j = 0; j < n; j++) {
+            if (status == 0) {
+                status = set_add_entry(so, keys[j], hashes[j]);
+            }
+            Py_DECREF(keys[j]);
+        }
+        if (status < 0) {
+            return -1;
+        }
+        i += n;
+    }
+    return 0;
+}
+
 static int
 set_update_iterable_lock_held(PySetObject *so, PyObject *other)
 {
     _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(so);
 
+    if (PyTuple_CheckExact(other)
+#ifndef Py_GIL_DISABLED
+        /* In the free-threaded build the list is not locked here. */
+        || PyList_CheckExact(other)
+#endif
+        ) {
+        return set_update_sequence_lock_held(so, other);
+    }
+
     PyObject *it = PyObject_GetIter(other);
     if (it == NULL) {
         return -1;
@@ -36,57 +36,58 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                input will consist of an overwhelming majority of ASCII
                characters, we try to optimize for this case by checking
                as many characters as a C 'size_t' can contain.
-               First, check if we can do an aligned read, as most CPUs have
-               a penalty for unaligned reads.
+               The read is done with memcpy() rather than only at aligned
+               addresses: in mixed text each non-ASCII sequence leaves 's'
+               misaligned, and copying the following ASCII run byte by byte
+               up to the next boundary costs more than an unaligned load.
             */
-            if (_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
-                /* Help register allocation */
-                const char *_s = s;
-                STRINGLIB_CHAR *_p = p;
-                while (_s + SIZEOF_SIZE_T <= end) {
-                    /* Read a whole size_t at a time (either 4 or 8 bytes),
-                       and do a fast unrolled copy if it only contains ASCII
-                       characters. */
-                    size_t value = *(const size_t *) _s;
-                    if (value & ASCII_CHAR_MASK)
-                        break;
+            /* Help register allocation */
+            const char *_s = s;
+            STRINGLIB_CHAR *_p = p;
+            while (_s + SIZEOF_SIZE_T <= end) {
+                /* Read a whole size_t at a time (either 4 or 8 bytes),
+                   and do a fast unrolled copy if it only contains ASCII
+                   characters. */
+                size_t value;
+                memcpy(&value, _s, SIZEOF_SIZE_T);
+                if (value & ASCII_CHAR_MASK)
+                    break;
 #if PY_LITTLE_ENDIAN
-                    _p[0] = (STRINGLIB_CHAR)(value & 0xFFu);
-                    _p[1] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
-                    _p[2] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
-                    _p[3] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
+                _p[0] = (STRINGLIB_CHAR)(value & 0xFFu);
+                _p[1] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
+                _p[2] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
+                _p[3] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
 # if SIZEOF_SIZE_T == 8
-                    _p[4] = (STRINGLIB_CHAR)((value >> 32) & 0xFFu);
-                    _p[5] = (STRINGLIB_CHAR)((value >> 40) & 0xFFu);
-                    _p[6] = (STRINGLIB_CHAR)((value >> 48) & 0xFFu);
-                    _p[7] = (STRINGLIB_CHAR)((value >> 56) & 0xFFu);
+                _p[4] = (STRINGLIB_CHAR)((value >> 32) & 0xFFu);
+                _p[5] = (STRINGLIB_CHAR)((value >> 40) & 0xFFu);
+                _p[6] = (STRINGLIB_CHAR)((value >> 48) & 0xFFu);
+                _p[7] = (STRINGLIB_CHAR)((value >> 56) & 0xFFu);
 # endif
 #else
 # if SIZEOF_SIZE_T == 8
-                    _p[0] = (STRINGLIB_CHAR)((value >> 56) & 0xFFu);
-                    _p[1] = (STRINGLIB_CHAR)((value >> 48) & 0xFFu);
-                    _p[2] = (STRINGLIB_CHAR)((value >> 40) & 0xFFu);
-                    _p[3] = (STRINGLIB_CHAR)((value >> 32) & 0xFFu);
-                    _p[4] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
-                    _p[5] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
-                    _p[6] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
-                    _p[7] = (STRINGLIB_CHAR)(value & 0xFFu);
+                _p[0] = (STRINGLIB_CHAR)((value >> 56) & 0xFFu);
+                _p[1] = (STRINGLIB_CHAR)((value >> 48) & 0xFFu);
+                _p[2] = (STRINGLIB_CHAR)((value >> 40) & 0xFFu);
+                _p[3] = (STRINGLIB_CHAR)((value >> 32) & 0xFFu);
+                _p[4] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
+                _p[5] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
+                _p[6] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
+                _p[7] = (STRINGLIB_CHAR)(value & 0xFFu);
 # else
-                    _p[0] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
-                    _p[1] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
-                    _p[2] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
-                    _p[3] = (STRINGLIB_CHAR)(value & 0xFFu);
+                _p[0] = (STRINGLIB_CHAR)((value >> 24) & 0xFFu);
+                _p[1] = (STRINGLIB_CHAR)((value >> 16) & 0xFFu);
+                _p[2] = (STRINGLIB_CHAR)((value >> 8) & 0xFFu);
+                _p[3] = (STRINGLIB_CHAR)(value & 0xFFu);
 # endif
 #endif
-                    _s += SIZEOF_SIZE_T;
-                    _p += SIZEOF_SIZE_T;
-                }
-                s = _s;
-                p = _p;
-                if (s == end)
-                    break;
-                ch = (unsigned char)*s;
+                _s += SIZEOF_SIZE_T;
+                _p += SIZEOF_SIZE_T;
             }
+            s = _s;
+            p = _p;
+            if (s == end)
+                break;
+            ch = (unsigned char)*s;
             if (ch < 0x80) {
                 s++;
                 *p++ = ch;
@@ -613,6 +613,57 @@ STRINGLIB(default_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
 }
 
 
+static Py_ssize_t
+STRINGLIB(memchr_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                       const STRINGLIB_CHAR* p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode)
+{
+    /* For short needles, default_find() can skip at most m characters at a
+       time.  Instead, let find_char() (memchr() or wmemchr() for most
+       kinds) jump to the next occurrence of the needle's last character,
+       and compare the rest of the needle there.  If that character turns
+       out to be common in the haystack, the per-call overhead dominates,
+       so hand the rest of the search over to default_find(). */
+    const Py_ssize_t w = n - m;
+    Py_ssize_t mlast = m - 1, count = 0;
+    Py_ssize_t misses = 0, res;
+    const STRINGLIB_CHAR last = p[mlast];
+    const STRINGLIB_CHAR *const ss = &s[mlast];
+
+    for (Py_ssize_t i = 0; i <= w; i++) {
+        res = STRINGLIB(find_char)(ss + i, w - i + 1, last);
+        if (res < 0) {
+            break;
+        }
+        i += res;
+        if (memcmp(s + i, p, mlast * sizeof(STRINGLIB_CHAR)) == 0) {
+            /* got a match! */
+            if (mode != FAST_COUNT) {
+                return i;
+            }
+            count++;
+            if (count == maxcount) {
+                return maxcount;
+            }
+            i = i + mlast;
+            continue;
+        }
+        /* false positive: give up once they are more than 1 in 16 */
+        misses++;
+        if (misses > 4 + (i >> 4)) {
+            i++;
+            res = STRINGLIB(default_find)(s + i, n - i, p, m,
+                                          maxcount - count, mode);
+            if (mode == FAST_SEARCH) {
+                return res == -1 ? -1 : res + i;
+            }
+            return res + count;
+        }
+    }
+    return mode == FAST_COUNT ? count : -1;
+}
+
+
 static Py_ssize_t
 STRINGLIB(adaptive_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
                          const STRINGLIB_CHAR* p, Py_ssize_t m,
@@ -797,6 +848,9 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 
     if (mode != FAST_RSEARCH) {
+        if (m < 6 && n > 100) {
+            return STRINGLIB(memchr_find)(s, n, p, m, maxcount, mode);
+        }
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
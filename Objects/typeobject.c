@@ -6,6 +6,8 @@
 #include "pycore_code.h"          // CO_FAST_FREE
 #include "pycore_dict.h"          // _PyDict_KeysSize()
 #include "pycore_function.h"      // _PyFunction_GetVersionForCurrentState()
+#include "pycore_initconfig.h"    // _PyStatus_OK()
+#include "pycore_interp.h"        // _PyInterpreterState_GetConfig()
 #include "pycore_interpframe.h"   // _PyInterpreterFrame
 #include "pycore_lock.h"          // _PySeqLock_*
 #include "pycore_long.h"          // _PyLong_IsNegative(), _PyLong_GetOne()
@@ -43,13 +45,21 @@ class object "PyObject *" "&PyBaseObject_Type"
    MCACHE_MAX_ATTR_SIZE, since it might be a problem if very large
    strings are used as attribute names. */
 #define MCACHE_MAX_ATTR_SIZE    100
-#define MCACHE_HASH(version, name_hash)                                 \
-        (((unsigned int)(version) ^ (unsigned int)(name_hash))          \
-         & ((1 << MCACHE_SIZE_EXP) - 1))
-
-#define MCACHE_HASH_METHOD(type, name)                                  \
+/* Return the index of the set of the cache entries.  Version tags are
+   allocated sequentially, so they are used as is: the types of a program
+   spread over consecutive sets.  Names of related attributes are often
+   allocated at a regular stride, which cancels out with the version stride
+   if the two are simply xored, so the name is scrambled by a Fibonacci
+   hash first. */
+#define MCACHE_HASH(version, name_hash, mask)                           \
+        (((unsigned int)(version)                                       \
+          + (unsigned int)(((uint64_t)(name_hash)                       \
+                            * UINT64_C(0x9E3779B97F4A7C15)) >> 32))     \
+         & (mask))
+
+#define MCACHE_HASH_METHOD(cache, type, name)                           \
     MCACHE_HASH(FT_ATOMIC_LOAD_UINT_RELAXED((type)->tp_version_tag),   \
-                ((Py_ssize_t)(name)) >> 3)
+                ((uintptr_t)(name)) >> 3, (cache)->mask)
 #define MCACHE_CACHEABLE_NAME(name)                             \
         PyUnicode_CheckExact(name) &&                           \
         (PyUnicode_GET_LENGTH(name) <= MCACHE_MAX_ATTR_SIZE)
@@ -973,10 +983,17 @@ get_type_cache(void)
 }
 
 
+static inline Py_ssize_t
+type_cache_size(struct type_cache *cache)
+{
+    return ((Py_ssize_t)cache->mask + 1) * MCACHE_WAYS;
+}
+
+
 static void
 type_cache_clear(struct type_cache *cache, PyObject *value)
 {
-    for (Py_ssize_t i = 0; i < (1 << MCACHE_SIZE_EXP); i++) {
+    for (Py_ssize_t i = 0; i < type_cache_size(cache); i++) {
         struct type_cache_entry *entry = &cache->hashtable[i];
 #ifdef Py_GIL_DISABLED
         _PySeqLock_LockWrite(&entry->sequence);
@@ -991,11 +1008,22 @@ type_cache_clear(struct type_cache *cache, PyObject *value)
 }
 
 
-void
-_PyType_InitCache(PyInterpreterState *interp)
+static void
+type_cache_set_hashtable(struct type_cache *cache,
+                         struct type_cache_entry *hashtable, Py_ssize_t size)
 {
-    struct type_cache *cache = &interp->types.type_cache;
-    for (Py_ssize_t i = 0; i < (1 << MCACHE_SIZE_EXP); i++) {
+    assert(size >= MCACHE_WAYS && (size & (size - 1)) == 0);
+    cache->hashtable = hashtable;
+    cache->mask = (unsigned int)(size / MCACHE_WAYS - 1);
+}
+
+
+static void
+type_cache_init(struct type_cache *cache, struct type_cache_entry *hashtable,
+                Py_ssize_t size)
+{
+    type_cache_set_hashtable(cache, hashtable, size);
+    for (Py_ssize_t i = 0; i < size; i++) {
         struct type_cache_entry *entry = &cache->hashtable[i];
         assert(entry->name == NULL);
 
@@ -1008,6 +1036,36 @@ _PyType_InitCache(PyInterpreterState *interp)
 }
 
 
+void
+_PyType_InitCache(PyInterpreterState *interp)
+{
+    struct type_cache *cache = &interp->types.type_cache;
+    type_cache_init(cache, cache->initial, Py_ARRAY_LENGTH(cache->initial));
+}
+
+
+/* Called once the configuration is known: the cache was created with the
+   default size by _PyType_InitCache(). */
+PyStatus
+_PyType_InitCacheSize(PyInterpreterState *interp)
+{
+    struct type_cache *cache = &interp->types.type_cache;
+    Py_ssize_t size = _PyInterpreterState_GetConfig(interp)->type_cache_size;
+    if (size == type_cache_size(cache)) {
+        return _PyStatus_OK();
+    }
+    assert(cache->hashtable == cache->initial);
+    struct type_cache_entry *hashtable;
+    hashtable = PyMem_RawCalloc(size, sizeof(struct type_cache_entry));
+    if (hashtable == NULL) {
+        return _PyStatus_NO_MEMORY();
+    }
+    type_cache_clear(cache, NULL);
+    type_cache_init(cache, hashtable, size);
+    return _PyStatus_OK();
+}
+
+
 static unsigned int
 _PyType_ClearCache(PyInterpreterState *interp)
 {
@@ -1033,6 +1091,11 @@ _PyTypes_Fini(PyInterpreterState *interp)
 {
     struct type_cache *cache = &interp->types.type_cache;
     type_cache_clear(cache, NULL);
+    if (cache->hashtable != cache->initial) {
+        PyMem_RawFree(cache->hashtable);
+        type_cache_set_hashtable(cache, cache->initial,
+                                 Py_ARRAY_LENGTH(cache->initial));
+    }
 
     // All the managed static types should have been finalized already.
     assert(interp->types.for_extensions.num_initialized == 0);
@@ -1232,6 +1295,8 @@ type_modified_unlocked(PyTypeObject *type)
         // comment on struct _specialization_cache):
         FT_ATOMIC_STORE_PTR_RELAXED(
             ((PyHeapTypeObject *)type)->_spec_cache.getitem, NULL);
+        FT_ATOMIC_STORE_PTR_RELAXED(
+            ((PyHeapTypeObject *)type)->_spec_cache.setitem, NULL);
     }
 }
 
@@ -1316,6 +1381,8 @@ type_mro_modified(PyTypeObject *type, PyObject *bases)
         // comment on struct _specialization_cache):
         FT_ATOMIC_STORE_PTR_RELAXED(
             ((PyHeapTypeObject *)type)->_spec_cache.getitem, NULL);
+        FT_ATOMIC_STORE_PTR_RELAXED(
+            ((PyHeapTypeObject *)type)->_spec_cache.setitem, NULL);
     }
 }
 
@@ -5963,7 +6030,6 @@ update_cache(struct type_cache_entry *entry, PyObject *name, unsigned int versio
 {
     _Py_atomic_store_ptr_relaxed(&entry->value, value); /* borrowed */
     assert(_PyASCIIObject_CAST(name)->hash != -1);
-    OBJECT_STAT_INC_COND(type_cache_collisions, entry->name != Py_None && entry->name != name);
     // We're releasing this under the lock for simplicity sake because it's always a
     // exact unicode object or Py_None so it's safe to do so.
     PyObject *old_name = entry->name;
@@ -5977,39 +6043,59 @@ update_cache(struct type_cache_entry *entry, PyObject *name, unsigned int versio
     return old_name;
 }
 
-#if Py_GIL_DISABLED
-
+/* Insert a new pair in the first way of a set.  The previous first entry
+   moves to the second way and the previous second entry is evicted. */
 static void
-update_cache_gil_disabled(struct type_cache_entry *entry, PyObject *name,
-                          unsigned int version_tag, PyObject *value)
+insert_cache(struct type_cache_entry *set, PyObject *name,
+             unsigned int version_tag, PyObject *value)
 {
-    _PySeqLock_LockWrite(&entry->sequence);
+    static_assert(MCACHE_WAYS == 2, "insert_cache() handles two ways");
+    struct type_cache_entry *first = &set[0];
+    struct type_cache_entry *second = &set[1];
+    PyObject *old_second = NULL;
 
-    // update the entry
-    if (entry->name == name &&
-        entry->value == value &&
-        entry->version == version_tag) {
+#ifdef Py_GIL_DISABLED
+    _PySeqLock_LockWrite(&first->sequence);
+    if (first->name == name &&
+        first->value == value &&
+        first->version == version_tag) {
         // We raced with another update, bail and restore previous sequence.
-        _PySeqLock_AbandonWrite(&entry->sequence);
+        _PySeqLock_AbandonWrite(&first->sequence);
         return;
     }
+#endif
+    if (first->version != 0) {
+        // Readers looking for the demoted pair may miss it while the second
+        // entry is locked.  They then take the slow path.
+#ifdef Py_GIL_DISABLED
+        _PySeqLock_LockWrite(&second->sequence);
+#endif
+        int evict = (second->version != 0);
+        OBJECT_STAT_INC_COND(type_cache_collisions, evict);
+        if (evict) {
+            LITE_STAT_INC(type_cache_evictions);
+        }
+        old_second = update_cache(second, first->name, first->version,
+                                  first->value);
+#ifdef Py_GIL_DISABLED
+        _PySeqLock_UnlockWrite(&second->sequence);
+#endif
+    }
+    PyObject *old_first = update_cache(first, name, version_tag, value);
+#ifdef Py_GIL_DISABLED
+    _PySeqLock_UnlockWrite(&first->sequence);
+#endif
 
-    PyObject *old_value = update_cache(entry, name, version_tag, value);
-
-    // Then update sequence to the next valid value
-    _PySeqLock_UnlockWrite(&entry->sequence);
-
-    Py_DECREF(old_value);
+    Py_XDECREF(old_second);
+    Py_DECREF(old_first);
 }
 
-#endif
-
 void
 _PyTypes_AfterFork(void)
 {
 #ifdef Py_GIL_DISABLED
     struct type_cache *cache = get_type_cache();
-    for (Py_ssize_t i = 0; i < (1 << MCACHE_SIZE_EXP); i++) {
+    for (Py_ssize_t i = 0; i < type_cache_size(cache); i++) {
         struct type_cache_entry *entry = &cache->hashtable[i];
         if (_PySeqLock_AfterFork(&entry->sequence)) {
             // Entry was in the process of updating while forking, clear it...
@@ -6043,47 +6129,54 @@ _PyType_LookupRefAndVersion(PyTypeObject *type, PyObject *name, unsigned int *ve
 unsigned int
 _PyType_LookupStackRefAndVersion(PyTypeObject *type, PyObject *name, _PyStackRef *out)
 {
-    unsigned int h = MCACHE_HASH_METHOD(type, name);
     struct type_cache *cache = get_type_cache();
-    struct type_cache_entry *entry = &cache->hashtable[h];
+    unsigned int h = MCACHE_HASH_METHOD(cache, type, name);
+    struct type_cache_entry *set = &cache->hashtable[h * MCACHE_WAYS];
+    for (int way = 0; way < MCACHE_WAYS; way++) {
+        struct type_cache_entry *entry = &set[way];
 #ifdef Py_GIL_DISABLED
-    // synchronize-with other writing threads by doing an acquire load on the sequence
-    while (1) {
-        uint32_t sequence = _PySeqLock_BeginRead(&entry->sequence);
-        uint32_t entry_version = _Py_atomic_load_uint32_acquire(&entry->version);
-        uint32_t type_version = _Py_atomic_load_uint32_acquire(&type->tp_version_tag);
-        if (entry_version == type_version &&
-            _Py_atomic_load_ptr_relaxed(&entry->name) == name) {
-            OBJECT_STAT_INC_COND(type_cache_hits, !is_dunder_name(name));
-            OBJECT_STAT_INC_COND(type_cache_dunder_hits, is_dunder_name(name));
-            if (_Py_TryXGetStackRef(&entry->value, out)) {
-                // If the sequence is still valid then we're done
-                if (_PySeqLock_EndRead(&entry->sequence, sequence)) {
-                    return entry_version;
+        // synchronize-with other writing threads by doing an acquire load on the sequence
+        while (1) {
+            uint32_t sequence = _PySeqLock_BeginRead(&entry->sequence);
+            uint32_t entry_version = _Py_atomic_load_uint32_acquire(&entry->version);
+            uint32_t type_version = _Py_atomic_load_uint32_acquire(&type->tp_version_tag);
+            if (entry_version == type_version &&
+                _Py_atomic_load_ptr_relaxed(&entry->name) == name) {
+                if (_Py_TryXGetStackRef(&entry->value, out)) {
+                    // If the sequence is still valid then we're done
+                    if (_PySeqLock_EndRead(&entry->sequence, sequence)) {
+                        OBJECT_STAT_INC_COND(type_cache_hits, !is_dunder_name(name));
+                        OBJECT_STAT_INC_COND(type_cache_dunder_hits, is_dunder_name(name));
+                        return entry_version;
+                    }
+                    PyStackRef_XCLOSE(*out);
+                }
+                else {
+                    // If we can't incref the object we need to fallback to locking
+                    goto miss;
                 }
-                PyStackRef_XCLOSE(*out);
             }
             else {
-                // If we can't incref the object we need to fallback to locking
+                // not in this way
                 break;
             }
         }
-        else {
-            // cache miss
-            break;
-        }
-    }
 #else
-    if (entry->version == type->tp_version_tag && entry->name == name) {
-        assert(type->tp_version_tag);
-        OBJECT_STAT_INC_COND(type_cache_hits, !is_dunder_name(name));
-        OBJECT_STAT_INC_COND(type_cache_dunder_hits, is_dunder_name(name));
-        *out = entry->value ? PyStackRef_FromPyObjectNew(entry->value) : PyStackRef_NULL;
-        return entry->version;
+        if (entry->version == type->tp_version_tag && entry->name == name) {
+            assert(type->tp_version_tag);
+            OBJECT_STAT_INC_COND(type_cache_hits, !is_dunder_name(name));
+            OBJECT_STAT_INC_COND(type_cache_dunder_hits, is_dunder_name(name));
+            *out = entry->value ? PyStackRef_FromPyObjectNew(entry->value) : PyStackRef_NULL;
+            return entry->version;
+        }
+#endif
     }
+#ifdef Py_GIL_DISABLED
+miss:
 #endif
     OBJECT_STAT_INC_COND(type_cache_misses, !is_dunder_name(name));
     OBJECT_STAT_INC_COND(type_cache_dunder_misses, is_dunder_name(name));
+    LITE_STAT_INC(type_cache_misses);
 
     /* We may end up clearing live exceptions below, so make sure it's ours. */
     assert(!PyErr_Occurred());
@@ -6125,12 +6218,7 @@ _PyType_LookupStackRefAndVersion(PyTypeObject *type, PyObject *name, _PyStackRef
     }
 
     if (has_version) {
-#if Py_GIL_DISABLED
-        update_cache_gil_disabled(entry, name, assigned_version, res);
-#else
-        PyObject *old_value = update_cache(entry, name, assigned_version, res);
-        Py_DECREF(old_value);
-#endif
+        insert_cache(set, name, assigned_version, res);
     }
     *out = res ? PyStackRef_FromPyObjectSteal(res) : PyStackRef_NULL;
     return has_version ? assigned_version : 0;
@@ -6200,6 +6288,27 @@ _PyType_CacheGetItemForSpecialization(PyHeapTypeObject *ht, PyObject *descriptor
     return can_cache;
 }
 
+int
+_PyType_CacheSetItemForSpecialization(PyHeapTypeObject *ht, PyObject *descriptor, uint32_t tp_version)
+{
+    if (!descriptor || !tp_version) {
+        return 0;
+    }
+    int can_cache;
+    BEGIN_TYPE_LOCK();
+    can_cache = ((PyTypeObject*)ht)->tp_version_tag == tp_version;
+#ifdef Py_GIL_DISABLED
+    can_cache = can_cache && _PyObject_HasDeferredRefcount(descriptor);
+#endif
+    if (can_cache) {
+        // This pointer is invalidated by PyType_Modified (see the comment on
+        // struct _specialization_cache):
+        FT_ATOMIC_STORE_PTR_RELEASE(ht->_spec_cache.setitem, descriptor);
+    }
+    END_TYPE_LOCK();
+    return can_cache;
+}
+
 void
 _PyType_SetFlags(PyTypeObject *self, unsigned long mask, unsigned long flags)
 {
@@ -16000,6 +16000,28 @@ intern_common(PyInterpreterState *interp, PyObject *s /* stolen */,
     PyObject *interned = get_interned_dict(interp);
     assert(interned != NULL);
 
+#ifdef Py_GIL_DISABLED
+    /* Interned strings are immortal here, so an already interned string can
+       be returned after a lock-free dict lookup.  An entry whose state is
+       not yet SSTATE_INTERNED_IMMORTAL is still being added by another
+       thread; take the lock and wait for it. */
+    {
+        PyObject *r;
+        int res = PyDict_GetItemRef(interned, s, &r);
+        if (res < 0) {
+            PyErr_Clear();
+            return s;
+        }
+        if (res == 1) {
+            if (PyUnicode_CHECK_INTERNED(r) == SSTATE_INTERNED_IMMORTAL) {
+                Py_DECREF(s);
+                return r;
+            }
+            Py_DECREF(r);
+        }
+    }
+#endif
+
     LOCK_INTERNED(interp);
     PyObject *t;
     {
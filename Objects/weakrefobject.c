@@ -474,6 +474,12 @@ weakref___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     PyObject *tmp;
 
+    /* As with object.__init__(), a subclass that overrides __new__() but
+       not __init__() may take extra arguments (see weakref.KeyedRef). */
+    if (Py_TYPE(self)->tp_new != weakref___new__) {
+        return 0;
+    }
+
     if (!_PyArg_NoKeywords("ref", kwargs))
         return -1;
 
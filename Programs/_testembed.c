@@ -733,6 +733,7 @@ static int test_init_from_config(void)
     putenv("PYTHONINTMAXSTRDIGITS=6666");
     config.int_max_str_digits = 31337;
     config.cpu_count = 4321;
+    config.type_cache_size = 1 << 14;
 
     init_from_config_clear(&config);
 
@@ -1927,6 +1928,48 @@ static int test_initconfig_exit(void)
 }
 
 
+static int test_init_invalid_type_cache_size(void)
+{
+    int sizes[] = {0, 3, 1000, 128, 1 << 25};
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(sizes); i++) {
+        // Set by PyConfig
+        PyConfig config;
+        PyConfig_InitIsolatedConfig(&config);
+        config.type_cache_size = sizes[i];
+        PyStatus status = Py_InitializeFromConfig(&config);
+        PyConfig_Clear(&config);
+        if (!PyStatus_IsError(status)
+            || strstr(status.err_msg, "type_cache_size") == NULL)
+        {
+            printf("PyConfig: type_cache_size=%d accepted\n", sizes[i]);
+            return 1;
+        }
+
+        // Set by PyInitConfig
+        PyInitConfig *initconfig = PyInitConfig_Create();
+        if (initconfig == NULL) {
+            printf("Init allocation error\n");
+            return 1;
+        }
+        if (PyInitConfig_SetInt(initconfig, "type_cache_size", sizes[i]) < 0
+            || Py_InitializeFromInitConfig(initconfig) == 0)
+        {
+            printf("PyInitConfig: type_cache_size=%d accepted\n", sizes[i]);
+            return 1;
+        }
+        const char *err_msg;
+        (void)PyInitConfig_GetError(initconfig, &err_msg);
+        if (strstr(err_msg, "type_cache_size") == NULL) {
+            printf("PyInitConfig: unexpected error: %s\n", err_msg);
+            return 1;
+        }
+        PyInitConfig_Free(initconfig);
+    }
+    printf("ok\n");
+    return 0;
+}
+
+
 static PyModuleDef_Slot extension_slots[] = {
     {Py_mod_gil, Py_MOD_GIL_NOT_USED},
     {0, NULL}
@@ -2404,6 +2447,7 @@ static struct TestCase TestCases[] = {
     {"test_initconfig_api", test_initconfig_api},
     {"test_initconfig_get_api", test_initconfig_get_api},
     {"test_initconfig_exit", test_initconfig_exit},
+    {"test_init_invalid_type_cache_size", test_init_invalid_type_cache_size},
     {"test_initconfig_module", test_initconfig_module},
     {"test_run_main", test_run_main},
     {"test_run_main_loop", test_run_main_loop},
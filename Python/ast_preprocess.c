@@ -593,6 +593,10 @@ astfold_expr(expr_ty node_, PyArena *ctx_, _PyASTPreprocessState *state)
         if (state->syntax_check_only) {
             break;
         }
+        /* __debug__ is the only name with a value known at compile time:
+           it cannot be assigned to.  Other names, including builtins such
+           as len and module constants such as typing.TYPE_CHECKING, can
+           be rebound at run time and are not folded. */
         if (node_->v.Name.ctx == Load &&
                 _PyUnicode_EqualToASCIIString(node_->v.Name.id, "__debug__")) {
             LEAVE_RECURSIVE();
@@ -22,6 +22,7 @@
 #include "pycore_ceval.h"       // _Py_set_eval_breaker_bit
 #include "pycore_llist.h"       // struct llist_node
 #include "pycore_pystate.h"     // _PyThreadStateImpl
+#include "pycore_stats.h"       // OBJECT_STAT_INC()
 
 #ifdef Py_GIL_DISABLED
 
@@ -93,6 +94,8 @@ _Py_brc_queue_object(PyObject *ob)
         return;
     }
 
+    OBJECT_STAT_INC(brc_queued);
+
     // Notify owning thread
     _Py_set_eval_breaker_bit(&tstate->base, _PY_EVAL_EXPLICIT_MERGE_BIT);
 
@@ -877,19 +877,10 @@ dummy_func(
         }
 
         op(_BINARY_SLICE, (container, start, stop -- res)) {
-            PyObject *slice = _PyBuildSlice_ConsumeRefs(PyStackRef_AsPyObjectSteal(start),
-                                                        PyStackRef_AsPyObjectSteal(stop));
-            PyObject *res_o;
-            // Can't use ERROR_IF() here, because we haven't
-            // DECREF'ed container yet, and we still own slice.
-            if (slice == NULL) {
-                res_o = NULL;
-            }
-            else {
-                res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
-                Py_DECREF(slice);
-            }
-            PyStackRef_CLOSE(container);
+            PyObject *res_o = _PyEval_BinarySlice(PyStackRef_AsPyObjectBorrow(container),
+                                                  PyStackRef_AsPyObjectBorrow(start),
+                                                  PyStackRef_AsPyObjectBorrow(stop));
+            DECREF_INPUTS();
             ERROR_IF(res_o == NULL);
             res = PyStackRef_FromPyObjectSteal(res_o);
         }
@@ -1097,6 +1088,7 @@ dummy_func(
         family(STORE_SUBSCR, INLINE_CACHE_ENTRIES_STORE_SUBSCR) = {
             STORE_SUBSCR_DICT,
             STORE_SUBSCR_LIST_INT,
+            STORE_SUBSCR_PY_SETITEM,
         };
 
         specializing op(_SPECIALIZE_STORE_SUBSCR, (counter/1, container, sub -- container, sub)) {
@@ -1167,6 +1159,33 @@ dummy_func(
             ERROR_IF(err);
         }
 
+        op(_STORE_SUBSCR_PY_SETITEM, (value, container, sub -- )) {
+            PyObject *container_o = PyStackRef_AsPyObjectBorrow(container);
+            PyTypeObject *tp = Py_TYPE(container_o);
+            DEOPT_IF(!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE));
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *setitem_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.setitem);
+            DEOPT_IF(setitem_o == NULL);
+            assert(PyFunction_Check(setitem_o));
+            STAT_INC(STORE_SUBSCR, hit);
+            /* Call the cached __setitem__ directly, skipping the type
+             * attribute lookup done by slot_mp_ass_subscript(). */
+            Py_INCREF(setitem_o);
+            PyObject *args[3] = {
+                container_o,
+                PyStackRef_AsPyObjectBorrow(sub),
+                PyStackRef_AsPyObjectBorrow(value),
+            };
+            PyObject *res_o = _PyFunction_Vectorcall(setitem_o, args, 3, NULL);
+            Py_DECREF(setitem_o);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL);
+            Py_DECREF(res_o);
+        }
+
+        macro(STORE_SUBSCR_PY_SETITEM) =
+            unused/1 + _STORE_SUBSCR_PY_SETITEM;
+
         inst(DELETE_SUBSCR, (container, sub --)) {
             /* del container[sub] */
             int err = PyObject_DelItem(PyStackRef_AsPyObjectBorrow(container),
@@ -2300,6 +2319,7 @@ dummy_func(
 
         family(LOAD_ATTR, INLINE_CACHE_ENTRIES_LOAD_ATTR) = {
             LOAD_ATTR_INSTANCE_VALUE,
+            LOAD_ATTR_INSTANCE_VALUE_POLY,
             LOAD_ATTR_MODULE,
             LOAD_ATTR_WITH_HINT,
             LOAD_ATTR_SLOT,
@@ -2417,6 +2437,47 @@ dummy_func(
             unused/5 +
             _PUSH_NULL_CONDITIONAL;
 
+        /* Two-entry polymorphic form of LOAD_ATTR_INSTANCE_VALUE.
+         * The type version is read only once, so that a concurrent type
+         * modification can never pair one type's instance with the other
+         * type's offset. Each uop can only carry two operands, so this is
+         * tier 1 only: the trace projector treats it as a plain LOAD_ATTR. */
+        tier1 op(_LOAD_ATTR_INSTANCE_VALUE_POLY, (type_version/2, type_version2/2, offsets/2, owner -- attr)) {
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            uint16_t offset;
+            if (tp_version == type_version) {
+                offset = (uint16_t)offsets;
+            }
+            else {
+                DEOPT_IF(tp_version != type_version2);
+                offset = (uint16_t)(offsets >> 16);
+            }
+            assert(tp->tp_dictoffset < 0);
+            assert(tp->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            DEOPT_IF(!FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid));
+            PyObject **value_ptr = (PyObject**)(((char *)owner_o) + offset);
+            PyObject *attr_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(*value_ptr);
+            DEOPT_IF(attr_o == NULL);
+            #ifdef Py_GIL_DISABLED
+            int increfed = _Py_TryIncrefCompareStackRef(value_ptr, attr_o, &attr);
+            if (!increfed) {
+                DEOPT_IF(true);
+            }
+            #else
+            attr = PyStackRef_FromPyObjectNew(attr_o);
+            #endif
+            STAT_INC(LOAD_ATTR, hit);
+            PyStackRef_CLOSE(owner);
+        }
+
+        macro(LOAD_ATTR_INSTANCE_VALUE_POLY) =
+            unused/1 + // Skip over the counter
+            _LOAD_ATTR_INSTANCE_VALUE_POLY +
+            unused/2 +
+            _PUSH_NULL_CONDITIONAL;
+
         op(_LOAD_ATTR_MODULE, (dict_version/2, index/1, owner -- attr)) {
             PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
             DEOPT_IF(Py_TYPE(owner_o)->tp_getattro != PyModule_Type.tp_getattro);
@@ -3181,6 +3242,14 @@ dummy_func(
         // always END_FOR, which pops two values off the stack.
         // This is optimized by skipping that instruction and combining
         // its effect (popping 'iter' instead of pushing 'next'.)
+        //
+        // enumerate() and zip() go through the generic FOR_ITER. Every member
+        // of the family has to push the single 'next' value, so a member that
+        // pushed the components of the pair for the following UNPACK_SEQUENCE
+        // would need the compiler to emit a different instruction pair.
+        // The pair itself is not allocated per iteration: enum_next() and
+        // zip_next() reuse their result tuple whenever UNPACK_SEQUENCE has
+        // dropped the last other reference to it.
 
         family(FOR_ITER, INLINE_CACHE_ENTRIES_FOR_ITER) = {
             FOR_ITER_LIST,
@@ -4567,6 +4636,8 @@ dummy_func(
             CALL_KW_BOUND_METHOD,
             CALL_KW_PY,
             CALL_KW_NON_PY,
+            CALL_KW_BUILTIN_FAST_WITH_KEYWORDS,
+            CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
         };
 
         op(_MONITOR_CALL_KW, (callable, self_or_null, args[oparg], unused -- callable, self_or_null, args[oparg], unused)) {
@@ -4818,6 +4889,89 @@ dummy_func(
             _CALL_KW_NON_PY +
             _CHECK_PERIODIC;
 
+        op(_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS, (callable, self_or_null, args[oparg], kwnames -- res)) {
+            /* Builtin METH_FASTCALL | METH_KEYWORDS functions */
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            EXIT_IF(!PyCFunction_CheckExact(callable_o));
+            EXIT_IF(PyCFunction_GET_FLAGS(callable_o) != (METH_FASTCALL | METH_KEYWORDS));
+            STAT_INC(CALL_KW, hit);
+            /* res = func(self, arguments, nargs, kwnames) */
+            PyCFunctionFastWithKeywords cfunc =
+                _PyCFunctionFastWithKeywords_CAST(PyCFunction_GET_FUNCTION(callable_o));
+
+            STACKREFS_TO_PYOBJECTS(arguments, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true);
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            PyObject *res_o = cfunc(PyCFunction_GET_SELF(callable_o), args_o,
+                                    positional_args, kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_BUILTIN_FAST_WITH_KEYWORDS) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_BUILTIN_FAST_WITH_KEYWORDS +
+            _CHECK_PERIODIC;
+
+        op(_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS, (callable, self_or_null, args[oparg], kwnames -- res)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable);
+
+            int total_args = oparg;
+            _PyStackRef *arguments = args;
+            if (!PyStackRef_IsNull(self_or_null)) {
+                arguments--;
+                total_args++;
+            }
+            PyObject *kwnames_o = PyStackRef_AsPyObjectBorrow(kwnames);
+            int positional_args = total_args - (int)PyTuple_GET_SIZE(kwnames_o);
+            EXIT_IF(positional_args == 0);
+            PyMethodDescrObject *method = (PyMethodDescrObject *)callable_o;
+            EXIT_IF(!Py_IS_TYPE(method, &PyMethodDescr_Type));
+            PyMethodDef *meth = method->d_method;
+            EXIT_IF(meth->ml_flags != (METH_FASTCALL|METH_KEYWORDS));
+            PyTypeObject *d_type = method->d_common.d_type;
+            PyObject *self = PyStackRef_AsPyObjectBorrow(arguments[0]);
+            assert(self != NULL);
+            EXIT_IF(!Py_IS_TYPE(self, d_type));
+            STAT_INC(CALL_KW, hit);
+
+            STACKREFS_TO_PYOBJECTS(arguments, total_args, args_o);
+            if (CONVERSION_FAILED(args_o)) {
+                DECREF_INPUTS();
+                ERROR_IF(true);
+            }
+            PyCFunctionFastWithKeywords cfunc =
+                _PyCFunctionFastWithKeywords_CAST(meth->ml_meth);
+            PyObject *res_o = cfunc(self, (args_o + 1), positional_args - 1,
+                                    kwnames_o);
+            STACKREFS_TO_PYOBJECTS_CLEANUP(args_o);
+            assert((res_o != NULL) ^ (_PyErr_Occurred(tstate) != NULL));
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS) =
+            unused/1 + // Skip over the counter
+            unused/2 +
+            _CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS +
+            _CHECK_PERIODIC;
+
         op(_MAKE_CALLARGS_A_TUPLE, (func, unused, callargs, kwargs -- func, unused, callargs, kwargs)) {
             PyObject *callargs_o = PyStackRef_AsPyObjectBorrow(callargs);
             if (!PyTuple_CheckExact(callargs_o)) {
@@ -5414,19 +5568,19 @@ dummy_func(
             assert(tstate->tracing || eval_breaker == FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version));
         }
 
-        label(pop_2_error) {
+        cold label(pop_2_error) {
             stack_pointer -= 2;
             assert(WITHIN_STACK_BOUNDS());
             goto error;
         }
 
-        label(pop_1_error) {
+        cold label(pop_1_error) {
             stack_pointer -= 1;
             assert(WITHIN_STACK_BOUNDS());
             goto error;
         }
 
-        label(error) {
+        cold label(error) {
             /* Double-check exception status. */
 #ifdef NDEBUG
             if (!_PyErr_Occurred(tstate)) {
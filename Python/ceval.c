@@ -2967,6 +2967,45 @@ _PyEval_SliceIndex(PyObject *v, Py_ssize_t *pi)
     return 1;
 }
 
+/* Implementation of container[start:stop] for BINARY_SLICE.
+   Exact lists, tuples and strings sliced by ints or None are handled
+   without building a temporary slice object. Borrows all arguments. */
+PyObject *
+_PyEval_BinarySlice(PyObject *container, PyObject *start, PyObject *stop)
+{
+    if ((PyList_CheckExact(container) || PyTuple_CheckExact(container) ||
+         PyUnicode_CheckExact(container)) &&
+        (Py_IsNone(start) || PyLong_CheckExact(start)) &&
+        (Py_IsNone(stop) || PyLong_CheckExact(stop)))
+    {
+        Py_ssize_t istart = 0, istop = PY_SSIZE_T_MAX;
+        if (!_PyEval_SliceIndex(start, &istart) ||
+            !_PyEval_SliceIndex(stop, &istop))
+        {
+            return NULL;
+        }
+        if (PyList_CheckExact(container)) {
+            // PyList_GetSlice() clamps the indices again under the list's
+            // lock, in case the list is resized concurrently.
+            PySlice_AdjustIndices(PyList_GET_SIZE(container), &istart, &istop, 1);
+            return PyList_GetSlice(container, istart, istop);
+        }
+        if (PyTuple_CheckExact(container)) {
+            PySlice_AdjustIndices(PyTuple_GET_SIZE(container), &istart, &istop, 1);
+            return PyTuple_GetSlice(container, istart, istop);
+        }
+        PySlice_AdjustIndices(PyUnicode_GET_LENGTH(container), &istart, &istop, 1);
+        return PyUnicode_Substring(container, istart, istop);
+    }
+    PyObject *slice = PySlice_New(start, stop, NULL);
+    if (slice == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyObject_GetItem(container, slice);
+    Py_DECREF(slice);
+    return res;
+}
+
 int
 _PyEval_SliceIndexNotNone(PyObject *v, Py_ssize_t *pi)
 {
@@ -7,6 +7,8 @@
 #include "pycore_pylifecycle.h"   // _PyErr_Print()
 #include "pycore_pystats.h"       // _Py_PrintSpecializationStats()
 #include "pycore_runtime.h"       // _PyRuntime
+#include "pycore_stats.h"         // GIL_STAT_INC()
+#include "pydtrace.h"             // PyDTrace_GIL_ACQUIRE_START()
 
 
 /*
@@ -247,6 +249,9 @@ drop_gil(PyInterpreterState *interp, PyThreadState *tstate, int final_release)
     }
 
     drop_gil_impl(tstate, gil);
+    if (PyDTrace_GIL_RELEASE_ENABLED() && tstate != NULL) {
+        PyDTrace_GIL_RELEASE(tstate->thread_id);
+    }
 
 #ifdef FORCE_SWITCHING
     /* We might be releasing the GIL for the last time in this thread.  In that
@@ -267,6 +272,7 @@ drop_gil(PyInterpreterState *interp, PyThreadState *tstate, int final_release)
                releasing the mutex, another thread can run through, take
                the GIL and drop it again, and reset the condition
                before we even had a chance to wait for it. */
+            GIL_STAT_INC(forced_switches);
             COND_WAIT(gil->switch_cond, gil->switch_mutex);
         }
         MUTEX_UNLOCK(gil->switch_mutex);
@@ -318,8 +324,22 @@ take_gil(PyThreadState *tstate)
     /* Check that _PyEval_InitThreads() was called to create the lock */
     assert(gil_created(gil));
 
+    /* Every return below fires gil__acquire__done, so that the probes pair
+       up.  The paths that hang an exiting thread never return. */
+    if (PyDTrace_GIL_ACQUIRE_START_ENABLED()) {
+        PyDTrace_GIL_ACQUIRE_START(tstate->thread_id);
+    }
+
     MUTEX_LOCK(gil->mutex);
 
+#ifdef Py_STATS
+    PyTime_t wait_start = 0;
+    if (_Py_atomic_load_int_relaxed(&gil->locked)) {
+        GIL_STAT_INC(contended);
+        (void)PyTime_MonotonicRaw(&wait_start);
+    }
+#endif
+
     int drop_requested = 0;
     while (_Py_atomic_load_int_relaxed(&gil->locked)) {
         unsigned long saved_switchnum = gil->switch_number;
@@ -358,9 +378,18 @@ take_gil(PyThreadState *tstate)
 
             _Py_set_eval_breaker_bit(holder_tstate, _PY_GIL_DROP_REQUEST_BIT);
             drop_requested = 1;
+            GIL_STAT_INC(drop_requests);
         }
     }
 
+#ifdef Py_STATS
+    if (wait_start) {
+        PyTime_t wait_end;
+        (void)PyTime_MonotonicRaw(&wait_end);
+        GIL_STAT_ADD(wait_ns, wait_end - wait_start);
+    }
+#endif
+
 #ifdef Py_GIL_DISABLED
     if (!_Py_atomic_load_int_relaxed(&gil->enabled)) {
         // Another thread disabled the GIL between our check above and
@@ -368,6 +397,9 @@ take_gil(PyThreadState *tstate)
         // return.
         COND_SIGNAL(gil->cond);
         MUTEX_UNLOCK(gil->mutex);
+        if (PyDTrace_GIL_ACQUIRE_DONE_ENABLED()) {
+            PyDTrace_GIL_ACQUIRE_DONE(tstate->thread_id);
+        }
         return;
     }
 #endif
@@ -384,6 +416,10 @@ take_gil(PyThreadState *tstate)
     if (tstate != (PyThreadState*)_Py_atomic_load_ptr_relaxed(&gil->last_holder)) {
         _Py_atomic_store_ptr_relaxed(&gil->last_holder, tstate);
         ++gil->switch_number;
+        GIL_STAT_INC(switches);
+    }
+    if (PyDTrace_GIL_ACQUIRE_DONE_ENABLED()) {
+        PyDTrace_GIL_ACQUIRE_DONE(tstate->thread_id);
     }
 
 #ifdef FORCE_SWITCHING
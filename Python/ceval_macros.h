@@ -81,7 +81,13 @@
 #if Py_TAIL_CALL_INTERP
     // Note: [[clang::musttail]] works for GCC 15, but not __attribute__((musttail)) at the moment.
 #   define Py_MUSTTAIL [[clang::musttail]]
-#   define Py_PRESERVE_NONE_CC __attribute__((preserve_none))
+    // GCC has no preserve_none calling convention. The interpreter works with
+    // the default convention too, at the cost of some extra register spills.
+#   if _Py__has_attribute(preserve_none)
+#       define Py_PRESERVE_NONE_CC __attribute__((preserve_none))
+#   else
+#       define Py_PRESERVE_NONE_CC
+#   endif
     Py_PRESERVE_NONE_CC typedef PyObject* (*py_tail_call_funcptr)(TAIL_CALL_PARAMS);
 
 #   define TARGET(op) Py_PRESERVE_NONE_CC PyObject *_TAIL_CALL_##op(TAIL_CALL_PARAMS)
@@ -119,6 +125,18 @@
 #  define LABEL(name) name:
 #endif
 
+/* Labels declared "cold" in bytecodes.c are only reached on errors. Marking
+ * them cold lets the compiler move the branches that jump to them out of the
+ * hot instruction bodies. GCC supports the attribute on labels, but clang
+ * only supports it on functions. */
+#if Py_TAIL_CALL_INTERP && (defined(__GNUC__) || defined(__clang__))
+#  define COLD_LABEL(name) __attribute__((cold)) LABEL(name)
+#elif !Py_TAIL_CALL_INTERP && defined(__GNUC__) && !defined(__clang__)
+#  define COLD_LABEL(name) LABEL(name) __attribute__((cold));
+#else
+#  define COLD_LABEL(name) LABEL(name)
+#endif
+
 /* PRE_DISPATCH_GOTO() does lltrace if enabled. Normally a no-op */
 #ifdef Py_DEBUG
 #define PRE_DISPATCH_GOTO() if (frame->lltrace >= 5) { \
@@ -1322,8 +1322,6 @@ sys_is_finalizing(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys_is_finalizing_impl(module);
 }
 
-#if defined(Py_STATS)
-
 PyDoc_STRVAR(sys__stats_on__doc__,
 "_stats_on($module, /)\n"
 "--\n"
@@ -1342,10 +1340,6 @@ sys__stats_on(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__stats_on_impl(module);
 }
 
-#endif /* defined(Py_STATS) */
-
-#if defined(Py_STATS)
-
 PyDoc_STRVAR(sys__stats_off__doc__,
 "_stats_off($module, /)\n"
 "--\n"
@@ -1364,10 +1358,6 @@ sys__stats_off(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__stats_off_impl(module);
 }
 
-#endif /* defined(Py_STATS) */
-
-#if defined(Py_STATS)
-
 PyDoc_STRVAR(sys__stats_clear__doc__,
 "_stats_clear($module, /)\n"
 "--\n"
@@ -1386,7 +1376,26 @@ sys__stats_clear(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__stats_clear_impl(module);
 }
 
-#endif /* defined(Py_STATS) */
+PyDoc_STRVAR(sys__stats_get__doc__,
+"_stats_get($module, /)\n"
+"--\n"
+"\n"
+"Return the lightweight stats of the current interpreter as a dict.\n"
+"\n"
+"The stats are available in all builds. They are gathered between\n"
+"calls to sys._stats_on() and sys._stats_off().");
+
+#define SYS__STATS_GET_METHODDEF    \
+    {"_stats_get", (PyCFunction)sys__stats_get, METH_NOARGS, sys__stats_get__doc__},
+
+static PyObject *
+sys__stats_get_impl(PyObject *module);
+
+static PyObject *
+sys__stats_get(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__stats_get_impl(module);
+}
 
 #if defined(Py_STATS)
 
@@ -1905,6 +1914,53 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_jit_get_executors__doc__,
+"get_executors($module, code, /)\n"
+"--\n"
+"\n"
+"Return a list of dicts describing the executors attached to a code object.");
+
+#define _JIT_GET_EXECUTORS_METHODDEF    \
+    {"get_executors", (PyCFunction)_jit_get_executors, METH_O, _jit_get_executors__doc__},
+
+static PyObject *
+_jit_get_executors_impl(PyObject *module, PyObject *code);
+
+static PyObject *
+_jit_get_executors(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *code;
+
+    if (!PyObject_TypeCheck(arg, &PyCode_Type)) {
+        _PyArg_BadArgument("get_executors", "argument", (&PyCode_Type)->tp_name, arg);
+        goto exit;
+    }
+    code = arg;
+    return_value = _jit_get_executors_impl(module, code);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_jit_get_invalidations__doc__,
+"get_invalidations($module, /)\n"
+"--\n"
+"\n"
+"Return a dict mapping reasons to the number of executors that stopped being valid for that reason.");
+
+#define _JIT_GET_INVALIDATIONS_METHODDEF    \
+    {"get_invalidations", (PyCFunction)_jit_get_invalidations, METH_NOARGS, _jit_get_invalidations__doc__},
+
+static PyObject *
+_jit_get_invalidations_impl(PyObject *module);
+
+static PyObject *
+_jit_get_invalidations(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_get_invalidations_impl(module);
+}
+
 #ifndef SYS_GETWINDOWSVERSION_METHODDEF
     #define SYS_GETWINDOWSVERSION_METHODDEF
 #endif /* !defined(SYS_GETWINDOWSVERSION_METHODDEF) */
@@ -1929,18 +1985,6 @@ exit:
     #define SYS_GETTOTALREFCOUNT_METHODDEF
 #endif /* !defined(SYS_GETTOTALREFCOUNT_METHODDEF) */
 
-#ifndef SYS__STATS_ON_METHODDEF
-    #define SYS__STATS_ON_METHODDEF
-#endif /* !defined(SYS__STATS_ON_METHODDEF) */
-
-#ifndef SYS__STATS_OFF_METHODDEF
-    #define SYS__STATS_OFF_METHODDEF
-#endif /* !defined(SYS__STATS_OFF_METHODDEF) */
-
-#ifndef SYS__STATS_CLEAR_METHODDEF
-    #define SYS__STATS_CLEAR_METHODDEF
-#endif /* !defined(SYS__STATS_CLEAR_METHODDEF) */
-
 #ifndef SYS__STATS_DUMP_METHODDEF
     #define SYS__STATS_DUMP_METHODDEF
 #endif /* !defined(SYS__STATS_DUMP_METHODDEF) */
@@ -1948,4 +1992,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=449d16326e69dcf6 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=14f90d6304c273aa input=a9049054013a1b77]*/
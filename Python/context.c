@@ -792,8 +792,16 @@ contextvar_set(PyContextVar *var, PyObject *val)
         return -1;
     }
 
+#ifndef Py_GIL_DISABLED
+    /* The mapping of a context that has not been copied is owned by the
+       context alone and can be updated in place. */
+    PyHamtObject *new_vars = _PyHamt_AssocInPlace(
+        ctx->ctx_vars, (PyObject *)var, val);
+#else
+    /* Other threads may be reading the mapping of this context. */
     PyHamtObject *new_vars = _PyHamt_Assoc(
         ctx->ctx_vars, (PyObject *)var, val);
+#endif
     if (new_vars == NULL) {
         return -1;
     }
@@ -640,8 +640,9 @@ _tuple_shared_free(void* data)
 }
 
 static int
-_tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
-              _PyXIData_t *xidata)
+_tuple_items_shared(PyThreadState *tstate, PyObject *obj,
+                    xidata_fallback_t fallback, xid_newobjfunc new_object,
+                    _PyXIData_t *xidata)
 {
     Py_ssize_t len = PyTuple_GET_SIZE(obj);
     if (len < 0) {
@@ -678,7 +679,7 @@ _tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
         }
         shared->items[i] = xidata_i;
     }
-    _PyXIData_Init(xidata, tstate->interp, shared, obj, _new_tuple_object);
+    _PyXIData_Init(xidata, tstate->interp, shared, obj, new_object);
     _PyXIData_SET_FREE(xidata, _tuple_shared_free);
     return 0;
 
@@ -687,6 +688,43 @@ _tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
     return -1;
 }
 
+static int
+_tuple_shared(PyThreadState *tstate, PyObject *obj, xidata_fallback_t fallback,
+              _PyXIData_t *xidata)
+{
+    return _tuple_items_shared(tstate, obj, fallback, _new_tuple_object, xidata);
+}
+
+// frozenset
+
+static PyObject *
+_new_frozenset_object(_PyXIData_t *xidata)
+{
+    PyObject *items = _new_tuple_object(xidata);
+    if (items == NULL) {
+        return NULL;
+    }
+    PyObject *frozenset = PyFrozenSet_New(items);
+    Py_DECREF(items);
+    return frozenset;
+}
+
+static int
+_frozenset_shared(PyThreadState *tstate, PyObject *obj,
+                  xidata_fallback_t fallback, _PyXIData_t *xidata)
+{
+    // The items are shared like a tuple's.  The xidata keeps the temporary
+    // tuple (and through it the items) alive until it is released.
+    PyObject *items = PySequence_Tuple(obj);
+    if (items == NULL) {
+        return -1;
+    }
+    int res = _tuple_items_shared(tstate, items, fallback,
+                                  _new_frozenset_object, xidata);
+    Py_DECREF(items);
+    return res;
+}
+
 // code
 
 PyObject *
@@ -829,6 +867,11 @@ _register_builtins_for_crossinterpreter_data(dlregistry_t *xidregistry)
         Py_FatalError("could not register tuple for cross-interpreter sharing");
     }
 
+    // frozenset
+    if (REGISTER_FALLBACK(&PyFrozenSet_Type, _frozenset_shared) != 0) {
+        Py_FatalError("could not register frozenset for cross-interpreter sharing");
+    }
+
     // For now, we do not register PyCode_Type or PyFunction_Type.
 #undef REGISTER
 #undef REGISTER_FALLBACK
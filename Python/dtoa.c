@@ -129,6 +129,7 @@
 #if _PY_SHORT_FLOAT_REPR == 1
 
 #include "float.h"
+#include "dtoa_ryu.h"             // ryu_d2d()
 
 #define MALLOC PyMem_Malloc
 #define FREE PyMem_Free
@@ -2139,6 +2140,36 @@ nrv_alloc(const char *s, char **rve, int n)
     return rv;
 }
 
+/* Mode 0 of _Py_dg_dtoa for a positive, finite, nonzero d:  generate the
+   digits with Ryu (see dtoa_ryu.h) rather than with Bigint arithmetic. */
+
+static char *
+ryu_dtoa(U *d, int *decpt, char **rve)
+{
+    uint64_t output, t;
+    int32_t exponent;
+    int len;
+    char *s0, *s;
+
+    ryu_d2d((uint64_t)word0(d) << 32 | word1(d), &output, &exponent);
+    len = 1;
+    for (t = output; t >= 10; t /= 10)
+        len++;
+    s0 = rv_alloc(len);
+    if (s0 == NULL)
+        return NULL;
+    s = s0 + len;
+    *s = '\0';
+    if (rve)
+        *rve = s;
+    do {
+        *--s = '0' + (char)(output % 10);
+        output /= 10;
+    } while (output);
+    *decpt = len + exponent;
+    return s0;
+}
+
 /* freedtoa(s) must be used to free values s returned by dtoa
  * when MULTIPLE_THREADS is #defined.  It should be used in all cases,
  * but for consistency with earlier versions of dtoa, it is optional
@@ -2267,6 +2298,8 @@ _Py_dg_dtoa(double dd, int mode, int ndigits,
         *decpt = 1;
         return nrv_alloc("0", rve, 1);
     }
+    if (mode == 0)
+        return ryu_dtoa(&u, decpt, rve);
 
     /* compute k = floor(log10(d)).  The computation may leave k
        one too large, but should never leave k too small. */
@@ -1789,10 +1789,11 @@ do_gc_callback(GCState *gcstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsd}",
             "generation", generation,
             "collected", stats->collected,
-            "uncollectable", stats->uncollectable);
+            "uncollectable", stats->uncollectable,
+            "duration", stats->duration);
         if (info == NULL) {
             PyErr_FormatUnraisable("Exception ignored while invoking gc callbacks");
             return;
@@ -2030,6 +2031,9 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         PyDTrace_GC_START(generation);
     }
     PyObject *exc = _PyErr_GetRaisedException(tstate);
+    // ignore error: don't interrupt the GC if reading the clock fails
+    PyTime_t t1 = 0;
+    (void)PyTime_PerfCounterRaw(&t1);
     switch(generation) {
         case 0:
             gc_collect_young(tstate, &stats);
@@ -2043,6 +2047,10 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         default:
             Py_UNREACHABLE();
     }
+    PyTime_t t2 = 0;
+    (void)PyTime_PerfCounterRaw(&t2);
+    stats.duration = PyTime_AsSecondsDouble(t2 - t1);
+    gcstate->generation_stats[generation].duration += stats.duration;
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
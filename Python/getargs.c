@@ -2203,6 +2203,27 @@ find_keyword(PyObject *kwnames, PyObject *const *kwstack, PyObject *key)
     return NULL;
 }
 
+/* Return the index of key in kwtuple, or -1.  Like find_keyword(), try
+   identity first: both sides are normally interned strings. */
+static int
+find_keyword_index(PyObject *kwtuple, PyObject *key)
+{
+    Py_ssize_t i, n = PyTuple_GET_SIZE(kwtuple);
+
+    for (i = 0; i < n; i++) {
+        if (PyTuple_GET_ITEM(kwtuple, i) == key) {
+            return (int)i;
+        }
+    }
+    assert(PyUnicode_Check(key));
+    for (i = 0; i < n; i++) {
+        if (_PyUnicode_Equal(PyTuple_GET_ITEM(kwtuple, i), key)) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
 static int
 vgetargskeywordsfast_impl(PyObject *const *args, Py_ssize_t nargs,
                           PyObject *kwargs, PyObject *kwnames,
@@ -2549,42 +2570,70 @@ _PyArg_UnpackKeywords(PyObject *const *args, Py_ssize_t nargs,
         buf[i] = args[i];
     }
 
-    /* copy keyword args using kwtuple to drive process */
-    for (i = Py_MAX((int)nargs, posonly); i < maxargs; i++) {
-        PyObject *current_arg;
-        if (nkwargs) {
-            keyword = PyTuple_GET_ITEM(kwtuple, i - posonly);
-            if (kwargs != NULL) {
+    if (kwnames != NULL) {
+        /* Vectorcall: look each keyword argument up once, instead of
+           searching all of them for each parameter.  Parameters which were
+           not passed are then only tested for NULL. */
+        Py_ssize_t nleft = 0;
+        for (i = (int)nargs; i < maxargs; i++) {
+            buf[i] = NULL;
+        }
+        for (Py_ssize_t j = 0; j < nkwargs; j++) {
+            int k = find_keyword_index(kwtuple, PyTuple_GET_ITEM(kwnames, j));
+            if (k < 0 || posonly + k < nargs || buf[posonly + k] != NULL) {
+                /* Reported below */
+                nleft++;
+                continue;
+            }
+            buf[posonly + k] = kwstack[j];
+        }
+        for (i = Py_MAX((int)nargs, posonly); i < reqlimit; i++) {
+            if (buf[i] == NULL && (i < minpos || maxpos <= i)) {
+                /* Less arguments than required */
+                keyword = PyTuple_GET_ITEM(kwtuple, i - posonly);
+                PyErr_Format(PyExc_TypeError,  "%.200s%s missing required "
+                             "argument '%U' (pos %d)",
+                             (parser->fname == NULL) ? "function" : parser->fname,
+                             (parser->fname == NULL) ? "" : "()",
+                             keyword, i+1);
+                return NULL;
+            }
+        }
+        nkwargs = nleft;
+    }
+    else {
+        /* copy keyword args from the dict using kwtuple to drive process */
+        for (i = Py_MAX((int)nargs, posonly); i < maxargs; i++) {
+            PyObject *current_arg;
+            if (nkwargs) {
+                keyword = PyTuple_GET_ITEM(kwtuple, i - posonly);
                 if (PyDict_GetItemRef(kwargs, keyword, &current_arg) < 0) {
                     return NULL;
                 }
             }
+            else if (i >= reqlimit) {
+                break;
+            }
             else {
-                current_arg = find_keyword(kwnames, kwstack, keyword);
+                current_arg = NULL;
             }
-        }
-        else if (i >= reqlimit) {
-            break;
-        }
-        else {
-            current_arg = NULL;
-        }
 
-        buf[i] = current_arg;
+            buf[i] = current_arg;
 
-        if (current_arg) {
-            Py_DECREF(current_arg);
-            --nkwargs;
-        }
-        else if (i < minpos || (maxpos <= i && i < reqlimit)) {
-            /* Less arguments than required */
-            keyword = PyTuple_GET_ITEM(kwtuple, i - posonly);
-            PyErr_Format(PyExc_TypeError,  "%.200s%s missing required "
-                         "argument '%U' (pos %d)",
-                         (parser->fname == NULL) ? "function" : parser->fname,
-                         (parser->fname == NULL) ? "" : "()",
-                         keyword, i+1);
-            return NULL;
+            if (current_arg) {
+                Py_DECREF(current_arg);
+                --nkwargs;
+            }
+            else if (i < minpos || (maxpos <= i && i < reqlimit)) {
+                /* Less arguments than required */
+                keyword = PyTuple_GET_ITEM(kwtuple, i - posonly);
+                PyErr_Format(PyExc_TypeError,  "%.200s%s missing required "
+                             "argument '%U' (pos %d)",
+                             (parser->fname == NULL) ? "function" : parser->fname,
+                             (parser->fname == NULL) ? "" : "()",
+                             keyword, i+1);
+                return NULL;
+            }
         }
     }
 
@@ -225,6 +225,12 @@ There are three fundamental operations on an immutable dictionary:
    `hamt_node_assoc` function accepts a node object, and calls
    other functions depending on its actual type.
 
+   _PyHamt_AssocInPlace() is a variant for callers that own the only
+   reference to "o" and don't need the old collection: Bitmap and Array
+   nodes that are referenced only by their (equally unshared) parent are
+   updated in place instead of being copied.  contextvars uses it for
+   repeated `ContextVar.set()` calls in the same context.
+
 2. "o.find(k)" will lookup key "k" in "o".
 
    Functions:
@@ -337,7 +343,8 @@ hamt_alloc(void);
 static PyHamtNode *
 hamt_node_assoc(PyHamtNode *node,
                 uint32_t shift, int32_t hash,
-                PyObject *key, PyObject *val, int* added_leaf);
+                PyObject *key, PyObject *val, int* added_leaf,
+                int mutable);
 
 static hamt_without_t
 hamt_node_without(PyHamtNode *node,
@@ -551,6 +558,17 @@ hamt_node_bitmap_clone(PyHamtNode_Bitmap *node)
     return clone;
 }
 
+static PyHamtNode_Bitmap *
+hamt_node_bitmap_clone_or_self(PyHamtNode_Bitmap *node, int inplace)
+{
+    /* Return a new reference to a node that can be modified: 'node'
+       itself when updating in place, otherwise a clone of it. */
+    if (inplace) {
+        return (PyHamtNode_Bitmap *)Py_NewRef(node);
+    }
+    return hamt_node_bitmap_clone(node);
+}
+
 static PyHamtNode_Bitmap *
 hamt_node_bitmap_clone_without(PyHamtNode_Bitmap *o, uint32_t bit)
 {
@@ -623,13 +641,13 @@ hamt_node_new_bitmap_or_collision(uint32_t shift,
         }
 
         PyHamtNode *n2 = hamt_node_assoc(
-            n, shift, key1_hash, key1, val1, &added_leaf);
+            n, shift, key1_hash, key1, val1, &added_leaf, 0);
         Py_DECREF(n);
         if (n2 == NULL) {
             return NULL;
         }
 
-        n = hamt_node_assoc(n2, shift, key2_hash, key2, val2, &added_leaf);
+        n = hamt_node_assoc(n2, shift, key2_hash, key2, val2, &added_leaf, 0);
         Py_DECREF(n2);
         if (n == NULL) {
             return NULL;
@@ -642,7 +660,8 @@ hamt_node_new_bitmap_or_collision(uint32_t shift,
 static PyHamtNode *
 hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                        uint32_t shift, int32_t hash,
-                       PyObject *key, PyObject *val, int* added_leaf)
+                       PyObject *key, PyObject *val, int* added_leaf,
+                       int mutable)
 {
     /* assoc operation for bitmap nodes.
 
@@ -651,10 +670,15 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
 
        'added_leaf' is later used in '_PyHamt_Assoc' to determine if
        `hamt.set(key, val)` increased the size of the collection.
+
+       If 'mutable' is set, the caller owns the path from the root to
+       this node, and the node may be updated in place (and returned)
+       if nothing else references it.
     */
 
     uint32_t bit = hamt_bitpos(hash, shift);
     uint32_t idx = hamt_bitindex(self->b_bitmap, bit);
+    int inplace = mutable && _PyObject_IsUniquelyReferenced((PyObject *)self);
 
     /* Bitmap node layout:
 
@@ -689,7 +713,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
 
             PyHamtNode *sub_node = hamt_node_assoc(
                 (PyHamtNode *)val_or_node,
-                shift + 5, hash, key, val, added_leaf);
+                shift + 5, hash, key, val, added_leaf, inplace);
             if (sub_node == NULL) {
                 return NULL;
             }
@@ -699,7 +723,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                 return (PyHamtNode *)Py_NewRef(self);
             }
 
-            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone_or_self(self, inplace);
             if (ret == NULL) {
                 return NULL;
             }
@@ -723,7 +747,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
 
             /* We're setting a new value for the key we had before.
                Make a new bitmap node with a replaced value, and return it. */
-            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone_or_self(self, inplace);
             if (ret == NULL) {
                 return NULL;
             }
@@ -749,7 +773,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             return NULL;
         }
 
-        PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+        PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone_or_self(self, inplace);
         if (ret == NULL) {
             Py_DECREF(sub_node);
             return NULL;
@@ -805,7 +829,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             /* Make a new bitmap node for the key/val we're adding.
                Set that bitmap node to new-array-node[jdx]. */
             new_node->a_array[jdx] = hamt_node_assoc(
-                empty, shift + 5, hash, key, val, added_leaf);
+                empty, shift + 5, hash, key, val, added_leaf, 0);
             if (new_node->a_array[jdx] == NULL) {
                 goto fin;
             }
@@ -835,7 +859,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                             rehash,
                             self->b_array[j],
                             self->b_array[j + 1],
-                            added_leaf);
+                            added_leaf, 0);
 
                         if (new_node->a_array[i] == NULL) {
                             goto fin;
@@ -1363,7 +1387,7 @@ hamt_node_collision_assoc(PyHamtNode_Collision *self,
         new_node->b_array[1] = Py_NewRef(self);
 
         assoc_res = hamt_node_bitmap_assoc(
-            new_node, shift, hash, key, val, added_leaf);
+            new_node, shift, hash, key, val, added_leaf, 0);
         Py_DECREF(new_node);
         return assoc_res;
     }
@@ -1604,13 +1628,16 @@ hamt_node_array_clone(PyHamtNode_Array *node)
 static PyHamtNode *
 hamt_node_array_assoc(PyHamtNode_Array *self,
                       uint32_t shift, int32_t hash,
-                      PyObject *key, PyObject *val, int* added_leaf)
+                      PyObject *key, PyObject *val, int* added_leaf,
+                      int mutable)
 {
     /* Set a new key to this level (currently a Collision node)
        of the tree.
 
        Array nodes don't store values, they can only point to
        other nodes.  They are simple arrays of 32 BaseNode pointers/
+
+       See hamt_node_bitmap_assoc() for 'mutable'.
      */
 
     uint32_t idx = hamt_mask(hash, shift);
@@ -1618,6 +1645,7 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
     PyHamtNode *child_node;
     PyHamtNode_Array *new_node;
     Py_ssize_t i;
+    int inplace = mutable && _PyObject_IsUniquelyReferenced((PyObject *)self);
 
     if (node == NULL) {
         /* There's no child node for the given hash.  Create a new
@@ -1635,12 +1663,19 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
            creating a new Bitmap node with our key/value pair. */
         child_node = hamt_node_bitmap_assoc(
             empty,
-            shift + 5, hash, key, val, added_leaf);
+            shift + 5, hash, key, val, added_leaf, 0);
         Py_DECREF(empty);
         if (child_node == NULL) {
             return NULL;
         }
 
+        if (inplace) {
+            self->a_array[idx] = child_node;  /* borrow */
+            self->a_count++;
+            VALIDATE_ARRAY_NODE(self)
+            return (PyHamtNode *)Py_NewRef(self);
+        }
+
         /* Create a new Array node. */
         new_node = (PyHamtNode_Array *)hamt_node_array_new(self->a_count + 1);
         if (new_node == NULL) {
@@ -1662,7 +1697,7 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
         /* There's a child node for the given hash.
            Set the key to it./ */
         child_node = hamt_node_assoc(
-            node, shift + 5, hash, key, val, added_leaf);
+            node, shift + 5, hash, key, val, added_leaf, inplace);
         if (child_node == NULL) {
             return NULL;
         }
@@ -1671,10 +1706,15 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
             return (PyHamtNode *)self;
         }
 
-        new_node = hamt_node_array_clone(self);
-        if (new_node == NULL) {
-            Py_DECREF(child_node);
-            return NULL;
+        if (inplace) {
+            new_node = (PyHamtNode_Array *)Py_NewRef(self);
+        }
+        else {
+            new_node = hamt_node_array_clone(self);
+            if (new_node == NULL) {
+                Py_DECREF(child_node);
+                return NULL;
+            }
         }
 
         Py_SETREF(new_node->a_array[idx], child_node);  /* borrow */
@@ -1933,11 +1973,13 @@ hamt_node_array_dump(PyHamtNode_Array *node,
 static PyHamtNode *
 hamt_node_assoc(PyHamtNode *node,
                 uint32_t shift, int32_t hash,
-                PyObject *key, PyObject *val, int* added_leaf)
+                PyObject *key, PyObject *val, int* added_leaf,
+                int mutable)
 {
     /* Set key/value to the 'node' starting with the given shift/hash.
        Return a new node, or the same node if key/value already
-       set.
+       set (or if 'node' was updated in place, see
+       hamt_node_bitmap_assoc()).
 
        added_leaf will be set to 1 if key/value wasn't in the
        tree before.
@@ -1949,12 +1991,12 @@ hamt_node_assoc(PyHamtNode *node,
     if (IS_BITMAP_NODE(node)) {
         return hamt_node_bitmap_assoc(
             (PyHamtNode_Bitmap *)node,
-            shift, hash, key, val, added_leaf);
+            shift, hash, key, val, added_leaf, mutable);
     }
     else if (IS_ARRAY_NODE(node)) {
         return hamt_node_array_assoc(
             (PyHamtNode_Array *)node,
-            shift, hash, key, val, added_leaf);
+            shift, hash, key, val, added_leaf, mutable);
     }
     else {
         assert(IS_COLLISION_NODE(node));
@@ -2206,8 +2248,8 @@ hamt_iterator_next(PyHamtIteratorState *iter, PyObject **key, PyObject **val)
 /////////////////////////////////// HAMT high-level functions
 
 
-PyHamtObject *
-_PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val)
+static PyHamtObject *
+hamt_assoc(PyHamtObject *o, PyObject *key, PyObject *val, int mutable)
 {
     int32_t key_hash;
     int added_leaf = 0;
@@ -2221,16 +2263,29 @@ _PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val)
 
     new_root = hamt_node_assoc(
         (PyHamtNode *)(o->h_root),
-        0, key_hash, key, val, &added_leaf);
+        0, key_hash, key, val, &added_leaf, mutable);
     if (new_root == NULL) {
         return NULL;
     }
 
     if (new_root == o->h_root) {
+        /* Either nothing changed, or the root was updated in place. */
+        assert(mutable || !added_leaf);
+        if (added_leaf) {
+            o->h_count++;
+        }
         Py_DECREF(new_root);
         return (PyHamtObject*)Py_NewRef(o);
     }
 
+    if (mutable) {
+        Py_SETREF(o->h_root, new_root);
+        if (added_leaf) {
+            o->h_count++;
+        }
+        return (PyHamtObject*)Py_NewRef(o);
+    }
+
     new_o = hamt_alloc();
     if (new_o == NULL) {
         Py_DECREF(new_root);
@@ -2243,6 +2298,19 @@ _PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val)
     return new_o;
 }
 
+PyHamtObject *
+_PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val)
+{
+    return hamt_assoc(o, key, val, 0);
+}
+
+PyHamtObject *
+_PyHamt_AssocInPlace(PyHamtObject *o, PyObject *key, PyObject *val)
+{
+    return hamt_assoc(o, key, val,
+                      _PyObject_IsUniquelyReferenced((PyObject *)o));
+}
+
 PyHamtObject *
 _PyHamt_Without(PyHamtObject *o, PyObject *key)
 {
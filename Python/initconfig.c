@@ -152,6 +152,7 @@ static const PyConfigSpec PYCONFIG_SPEC[] = {
     SPEC(hash_seed, ULONG, READ_ONLY, NO_SYS),
     SPEC(home, WSTR_OPT, READ_ONLY, NO_SYS),
     SPEC(thread_inherit_context, INT, READ_ONLY, NO_SYS),
+    SPEC(type_cache_size, UINT, READ_ONLY, NO_SYS),
     SPEC(context_aware_warnings, INT, READ_ONLY, NO_SYS),
     SPEC(import_time, UINT, READ_ONLY, NO_SYS),
     SPEC(install_signal_handlers, BOOL, READ_ONLY, NO_SYS),
@@ -336,7 +337,8 @@ The following implementation-specific options are available:\n\
 "\
 -X showrefcount: output the total reference count and number of used\n\
          memory blocks when the program finishes or after each statement in\n\
-         the interactive interpreter; only works on debug builds\n"
+         the interactive interpreter; only works on debug builds\n\
+-X startuptime: show how long each interpreter initialization phase takes\n"
 #ifdef Py_GIL_DISABLED
 "-X tlbc=[0|1]: enable (1) or disable (0) thread-local bytecode. Also\n\
          PYTHON_TLBC\n"
@@ -350,6 +352,8 @@ The following implementation-specific options are available:\n\
          use module globals, which is not concurrent-safe; set to true for\n\
          free-threaded builds and false otherwise; also\n\
          PYTHON_CONTEXT_AWARE_WARNINGS\n\
+-X type_cache_size=N: number of entries of the type attribute cache; N must\n\
+         be a power of two (default: 4096); also PYTHON_TYPE_CACHE_SIZE\n\
 -X tracemalloc[=N]: trace Python memory allocations; N sets a traceback limit\n \
          of N frames (default: 1); also PYTHONTRACEMALLOC=N\n\
 -X utf8[=0|1]: enable (1) or disable (0) UTF-8 mode; also PYTHONUTF8\n\
@@ -441,6 +445,8 @@ static const char usage_envvars[] =
 "                   (-X thread_inherit_context)\n"
 "PYTHON_CONTEXT_AWARE_WARNINGS: if true (1), enable thread-safe warnings module\n"
 "                   behaviour (-X context_aware_warnings)\n"
+"PYTHON_TYPE_CACHE_SIZE: number of entries of the type attribute cache\n"
+"                   (-X type_cache_size)\n"
 "PYTHONTRACEMALLOC: trace Python memory allocations (-X tracemalloc)\n"
 "PYTHONUNBUFFERED: disable stdout/stderr buffering (-u)\n"
 "PYTHONUTF8      : control the UTF-8 mode (-X utf8)\n"
@@ -940,6 +946,7 @@ config_check_consistency(const PyConfig *config)
     // by _PyConfig_InitImportConfig().
     assert(config->thread_inherit_context >= 0);
     assert(config->context_aware_warnings >= 0);
+    assert(config->type_cache_size > 0);
 #ifdef __APPLE__
     assert(config->use_system_logger >= 0);
 #endif
@@ -1047,6 +1054,7 @@ _PyConfig_InitCompatConfig(PyConfig *config)
     config->_is_python_build = 0;
     config->code_debug_ranges = 1;
     config->cpu_count = -1;
+    config->type_cache_size = 1 << MCACHE_SIZE_EXP;
 #ifdef Py_GIL_DISABLED
     config->thread_inherit_context = 1;
     config->context_aware_warnings = 1;
@@ -2013,6 +2021,41 @@ config_init_context_aware_warnings(PyConfig *config)
     return _PyStatus_OK();
 }
 
+static PyStatus
+config_init_type_cache_size(PyConfig *config)
+{
+    int size;
+    const char *env = config_get_env(config, "PYTHON_TYPE_CACHE_SIZE");
+    if (env) {
+        if (_Py_str_to_int(env, &size) < 0) {
+            goto error;
+        }
+        config->type_cache_size = size;
+    }
+
+    const wchar_t *xoption = config_get_xoption(config, L"type_cache_size");
+    if (xoption) {
+        const wchar_t *sep = wcschr(xoption, L'=');
+        if (!sep || config_wstr_to_int(sep + 1, &size) < 0) {
+            goto error;
+        }
+        config->type_cache_size = size;
+    }
+
+    // Also check a size set directly in PyConfig
+    size = config->type_cache_size;
+    if (size < MCACHE_MIN_SIZE || size > MCACHE_MAX_SIZE
+        || (size & (size - 1)) != 0)
+    {
+        goto error;
+    }
+    return _PyStatus_OK();
+
+error:
+    return _PyStatus_ERR("type_cache_size is missing or invalid, "
+                         "it must be a power of two from 256 to 16777216");
+}
+
 static PyStatus
 config_init_tlbc(PyConfig *config)
 {
@@ -2370,6 +2413,11 @@ config_read_complex_options(PyConfig *config)
         return status;
     }
 
+    status = config_init_type_cache_size(config);
+    if (_PyStatus_EXCEPTION(status)) {
+        return status;
+    }
+
     return _PyStatus_OK();
 }
 
@@ -25,6 +25,7 @@
 #include "pycore_template.h"
 #include "pycore_tuple.h"
 #include "pycore_unicodeobject.h"
+#include "pycore_uop_metadata.h"
 
 #include "pycore_jit.h"
 
@@ -519,10 +520,10 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     for (size_t i = 0; i < Py_ARRAY_LENGTH(state.trampolines.mask); i++) {
         state.trampolines.size += _Py_popcount32(state.trampolines.mask[i]) * TRAMPOLINE_SIZE;
     }
-    // Round up to the nearest page:
+    // Round up to the nearest page (an exact multiple needs no padding):
     size_t page_size = get_page_size();
     assert((page_size & (page_size - 1)) == 0);
-    size_t padding = page_size - ((code_size + state.trampolines.size + data_size) & (page_size - 1));
+    size_t padding = (page_size - ((code_size + state.trampolines.size + data_size) & (page_size - 1))) & (page_size - 1);
     size_t total_size = code_size + state.trampolines.size + data_size  + padding;
     unsigned char *memory = jit_alloc(total_size);
     if (memory == NULL) {
@@ -581,6 +582,61 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     return 0;
 }
 
+static void
+write_perf_entry(const void *code_addr, size_t code_size, const char *prefix,
+                 const char *name)
+{
+    if (code_size == 0) {
+        return;
+    }
+    size_t size = strlen(prefix) + strlen(name) + 1;
+    char *entry = PyMem_RawMalloc(size);
+    if (entry == NULL) {
+        return;
+    }
+    snprintf(entry, size, "%s%s", prefix, name);
+    _PyPerfTrampoline_WriteNamedEntry(code_addr, (unsigned int)code_size,
+                                      entry);
+    PyMem_RawFree(entry);
+}
+
+// Register the machine code of the executor with the active perf trampoline
+// backend, if any: one symbol for the shim and one per uop, named after the
+// code object where the trace starts, like "py::f:spam.py:jit:_LOAD_FAST_1".
+void
+_PyJIT_WritePerfEntries(_PyExecutorObject *executor, PyCodeObject *code)
+{
+    if (executor->jit_code == NULL || !_PyIsPerfTrampolineActive()) {
+        return;
+    }
+    const char *qualname = PyUnicode_AsUTF8(code->co_qualname);
+    const char *filename = PyUnicode_AsUTF8(code->co_filename);
+    if (qualname == NULL || filename == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    size_t size = snprintf(NULL, 0, "py::%s:%s:jit:", qualname, filename) + 1;
+    char *prefix = PyMem_RawMalloc(size);
+    if (prefix == NULL) {
+        return;
+    }
+    snprintf(prefix, size, "py::%s:%s:jit:", qualname, filename);
+    // Same layout as in _PyJIT_Compile():
+    unsigned char *code_addr = executor->jit_code;
+    write_perf_entry(code_addr, shim.code_size, prefix, "shim");
+    code_addr += shim.code_size;
+    for (size_t i = 0; i < executor->code_size; i++) {
+        int opcode = executor->trace[i].opcode;
+        const StencilGroup *group = &stencil_groups[opcode];
+        write_perf_entry(code_addr, group->code_size, prefix,
+                         _PyOpcode_uop_name[opcode]);
+        code_addr += group->code_size;
+    }
+    const StencilGroup *group = &stencil_groups[_FATAL_ERROR];
+    write_perf_entry(code_addr, group->code_size, prefix, "_FATAL_ERROR");
+    PyMem_RawFree(prefix);
+}
+
 void
 _PyJIT_Free(_PyExecutorObject *executor)
 {
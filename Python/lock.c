@@ -5,7 +5,9 @@
 #include "pycore_lock.h"
 #include "pycore_parking_lot.h"
 #include "pycore_semaphore.h"
+#include "pycore_stats.h"         // LOCK_STAT_INC()
 #include "pycore_time.h"          // _PyTime_Add()
+#include "pydtrace.h"             // PyDTrace_MUTEX_PARK_START()
 
 #ifdef MS_WINDOWS
 #  ifndef WIN32_LEAN_AND_MEAN
@@ -61,6 +63,7 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
     if (timeout == 0) {
         return PY_LOCK_FAILURE;
     }
+    LOCK_STAT_INC(slow_path);
 
     PyTime_t now;
     // silently ignore error: cannot report error to the caller
@@ -89,6 +92,7 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
             // Spin for a bit.
             _Py_yield();
             spin_count++;
+            LOCK_STAT_INC(spins);
             continue;
         }
 
@@ -117,10 +121,27 @@ _PyMutex_LockTimed(PyMutex *m, PyTime_t timeout, _PyLockFlags flags)
             }
         }
 
+#ifdef Py_STATS
+        PyTime_t park_start;
+        (void)PyTime_MonotonicRaw(&park_start);
+#endif
+        if (PyDTrace_MUTEX_PARK_START_ENABLED()) {
+            PyDTrace_MUTEX_PARK_START(m);
+        }
         int ret = _PyParkingLot_Park(&m->_bits, &newv, sizeof(newv), timeout,
                                      &entry, (flags & _PY_LOCK_DETACH) != 0);
+        if (PyDTrace_MUTEX_PARK_DONE_ENABLED()) {
+            PyDTrace_MUTEX_PARK_DONE(m, ret);
+        }
+#ifdef Py_STATS
+        PyTime_t park_end;
+        (void)PyTime_MonotonicRaw(&park_end);
+        LOCK_STAT_INC(parks);
+        LOCK_STAT_ADD(park_ns, park_end - park_start);
+#endif
         if (ret == Py_PARK_OK) {
             if (entry.handed_off) {
+                LOCK_STAT_INC(handoffs);
                 // We own the lock now.
                 assert(_Py_atomic_load_uint8_relaxed(&m->_bits) & _Py_LOCKED);
                 return PY_LOCK_ACQUIRED;
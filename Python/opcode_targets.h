@@ -152,6 +152,8 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_BUILTIN_O,
     &&TARGET_CALL_ISINSTANCE,
     &&TARGET_CALL_KW_BOUND_METHOD,
+    &&TARGET_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS,
+    &&TARGET_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
     &&TARGET_CALL_KW_NON_PY,
     &&TARGET_CALL_KW_PY,
     &&TARGET_CALL_LEN,
@@ -181,6 +183,7 @@ static void *opcode_targets[256] = {
     &&TARGET_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
     &&TARGET_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
     &&TARGET_LOAD_ATTR_INSTANCE_VALUE,
+    &&TARGET_LOAD_ATTR_INSTANCE_VALUE_POLY,
     &&TARGET_LOAD_ATTR_METHOD_LAZY_DICT,
     &&TARGET_LOAD_ATTR_METHOD_NO_DICT,
     &&TARGET_LOAD_ATTR_METHOD_WITH_VALUES,
@@ -201,6 +204,7 @@ static void *opcode_targets[256] = {
     &&TARGET_STORE_ATTR_WITH_HINT,
     &&TARGET_STORE_SUBSCR_DICT,
     &&TARGET_STORE_SUBSCR_LIST_INT,
+    &&TARGET_STORE_SUBSCR_PY_SETITEM,
     &&TARGET_TO_BOOL_ALWAYS_TRUE,
     &&TARGET_TO_BOOL_BOOL,
     &&TARGET_TO_BOOL_INT,
@@ -230,10 +234,6 @@ static void *opcode_targets[256] = {
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_POP_ITER,
     &&TARGET_INSTRUMENTED_END_SEND,
@@ -307,6 +307,8 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_INTRINSIC_2(TAIL_CALL_PARAM
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_ISINSTANCE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_BOUND_METHOD(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_NON_PY(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_KW_PY(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_LEN(TAIL_CALL_PARAMS);
@@ -398,6 +400,7 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS(TAIL_CALL_PARAMS
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE_POLY(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES(TAIL_CALL_PARAMS);
@@ -474,6 +477,7 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SLICE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR_LIST_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_SUBSCR_PY_SETITEM(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SWAP(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_TO_BOOL_ALWAYS_TRUE(TAIL_CALL_PARAMS);
@@ -544,6 +548,8 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [CALL_ISINSTANCE] = _TAIL_CALL_CALL_ISINSTANCE,
     [CALL_KW] = _TAIL_CALL_CALL_KW,
     [CALL_KW_BOUND_METHOD] = _TAIL_CALL_CALL_KW_BOUND_METHOD,
+    [CALL_KW_BUILTIN_FAST_WITH_KEYWORDS] = _TAIL_CALL_CALL_KW_BUILTIN_FAST_WITH_KEYWORDS,
+    [CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = _TAIL_CALL_CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
     [CALL_KW_NON_PY] = _TAIL_CALL_CALL_KW_NON_PY,
     [CALL_KW_PY] = _TAIL_CALL_CALL_KW_PY,
     [CALL_LEN] = _TAIL_CALL_CALL_LEN,
@@ -635,6 +641,7 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = _TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
     [LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN] = _TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
     [LOAD_ATTR_INSTANCE_VALUE] = _TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE,
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = _TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE_POLY,
     [LOAD_ATTR_METHOD_LAZY_DICT] = _TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT,
     [LOAD_ATTR_METHOD_NO_DICT] = _TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT,
     [LOAD_ATTR_METHOD_WITH_VALUES] = _TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES,
@@ -711,6 +718,7 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [STORE_SUBSCR] = _TAIL_CALL_STORE_SUBSCR,
     [STORE_SUBSCR_DICT] = _TAIL_CALL_STORE_SUBSCR_DICT,
     [STORE_SUBSCR_LIST_INT] = _TAIL_CALL_STORE_SUBSCR_LIST_INT,
+    [STORE_SUBSCR_PY_SETITEM] = _TAIL_CALL_STORE_SUBSCR_PY_SETITEM,
     [SWAP] = _TAIL_CALL_SWAP,
     [TO_BOOL] = _TAIL_CALL_TO_BOOL,
     [TO_BOOL_ALWAYS_TRUE] = _TAIL_CALL_TO_BOOL_ALWAYS_TRUE,
@@ -736,10 +744,6 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [125] = _TAIL_CALL_UNKNOWN_OPCODE,
     [126] = _TAIL_CALL_UNKNOWN_OPCODE,
     [127] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [210] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [211] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [212] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [213] = _TAIL_CALL_UNKNOWN_OPCODE,
     [214] = _TAIL_CALL_UNKNOWN_OPCODE,
     [215] = _TAIL_CALL_UNKNOWN_OPCODE,
     [216] = _TAIL_CALL_UNKNOWN_OPCODE,
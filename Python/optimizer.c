@@ -18,6 +18,7 @@
 #include "pycore_unicodeobject.h" // _PyUnicode_FromASCII
 #include "pycore_uop_ids.h"
 #include "pycore_jit.h"
+#include "pydtrace.h"               // PyDTrace_EXECUTOR_CREATE()
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
@@ -263,6 +264,13 @@ add_to_pending_deletion_list(_PyExecutorObject *self)
     }
 }
 
+static void
+count_invalidation(_PyExecutorObject *executor)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    interp->executor_invalidations[executor->vm_data.invalidation_reason]++;
+}
+
 static void
 uop_dealloc(PyObject *op) {
     _PyExecutorObject *self = _PyExecutorObject_CAST(op);
@@ -270,6 +278,9 @@ uop_dealloc(PyObject *op) {
     assert(self->vm_data.code == NULL);
     unlink_executor(self);
     // Once unlinked it becomes impossible to invalidate an executor, so do it here.
+    if (self->vm_data.valid) {
+        count_invalidation(self);
+    }
     self->vm_data.valid = 0;
     add_to_pending_deletion_list(self);
 }
@@ -627,6 +638,11 @@ translate_bytecode_to_trace(
             goto done;
         }
         assert(opcode != ENTER_EXECUTOR && opcode != EXTENDED_ARG);
+        if (opcode == LOAD_ATTR_INSTANCE_VALUE_POLY) {
+            // Its cache entries don't fit in the operands of a single uop,
+            // so trace the generic instruction instead.
+            opcode = LOAD_ATTR;
+        }
         RESERVE_RAW(2, "_CHECK_VALIDITY");
         ADD_TO_TRACE(_CHECK_VALIDITY, 0, 0, target);
         if (!OPCODE_HAS_NO_SAVE_IP(opcode)) {
@@ -1258,6 +1274,19 @@ int effective_trace_length(_PyUOpInstruction *buffer, int length)
 }
 #endif
 
+/* A name to pass to a probe.  Probes cannot fail: if the name cannot be
+   encoded, pass a placeholder and drop the error. */
+static const char *
+probe_name(PyObject *name)
+{
+    const char *str = PyUnicode_AsUTF8(name);
+    if (str == NULL) {
+        PyErr_Clear();
+        return "<unknown>";
+    }
+    return str;
+}
+
 static int
 uop_optimize(
     _PyInterpreterFrame *frame,
@@ -1309,6 +1338,17 @@ uop_optimize(
         return -1;
     }
     assert(length <= UOP_MAX_TRACE_LENGTH);
+#ifdef _Py_JIT
+    _PyJIT_WritePerfEntries(executor, _PyFrame_GetCode(frame));
+#endif
+    if (PyDTrace_EXECUTOR_CREATE_ENABLED()) {
+        PyCodeObject *code = _PyFrame_GetCode(frame);
+        int lineno = PyCode_Addr2Line(code,
+            (int)((instr - _PyCode_CODE(code)) * sizeof(_Py_CODEUNIT)));
+        PyDTrace_EXECUTOR_CREATE(executor, probe_name(code->co_filename),
+                                 probe_name(code->co_qualname),
+                                 lineno, length);
+    }
     *exec_ptr = executor;
     return 1;
 }
@@ -1456,6 +1496,7 @@ void
 _Py_ExecutorInit(_PyExecutorObject *executor, const _PyBloomFilter *dependency_set)
 {
     executor->vm_data.valid = true;
+    executor->vm_data.invalidation_reason = _Py_EXECUTOR_FREED;
     for (int i = 0; i < _Py_BLOOM_FILTER_WORDS; i++) {
         executor->vm_data.bloom.bits[i] = dependency_set->bits[i];
     }
@@ -1491,7 +1532,11 @@ executor_clear(PyObject *op)
     }
     assert(executor->vm_data.valid == 1);
     unlink_executor(executor);
+    count_invalidation(executor);
     executor->vm_data.valid = 0;
+    if (PyDTrace_EXECUTOR_INVALIDATE_ENABLED()) {
+        PyDTrace_EXECUTOR_INVALIDATE(executor);
+    }
     /* It is possible for an executor to form a reference
      * cycle with itself, so decref'ing a side exit could
      * free the executor unless we hold a strong reference to it
@@ -1513,6 +1558,31 @@ _Py_Executor_DependsOn(_PyExecutorObject *executor, void *obj)
     _Py_BloomFilter_Add(&executor->vm_data.bloom, obj);
 }
 
+static void
+executor_invalidate(PyObject *op, _PyExecutorInvalidationReason reason)
+{
+    _PyExecutorObject *executor = _PyExecutorObject_CAST(op);
+    if (executor->vm_data.valid) {
+        executor->vm_data.invalidation_reason = reason;
+    }
+    executor_clear(op);
+}
+
+static _PyExecutorInvalidationReason
+dependency_reason(PyObject *obj)
+{
+    if (PyDict_Check(obj)) {
+        return _Py_EXECUTOR_INVALIDATED_DICT;
+    }
+    if (PyType_Check(obj)) {
+        return _Py_EXECUTOR_INVALIDATED_TYPE;
+    }
+    if (PyCode_Check(obj)) {
+        return _Py_EXECUTOR_INVALIDATED_CODE;
+    }
+    return _Py_EXECUTOR_INVALIDATED_OTHER;
+}
+
 /* Invalidate all executors that depend on `obj`
  * May cause other executors to be invalidated as well
  */
@@ -1540,11 +1610,13 @@ _Py_Executors_InvalidateDependency(PyInterpreterState *interp, void *obj, int is
         }
         exec = next;
     }
+    _PyExecutorInvalidationReason reason = dependency_reason((PyObject *)obj);
     for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
         PyObject *exec = PyList_GET_ITEM(invalidate, i);
-        executor_clear(exec);
+        executor_invalidate(exec, reason);
         if (is_invalidation) {
             OPT_STAT_INC(executors_invalidated);
+            LITE_STAT_INC(executors_invalidated);
         }
     }
     Py_DECREF(invalidate);
@@ -1560,6 +1632,15 @@ _Py_Executors_InvalidateDependency(PyInterpreterState *interp, void *obj, int is
 void
 _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation)
 {
+    // Clearing the executors of a code object can free them, so record the
+    // reason on all of them first.
+    for (_PyExecutorObject *exec = interp->executor_list_head; exec != NULL;
+         exec = exec->vm_data.links.next)
+    {
+        exec->vm_data.invalidation_reason = (is_invalidation
+                                             ? _Py_EXECUTOR_INVALIDATED_ALL
+                                             : _Py_EXECUTOR_CLEARED);
+    }
     while (interp->executor_list_head) {
         _PyExecutorObject *executor = interp->executor_list_head;
         assert(executor->vm_data.valid == 1 && executor->vm_data.linked == 1);
@@ -1572,6 +1653,7 @@ _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation)
         }
         if (is_invalidation) {
             OPT_STAT_INC(executors_invalidated);
+            LITE_STAT_INC(executors_invalidated);
         }
     }
 }
@@ -1603,7 +1685,7 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
     }
     for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
         PyObject *exec = PyList_GET_ITEM(invalidate, i);
-        executor_clear(exec);
+        executor_invalidate(exec, _Py_EXECUTOR_INVALIDATED_COLD);
     }
     Py_DECREF(invalidate);
     return;
@@ -1732,6 +1814,158 @@ _PyDumpExecutors(FILE *out)
     return 0;
 }
 
+static const char *const invalidation_reason_names[] = {
+    [_Py_EXECUTOR_FREED] = "freed",
+    [_Py_EXECUTOR_INVALIDATED_DICT] = "dict",
+    [_Py_EXECUTOR_INVALIDATED_TYPE] = "type",
+    [_Py_EXECUTOR_INVALIDATED_CODE] = "code",
+    [_Py_EXECUTOR_INVALIDATED_OTHER] = "other",
+    [_Py_EXECUTOR_INVALIDATED_ALL] = "all",
+    [_Py_EXECUTOR_INVALIDATED_COLD] = "cold",
+    [_Py_EXECUTOR_CLEARED] = "cleared",
+};
+
+static_assert(Py_ARRAY_LENGTH(invalidation_reason_names)
+              == _Py_EXECUTOR_INVALIDATION_REASONS,
+              "missing executor invalidation reason name");
+
+static PyObject *
+exits_to_list(_PyExecutorObject *executor)
+{
+    PyObject *exits = PyList_New(executor->exit_count);
+    if (exits == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < executor->exit_count; i++) {
+        _PyExitData *exit = &executor->exits[i];
+        PyObject *item = Py_BuildValue(
+            "{sIsisO}",
+            "target", exit->target,
+            "temperature", exit->temperature.value_and_backoff >> BACKOFF_BITS,
+            "linked", exit->executor != NULL ? Py_True : Py_False);
+        if (item == NULL) {
+            Py_DECREF(exits);
+            return NULL;
+        }
+        PyList_SET_ITEM(exits, i, item);
+    }
+    return exits;
+}
+
+static PyObject *
+executor_to_dict(_PyExecutorObject *executor, int offset)
+{
+    PyObject *uops = PyList_New(executor->code_size);
+    if (uops == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < executor->code_size; i++) {
+        PyObject *uop = uop_item((PyObject *)executor, i);
+        if (uop == NULL) {
+            Py_DECREF(uops);
+            return NULL;
+        }
+        PyList_SET_ITEM(uops, i, uop);
+    }
+    PyObject *exits = exits_to_list(executor);
+    if (exits == NULL) {
+        Py_DECREF(uops);
+        return NULL;
+    }
+    PyObject *reason = Py_None;
+    if (!executor->vm_data.valid) {
+        reason = PyUnicode_FromString(
+            invalidation_reason_names[executor->vm_data.invalidation_reason]);
+        if (reason == NULL) {
+            Py_DECREF(uops);
+            Py_DECREF(exits);
+            return NULL;
+        }
+    }
+    size_t jit_size = 0;
+#ifdef _Py_JIT
+    jit_size = executor->jit_size;
+#endif
+    PyObject *res = Py_BuildValue(
+        "{sisOsNsNsnsN}",
+        "offset", offset,
+        "valid", executor->vm_data.valid ? Py_True : Py_False,
+        "uops", uops,
+        "exits", exits,
+        "jit_size", (Py_ssize_t)jit_size,
+        "invalidation_reason", reason);
+    return res;
+}
+
+/* Return a list of dicts describing the executors attached to code. */
+PyObject *
+_Py_GetExecutorsInfo(PyCodeObject *code)
+{
+    // Take strong references to the executors first: creating the dicts
+    // can run the GC, which can clear the executors of the code object.
+    Py_ssize_t count = 0;
+    Py_ssize_t size = code->co_executors != NULL ? code->co_executors->size : 0;
+    _PyExecutorObject **executors = PyMem_New(_PyExecutorObject *, size);
+    int *offsets = PyMem_New(int, size);
+    if (size && (executors == NULL || offsets == NULL)) {
+        PyMem_Free(executors);
+        PyMem_Free(offsets);
+        return PyErr_NoMemory();
+    }
+    Py_BEGIN_CRITICAL_SECTION(code);
+    int code_len = (int)Py_SIZE(code);
+    for (int i = 0; i < code_len && count < size;) {
+        _Py_CODEUNIT *instr = &_PyCode_CODE(code)[i];
+        if (instr->op.code == ENTER_EXECUTOR) {
+            executors[count] = code->co_executors->executors[instr->op.arg];
+            offsets[count] = i * (int)sizeof(_Py_CODEUNIT);
+            Py_INCREF(executors[count]);
+            count++;
+        }
+        i += _PyInstruction_GetLength(code, i);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    PyObject *res = PyList_New(0);
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (res != NULL) {
+            PyObject *item = executor_to_dict(executors[i], offsets[i]);
+            if (item == NULL || PyList_Append(res, item) < 0) {
+                Py_CLEAR(res);
+            }
+            Py_XDECREF(item);
+        }
+        Py_DECREF(executors[i]);
+    }
+    PyMem_Free(executors);
+    PyMem_Free(offsets);
+    return res;
+}
+
+/* Return a dict mapping invalidation reasons to the number of executors
+ * of interp that stopped being valid for that reason. */
+PyObject *
+_Py_GetExecutorInvalidations(PyInterpreterState *interp)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _Py_EXECUTOR_INVALIDATION_REASONS; i++) {
+        PyObject *count = PyLong_FromUnsignedLongLong(
+            interp->executor_invalidations[i]);
+        if (count == NULL ||
+            PyDict_SetItemString(res, invalidation_reason_names[i], count) < 0)
+        {
+            Py_XDECREF(count);
+            Py_DECREF(res);
+            return NULL;
+        }
+        Py_DECREF(count);
+    }
+    return res;
+}
+
 #else
 
 int
@@ -1741,4 +1975,16 @@ _PyDumpExecutors(FILE *out)
     return -1;
 }
 
+PyObject *
+_Py_GetExecutorsInfo(PyCodeObject *code)
+{
+    return PyList_New(0);
+}
+
+PyObject *
+_Py_GetExecutorInvalidations(PyInterpreterState *interp)
+{
+    return PyDict_New();
+}
+
 #endif /* _Py_TIER2 */
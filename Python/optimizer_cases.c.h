@@ -976,6 +976,12 @@
             break;
         }
 
+        case _STORE_SUBSCR_PY_SETITEM: {
+            stack_pointer += -3;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _DELETE_SUBSCR: {
             stack_pointer += -2;
             assert(WITHIN_STACK_BOUNDS());
@@ -2616,6 +2622,24 @@
             break;
         }
 
+        case _CALL_KW_BUILTIN_FAST_WITH_KEYWORDS: {
+            JitOptRef res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS: {
+            JitOptRef res;
+            res = sym_new_not_null(ctx);
+            stack_pointer[-3 - oparg] = res;
+            stack_pointer += -2 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _MAKE_CALLARGS_A_TUPLE: {
             break;
         }
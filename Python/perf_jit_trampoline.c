@@ -1013,74 +1013,12 @@ static void* perf_map_jit_init(void) {
 // =============================================================================
 
 /*
- * Write a complete jitdump entry for a Python function
- *
- * This is the main function called by Python's trampoline system whenever
- * a new piece of JIT-compiled code needs to be recorded. It writes both
- * the unwinding information and the code load event to the jitdump file.
+ * Write the unwinding information of a trampoline of code_size bytes
  *
- * The function performs these steps:
- * 1. Initialize jitdump system if not already done
- * 2. Extract function name and filename from Python code object
- * 3. Generate DWARF unwinding information
- * 4. Write unwinding info event to jitdump file
- * 5. Write code load event to jitdump file
- *
- * Args:
- *   state: Jitdump state (currently unused, uses global state)
- *   code_addr: Address where the compiled code resides
- *   code_size: Size of the compiled code in bytes
- *   co: Python code object containing metadata
- *
- * IMPORTANT: This function signature is part of Python's internal API
- * and must not be changed without coordinating with core Python development.
+ * It must be written before the code load event of the trampoline.
  */
-static void perf_map_jit_write_entry(void *state, const void *code_addr,
-                                    unsigned int code_size, PyCodeObject *co)
+static void perf_map_jit_write_unwind_info(unsigned int code_size)
 {
-    /* Initialize jitdump system on first use */
-    if (perf_jit_map_state.perf_map == NULL) {
-        void* ret = perf_map_jit_init();
-        if(ret == NULL){
-            return;  // Initialization failed, silently abort
-        }
-    }
-
-    /*
-     * Extract function information from Python code object
-     *
-     * We create a human-readable function name by combining the qualified
-     * name (includes class/module context) with the filename. This helps
-     * developers identify functions in perf reports.
-     */
-    const char *entry = "";
-    if (co->co_qualname != NULL) {
-        entry = PyUnicode_AsUTF8(co->co_qualname);
-    }
-
-    const char *filename = "";
-    if (co->co_filename != NULL) {
-        filename = PyUnicode_AsUTF8(co->co_filename);
-    }
-
-    /*
-     * Create formatted function name for perf display
-     *
-     * Format: "py::<function_name>:<filename>"
-     * The "py::" prefix helps identify Python functions in mixed-language
-     * profiles (e.g., when profiling C extensions alongside Python code).
-     */
-    size_t perf_map_entry_size = snprintf(NULL, 0, "py::%s:%s", entry, filename) + 1;
-    char* perf_map_entry = (char*) PyMem_RawMalloc(perf_map_entry_size);
-    if (perf_map_entry == NULL) {
-        return;  // Memory allocation failed
-    }
-    snprintf(perf_map_entry, perf_map_entry_size, "py::%s:%s", entry, filename);
-
-    const size_t name_length = strlen(perf_map_entry);
-    uword base = (uword)code_addr;
-    uword size = code_size;
-
     /*
      * Generate DWARF unwinding information
      *
@@ -1151,6 +1089,18 @@ static void perf_map_jit_write_entry(void *state, const void *code_addr,
     /* Write padding to maintain alignment */
     char padding_bytes[] = "\0\0\0\0\0\0\0\0";
     perf_map_jit_write_fully(&padding_bytes, padding_size);
+}
+
+/*
+ * Write the code load event of a code region named perf_map_entry
+ */
+static void perf_map_jit_write_code_load(const void *code_addr,
+                                         unsigned int code_size,
+                                         const char *perf_map_entry)
+{
+    const size_t name_length = strlen(perf_map_entry);
+    uword base = (uword)code_addr;
+    uword size = code_size;
 
     /*
      * Write Code Load Event
@@ -1179,11 +1129,100 @@ static void perf_map_jit_write_entry(void *state, const void *code_addr,
     perf_map_jit_write_fully(&ev, sizeof(ev));
     perf_map_jit_write_fully(perf_map_entry, name_length+1);  // Include null terminator
     perf_map_jit_write_fully((void*)(base), size);           // Copy actual machine code
+}
+
+/*
+ * Write a complete jitdump entry for a Python function
+ *
+ * This is the main function called by Python's trampoline system whenever
+ * a new piece of JIT-compiled code needs to be recorded. It writes both
+ * the unwinding information and the code load event to the jitdump file.
+ *
+ * The function performs these steps:
+ * 1. Initialize jitdump system if not already done
+ * 2. Extract function name and filename from Python code object
+ * 3. Generate DWARF unwinding information
+ * 4. Write unwinding info event to jitdump file
+ * 5. Write code load event to jitdump file
+ *
+ * Args:
+ *   state: Jitdump state (currently unused, uses global state)
+ *   code_addr: Address where the compiled code resides
+ *   code_size: Size of the compiled code in bytes
+ *   co: Python code object containing metadata
+ *
+ * IMPORTANT: This function signature is part of Python's internal API
+ * and must not be changed without coordinating with core Python development.
+ */
+static void perf_map_jit_write_entry(void *state, const void *code_addr,
+                                    unsigned int code_size, PyCodeObject *co)
+{
+    /* Initialize jitdump system on first use */
+    if (perf_jit_map_state.perf_map == NULL) {
+        void* ret = perf_map_jit_init();
+        if(ret == NULL){
+            return;  // Initialization failed, silently abort
+        }
+    }
+
+    /*
+     * Extract function information from Python code object
+     *
+     * We create a human-readable function name by combining the qualified
+     * name (includes class/module context) with the filename. This helps
+     * developers identify functions in perf reports.
+     */
+    const char *entry = "";
+    if (co->co_qualname != NULL) {
+        entry = PyUnicode_AsUTF8(co->co_qualname);
+    }
+
+    const char *filename = "";
+    if (co->co_filename != NULL) {
+        filename = PyUnicode_AsUTF8(co->co_filename);
+    }
+
+    /*
+     * Create formatted function name for perf display
+     *
+     * Format: "py::<function_name>:<filename>"
+     * The "py::" prefix helps identify Python functions in mixed-language
+     * profiles (e.g., when profiling C extensions alongside Python code).
+     */
+    size_t perf_map_entry_size = snprintf(NULL, 0, "py::%s:%s", entry, filename) + 1;
+    char* perf_map_entry = (char*) PyMem_RawMalloc(perf_map_entry_size);
+    if (perf_map_entry == NULL) {
+        return;  // Memory allocation failed
+    }
+    snprintf(perf_map_entry, perf_map_entry_size, "py::%s:%s", entry, filename);
+
+    perf_map_jit_write_unwind_info(code_size);
+    perf_map_jit_write_code_load(code_addr, code_size, perf_map_entry);
 
     /* Clean up allocated memory */
     PyMem_RawFree(perf_map_entry);
 }
 
+/*
+ * Write a jitdump entry for code which is not a trampoline
+ *
+ * Used for the machine code of the JIT executors (Python/jit.c). No
+ * unwinding information is written: the DWARF data of the trampoline does
+ * not describe this code, and the stencils of the JIT are compiled without
+ * unwind tables.
+ */
+void _PyPerfJit_WriteNamedEntry(const void *code_addr, unsigned int code_size,
+                                const char *name)
+{
+    if (perf_jit_map_state.perf_map == NULL) {
+        void* ret = perf_map_jit_init();
+        if(ret == NULL){
+            return;
+        }
+    }
+    perf_map_jit_write_code_load(code_addr, code_size, name);
+}
+
 // =============================================================================
 //                              CLEANUP AND FINALIZATION
 // =============================================================================
@@ -439,6 +439,25 @@ _PyIsPerfTrampolineActive(void)
     return 0;
 }
 
+void
+_PyPerfTrampoline_WriteNamedEntry(const void *code_addr,
+                                  unsigned int code_size, const char *name)
+{
+#ifdef PY_HAVE_PERF_TRAMPOLINE
+    if (perf_status != PERF_STATUS_OK) {
+        return;
+    }
+    // Custom callbacks only know about trampolines of code objects
+    if (trampoline_api.write_state == _Py_perfmap_callbacks.write_state) {
+        PyUnstable_WritePerfMapEntry(code_addr, code_size, name);
+    }
+    else if (trampoline_api.write_state ==
+             _Py_perfmap_jit_callbacks.write_state) {
+        _PyPerfJit_WriteNamedEntry(code_addr, code_size, name);
+    }
+#endif
+}
+
 void
 _PyPerfTrampoline_GetCallbacks(_PyPerf_Callbacks *callbacks)
 {
@@ -6,6 +6,10 @@
    Measurements with standard library modules suggest the average
    allocation is about 20 bytes and that most compilers use a single
    block.
+
+   Blocks are not kept for reuse by the next arena: parsing a large module
+   uses a few hundred of them, and their malloc() and free() calls do not
+   show up next to the cost of parsing and building the AST.
 */
 
 #define DEFAULT_BLOCK_SIZE 8192
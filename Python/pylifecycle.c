@@ -27,6 +27,7 @@
 #include "pycore_runtime_init.h"  // _PyRuntimeState_INIT
 #include "pycore_setobject.h"     // _PySet_NextEntry()
 #include "pycore_sysmodule.h"     // _PySys_ClearAttrString()
+#include "pycore_time.h"          // _PyTime_AsMicroseconds()
 #include "pycore_traceback.h"     // _Py_DumpTracebackThreads()
 #include "pycore_typeobject.h"    // _PyTypes_InitTypes()
 #include "pycore_typevarobject.h" // _Py_clear_generic_types()
@@ -439,6 +440,31 @@ interpreter_update_config(PyThreadState *tstate, int only_update_path_config)
 
 */
 
+/* -X startuptime: print how long each initialization phase of the main
+   interpreter takes, one "startup time: <us> | <phase>" line per phase,
+   in the same spirit as -X importtime. */
+
+static int
+startup_time_enabled(const PyConfig *config)
+{
+    return _Py_get_xoption(&config->xoptions, L"startuptime") != NULL;
+}
+
+static void
+startup_time_report(int enabled, const char *phase, PyTime_t *t)
+{
+    if (!enabled) {
+        return;
+    }
+    PyTime_t now;
+    // ignore error: don't block startup if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&now);
+    fprintf(stderr, "startup time: %10ld | %s\n",
+            (long)_PyTime_AsMicroseconds(now - *t, _PyTime_ROUND_CEILING),
+            phase);
+    *t = now;
+}
+
 static PyStatus
 pyinit_core_reconfigure(_PyRuntimeState *runtime,
                         PyThreadState **tstate_p,
@@ -706,6 +732,11 @@ pycore_init_types(PyInterpreterState *interp)
 {
     PyStatus status;
 
+    status = _PyType_InitCacheSize(interp);
+    if (_PyStatus_EXCEPTION(status)) {
+        return status;
+    }
+
     status = _PyTypes_InitTypes(interp);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
@@ -934,6 +965,12 @@ pyinit_config(_PyRuntimeState *runtime,
               PyThreadState **tstate_p,
               const PyConfig *config)
 {
+    int startup_time = startup_time_enabled(config);
+    PyTime_t t = 0;
+    if (startup_time) {
+        (void)PyTime_PerfCounterRaw(&t);
+    }
+
     PyStatus status = pycore_init_runtime(runtime, config);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
@@ -945,11 +982,13 @@ pyinit_config(_PyRuntimeState *runtime,
         return status;
     }
     *tstate_p = tstate;
+    startup_time_report(startup_time, "runtime", &t);
 
     status = pycore_interp_init(tstate);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
     }
+    startup_time_report(startup_time, "core", &t);
 
     /* Only when we get here is the runtime core fully initialized */
     runtime->core_initialized = 1;
@@ -1093,6 +1132,9 @@ pyinit_core(_PyRuntimeState *runtime,
         return status;
     }
 
+    PyTime_t t;
+    (void)PyTime_PerfCounterRaw(&t);
+
     PyConfig config;
     PyConfig_InitPythonConfig(&config);
 
@@ -1107,6 +1149,7 @@ pyinit_core(_PyRuntimeState *runtime,
     if (_PyStatus_EXCEPTION(status)) {
         goto done;
     }
+    startup_time_report(startup_time_enabled(&config), "config", &t);
 
     if (!runtime->core_initialized) {
         status = pyinit_config(runtime, tstate_p, &config);
@@ -1190,6 +1233,12 @@ init_interp_main(PyThreadState *tstate)
         return _PyStatus_OK();
     }
 
+    int startup_time = is_main_interp && startup_time_enabled(config);
+    PyTime_t t = 0;
+    if (startup_time) {
+        (void)PyTime_PerfCounterRaw(&t);
+    }
+
     // Initialize the import-related configuration.
     status = _PyConfig_InitImportConfig(&interp->config);
     if (_PyStatus_EXCEPTION(status)) {
@@ -1199,11 +1248,13 @@ init_interp_main(PyThreadState *tstate)
     if (interpreter_update_config(tstate, 1) < 0) {
         return _PyStatus_ERR("failed to update the Python config");
     }
+    startup_time_report(startup_time, "path config", &t);
 
     status = _PyImport_InitExternal(tstate);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
     }
+    startup_time_report(startup_time, "importlib", &t);
 
     if (is_main_interp) {
         /* initialize the faulthandler module */
@@ -1217,6 +1268,7 @@ init_interp_main(PyThreadState *tstate)
     if (_PyStatus_EXCEPTION(status)) {
         return status;
     }
+    startup_time_report(startup_time, "encodings", &t);
 
     if (is_main_interp) {
         if (_PySignal_Init(config->install_signal_handlers) < 0) {
@@ -1224,7 +1276,7 @@ init_interp_main(PyThreadState *tstate)
         }
 
         if (config->tracemalloc) {
-           if (_PyTraceMalloc_Start(config->tracemalloc) < 0) {
+           if (_PyTraceMalloc_Start(config->tracemalloc, 0) < 0) {
                 return _PyStatus_ERR("can't start tracemalloc");
             }
         }
@@ -1271,6 +1323,8 @@ init_interp_main(PyThreadState *tstate)
     }
 #endif
 
+    startup_time_report(startup_time, "sys streams", &t);
+
 #ifdef Py_DEBUG
     run_presite(tstate);
 #endif
@@ -1301,11 +1355,14 @@ init_interp_main(PyThreadState *tstate)
         interp->runtime->initialized = 1;
     }
 
+    startup_time_report(startup_time, "main module", &t);
+
     if (config->site_import) {
         status = init_import_site();
         if (_PyStatus_EXCEPTION(status)) {
             return status;
         }
+        startup_time_report(startup_time, "site", &t);
     }
 
     if (is_main_interp) {
@@ -24,6 +24,7 @@
 #include "pycore_stackref.h"      // Py_STACKREF_DEBUG
 #include "pycore_time.h"          // _PyTime_Init()
 #include "pycore_uniqueid.h"      // _PyObject_FinalizePerThreadRefcounts()
+#include "pydtrace.h"             // PyDTrace_THREAD_ATTACH()
 
 
 /* --------------------------------------------------------------------------
@@ -945,6 +946,9 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
 
     _PyObject_FiniState(interp);
 
+    PyMem_RawFree(interp->lite_stats);
+    interp->lite_stats = NULL;
+
     free_interpreter(interp);
 }
 
@@ -1398,6 +1402,8 @@ static void
 free_threadstate(_PyThreadStateImpl *tstate)
 {
     PyInterpreterState *interp = tstate->base.interp;
+    PyMem_RawFree(tstate->lite_stats);
+    tstate->lite_stats = NULL;
     // The initial thread state of the interpreter is allocated
     // as part of the interpreter state so should not be freed.
     if (tstate == &interp->_initial_thread) {
@@ -1772,6 +1778,12 @@ tstate_delete_common(PyThreadState *tstate, int release_gil)
     assert(tstate_impl->refcounts.values == NULL);
 #endif
 
+    _PyThreadStateImpl *impl = (_PyThreadStateImpl *)tstate;
+    if (impl->lite_stats != NULL) {
+        _Py_LiteStats_Merge(interp, impl->lite_stats);
+        impl->lite_stats = NULL;
+    }
+
     HEAD_UNLOCK(runtime);
 
     // XXX Unbind in PyThreadState_Clear(), or earlier
@@ -2108,6 +2120,10 @@ _PyThreadState_Attach(PyThreadState *tstate)
         _PyCriticalSection_Resume(tstate);
     }
 
+    if (PyDTrace_THREAD_ATTACH_ENABLED()) {
+        PyDTrace_THREAD_ATTACH(tstate->thread_id);
+    }
+
 #if defined(Py_DEBUG)
     errno = err;
 #endif
@@ -2119,6 +2135,9 @@ detach_thread(PyThreadState *tstate, int detached_state)
     // XXX assert(tstate_is_alive(tstate) && tstate_is_bound(tstate));
     assert(_Py_atomic_load_int_relaxed(&tstate->state) == _Py_THREAD_ATTACHED);
     assert(tstate == current_fast_get());
+    if (PyDTrace_THREAD_DETACH_ENABLED()) {
+        PyDTrace_THREAD_DETACH(tstate->thread_id);
+    }
     if (tstate->critical_section != 0) {
         _PyCriticalSection_SuspendAll(tstate);
     }
@@ -111,6 +111,18 @@ get_page_size(void) {
 }
 
 
+// Number of remote pages kept by _Py_RemoteDebug_PagedReadRemoteMemory(),
+// must be a power of two
+#define MAX_PAGES 1024
+
+typedef struct {
+    uintptr_t page_addr;
+    // The entry is valid if it is equal to the page_cache_generation of
+    // the handle
+    uint64_t generation;
+    char *data;
+} page_cache_entry_t;
+
 // Define a platform-independent process handle structure
 typedef struct {
     pid_t pid;
@@ -122,6 +134,10 @@ typedef struct {
     int memfd;
 #endif
     Py_ssize_t page_size;
+    // Pages read since the last _Py_RemoteDebug_ClearCache() call, indexed
+    // by the page number modulo MAX_PAGES.
+    page_cache_entry_t page_cache[MAX_PAGES];
+    uint64_t page_cache_generation;
 } proc_handle_t;
 
 
@@ -133,6 +149,11 @@ static mach_port_t pid_to_task(pid_t pid);
 static int
 _Py_RemoteDebug_InitProcHandle(proc_handle_t *handle, pid_t pid) {
     handle->pid = pid;
+    for (int i = 0; i < MAX_PAGES; i++) {
+        handle->page_cache[i].data = NULL;
+        handle->page_cache[i].generation = 0;
+    }
+    handle->page_cache_generation = 1;
 #if defined(__APPLE__) && defined(TARGET_OS_OSX) && TARGET_OS_OSX
     handle->task = pid_to_task(handle->pid);
     if (handle->task == 0) {
@@ -155,6 +176,13 @@ _Py_RemoteDebug_InitProcHandle(proc_handle_t *handle, pid_t pid) {
     return 0;
 }
 
+// Forget the cached pages: the remote process may have changed them
+UNUSED static void
+_Py_RemoteDebug_ClearCache(proc_handle_t *handle)
+{
+    handle->page_cache_generation++;
+}
+
 // Clean up the process handle
 static void
 _Py_RemoteDebug_CleanupProcHandle(proc_handle_t *handle) {
@@ -169,6 +197,11 @@ _Py_RemoteDebug_CleanupProcHandle(proc_handle_t *handle) {
         handle->memfd = -1;
     }
 #endif
+    for (int i = 0; i < MAX_PAGES; i++) {
+        PyMem_RawFree(handle->page_cache[i].data);
+        handle->page_cache[i].data = NULL;
+    }
+    handle->page_cache_generation++;
     handle->pid = 0;
 }
 
@@ -1029,12 +1062,52 @@ _Py_RemoteDebug_ReadRemoteMemory(proc_handle_t *handle, uintptr_t remote_address
 #endif
 }
 
+// Like _Py_RemoteDebug_ReadRemoteMemory(), but reads whole pages and keeps
+// them until the next _Py_RemoteDebug_ClearCache() call.  Walking a stack
+// does many small reads of the same thread states, frames and objects;
+// this turns most of them into a memcpy() instead of a system call.  The
+// cache is direct-mapped: a page replaces the one with the same index, so
+// walks touching more than MAX_PAGES pages (like large task graphs) keep
+// caching the pages they are currently reading.
 UNUSED static int
 _Py_RemoteDebug_PagedReadRemoteMemory(proc_handle_t *handle,
                                       uintptr_t addr,
                                       size_t size,
                                       void *out)
 {
+    size_t page_size = (size_t)handle->page_size;
+    uintptr_t page_base = addr & ~(uintptr_t)(page_size - 1);
+    size_t offset_in_page = addr - page_base;
+
+    if (offset_in_page + size > page_size) {
+        return _Py_RemoteDebug_ReadRemoteMemory(handle, addr, size, out);
+    }
+
+    page_cache_entry_t *entry =
+        &handle->page_cache[(page_base / page_size) & (MAX_PAGES - 1)];
+    if (entry->generation == handle->page_cache_generation &&
+        entry->page_addr == page_base)
+    {
+        memcpy(out, entry->data + offset_in_page, size);
+        return 0;
+    }
+
+    if (entry->data == NULL) {
+        entry->data = PyMem_RawMalloc(page_size);
+    }
+    if (entry->data != NULL &&
+        _Py_RemoteDebug_ReadRemoteMemory(handle, page_base, page_size,
+                                         entry->data) == 0)
+    {
+        entry->page_addr = page_base;
+        entry->generation = handle->page_cache_generation;
+        memcpy(out, entry->data + offset_in_page, size);
+        return 0;
+    }
+    // The whole page could not be read (or copied): fall back to reading
+    // just the requested bytes.
+    entry->generation = 0;
+    PyErr_Clear();
     return _Py_RemoteDebug_ReadRemoteMemory(handle, addr, size, out);
 }
 
@@ -6,6 +6,7 @@
 #include "pycore_critical_section.h"
 #include "pycore_descrobject.h"   // _PyMethodWrapper_Type
 #include "pycore_dict.h"          // DICT_KEYS_UNICODE
+#include "pycore_freelist.h"      // _Py_freelists_GET()
 #include "pycore_function.h"      // _PyFunction_GetVersionForCurrentState()
 #include "pycore_interpframe.h"   // FRAME_SPECIALS_SIZE
 #include "pycore_list.h"          // _PyListIterObject
@@ -17,7 +18,10 @@
 #include "pycore_uop_ids.h"       // MAX_UOP_ID
 #include "pycore_opcode_utils.h"  // RESUME_AT_FUNC_START
 #include "pycore_pylifecycle.h"   // _PyOS_URandomNonblock()
+#include "pycore_pystats.h"       // _Py_LiteStatsOn()
+#include "pycore_pystate.h"       // HEAD_LOCK()
 #include "pycore_runtime.h"       // _Py_ID()
+#include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_unicodeobject.h" // _PyUnicodeASCIIIter_Type
 
 #include <stdlib.h> // rand()
@@ -227,6 +231,8 @@ print_object_stats(FILE *out, ObjectStats *stats)
     fprintf(out, "Object method cache collisions: %" PRIu64 "\n", stats->type_cache_collisions);
     fprintf(out, "Object method cache dunder hits: %" PRIu64 "\n", stats->type_cache_dunder_hits);
     fprintf(out, "Object method cache dunder misses: %" PRIu64 "\n", stats->type_cache_dunder_misses);
+    fprintf(out, "Object refcount merges queued: %" PRIu64 "\n", stats->brc_queued);
+    fprintf(out, "Object frees deferred by QSBR: %" PRIu64 "\n", stats->qsbr_deferred);
 }
 
 static void
@@ -337,6 +343,26 @@ print_rare_event_stats(FILE *out, RareEventStats *stats)
     fprintf(out, "Rare event (watched_globals_modification): %" PRIu64 "\n", stats->watched_globals_modification);
 }
 
+static void
+print_lock_stats(FILE *out, LockStats *stats)
+{
+    fprintf(out, "Lock stats (slow_path): %" PRIu64 "\n", stats->slow_path);
+    fprintf(out, "Lock stats (spins): %" PRIu64 "\n", stats->spins);
+    fprintf(out, "Lock stats (parks): %" PRIu64 "\n", stats->parks);
+    fprintf(out, "Lock stats (handoffs): %" PRIu64 "\n", stats->handoffs);
+    fprintf(out, "Lock stats (park_ns): %" PRIu64 "\n", stats->park_ns);
+}
+
+static void
+print_gil_stats(FILE *out, GILStats *stats)
+{
+    fprintf(out, "GIL stats (contended): %" PRIu64 "\n", stats->contended);
+    fprintf(out, "GIL stats (wait_ns): %" PRIu64 "\n", stats->wait_ns);
+    fprintf(out, "GIL stats (drop_requests): %" PRIu64 "\n", stats->drop_requests);
+    fprintf(out, "GIL stats (switches): %" PRIu64 "\n", stats->switches);
+    fprintf(out, "GIL stats (forced_switches): %" PRIu64 "\n", stats->forced_switches);
+}
+
 static void
 print_stats(FILE *out, PyStats *stats)
 {
@@ -348,6 +374,8 @@ print_stats(FILE *out, PyStats *stats)
     print_optimization_stats(out, &stats->optimization_stats);
 #endif
     print_rare_event_stats(out, &stats->rare_event_stats);
+    print_lock_stats(out, &stats->lock_stats);
+    print_gil_stats(out, &stats->gil_stats);
 }
 
 void
@@ -438,21 +466,369 @@ _Py_PrintSpecializationStats(int to_file)
     return 1;
 }
 
+#if _Py_LITE_STATS_FAILURE_KINDS != SPECIALIZATION_FAILURE_KINDS
+#error "_Py_LITE_STATS_FAILURE_KINDS must be equal to SPECIALIZATION_FAILURE_KINDS"
+#endif
+
 #define SPECIALIZATION_FAIL(opcode, kind) \
 do { \
-    if (_Py_stats) { \
+    if (_Py_stats || LITE_STATS_ON()) { \
         int _kind = (kind); \
         assert(_kind < SPECIALIZATION_FAILURE_KINDS); \
-        _Py_stats->opcode_stats[opcode].specialization.failure_kinds[_kind]++; \
+        if (_Py_stats) { \
+            _Py_stats->opcode_stats[opcode].specialization.failure_kinds[_kind]++; \
+        } \
+        if (LITE_STATS_ON()) { \
+            _Py_LiteStats_SpecializationFail((opcode), _kind); \
+        } \
+    } \
+} while (0)
+
+#else
+
+#define SPECIALIZATION_FAIL(opcode, kind) \
+do { \
+    if (LITE_STATS_ON()) { \
+        _Py_LiteStats_SpecializationFail((opcode), (kind)); \
     } \
 } while (0)
 
 #endif  // Py_STATS
 
 
-#ifndef SPECIALIZATION_FAIL
-#  define SPECIALIZATION_FAIL(opcode, kind) ((void)0)
-#endif
+/* Lightweight statistics, see pycore_stats.h */
+
+int _Py_lite_stats_on = 0;
+
+/* The families of instructions whose specialization failures are counted */
+static const uint8_t lite_stats_families[] = {
+    CONTAINS_OP,
+    LOAD_SUPER_ATTR,
+    LOAD_ATTR,
+    LOAD_GLOBAL,
+    STORE_SUBSCR,
+    STORE_ATTR,
+    JUMP_BACKWARD,
+    CALL,
+    CALL_KW,
+    BINARY_OP,
+    COMPARE_OP,
+    UNPACK_SEQUENCE,
+    FOR_ITER,
+    TO_BOOL,
+    SEND,
+};
+
+static_assert(Py_ARRAY_LENGTH(lite_stats_families) <= _Py_LITE_STATS_FAMILIES,
+              "increase _Py_LITE_STATS_FAMILIES");
+
+/* The names of the freelists of struct _Py_freelists, in order. Arrays of
+ * freelists (like the tuples freelists) are counted as a single freelist. */
+#define FREELIST_NAME(NAME) {#NAME, offsetof(struct _Py_freelists, NAME)}
+static const struct {
+    const char *name;
+    size_t offset;
+} lite_stats_freelists[] = {
+    FREELIST_NAME(floats),
+    FREELIST_NAME(complexes),
+    FREELIST_NAME(ints),
+    FREELIST_NAME(tuples),
+    FREELIST_NAME(lists),
+    FREELIST_NAME(list_iters),
+    FREELIST_NAME(tuple_iters),
+    FREELIST_NAME(dicts),
+    FREELIST_NAME(dictkeys),
+    FREELIST_NAME(slices),
+    FREELIST_NAME(ranges),
+    FREELIST_NAME(range_iters),
+    FREELIST_NAME(contexts),
+    FREELIST_NAME(async_gens),
+    FREELIST_NAME(async_gen_asends),
+    FREELIST_NAME(futureiters),
+    FREELIST_NAME(decimals),
+    FREELIST_NAME(object_stack_chunks),
+    FREELIST_NAME(unicode_writers),
+    FREELIST_NAME(pycfunctionobject),
+    FREELIST_NAME(pycmethodobject),
+    FREELIST_NAME(pymethodobjects),
+    FREELIST_NAME(cells),
+};
+#undef FREELIST_NAME
+
+void
+_Py_LiteStatsOn(void)
+{
+    FT_ATOMIC_STORE_INT_RELAXED(_Py_lite_stats_on, 1);
+}
+
+void
+_Py_LiteStatsOff(void)
+{
+    FT_ATOMIC_STORE_INT_RELAXED(_Py_lite_stats_on, 0);
+}
+
+void
+_Py_LiteStatsClear(void)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    // Other threads update their counters without atomics
+    _PyEval_StopTheWorld(interp);
+    HEAD_LOCK(interp->runtime);
+    if (interp->lite_stats != NULL) {
+        memset(interp->lite_stats, 0, sizeof(_PyLiteStats));
+    }
+    _Py_FOR_EACH_TSTATE_UNLOCKED(interp, p) {
+        _PyLiteStats *stats = ((_PyThreadStateImpl *)p)->lite_stats;
+        if (stats != NULL) {
+            memset(stats, 0, sizeof(_PyLiteStats));
+        }
+    }
+    HEAD_UNLOCK(interp->runtime);
+    _PyEval_StartTheWorld(interp);
+}
+
+_PyLiteStats *
+_Py_LiteStats_Get(void)
+{
+    _PyThreadStateImpl *tstate = (_PyThreadStateImpl *)_PyThreadState_GET();
+    if (tstate == NULL) {
+        return NULL;
+    }
+    if (tstate->lite_stats == NULL) {
+        tstate->lite_stats = PyMem_RawCalloc(1, sizeof(_PyLiteStats));
+    }
+    return tstate->lite_stats;
+}
+
+static void
+lite_stats_add(_PyLiteStats *dst, const _PyLiteStats *src)
+{
+    const uint64_t *s = (const uint64_t *)src;
+    uint64_t *d = (uint64_t *)dst;
+    for (size_t i = 0; i < sizeof(_PyLiteStats) / sizeof(uint64_t); i++) {
+        d[i] += s[i];
+    }
+}
+
+void
+_Py_LiteStats_Merge(PyInterpreterState *interp, _PyLiteStats *src)
+{
+    if (interp->lite_stats == NULL) {
+        interp->lite_stats = src;
+        return;
+    }
+    lite_stats_add(interp->lite_stats, src);
+    PyMem_RawFree(src);
+}
+
+void
+_Py_LiteStats_SpecializationFail(int opcode, int kind)
+{
+    if (kind < 0 || kind >= _Py_LITE_STATS_FAILURE_KINDS) {
+        return;
+    }
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(lite_stats_families); i++) {
+        if (lite_stats_families[i] == opcode) {
+            _PyLiteStats *stats = _Py_LiteStats_Get();
+            if (stats != NULL) {
+                stats->specialization_failures[i][kind]++;
+            }
+            return;
+        }
+    }
+}
+
+void
+_Py_LiteStats_FreeListMiss(struct _Py_freelist *fl)
+{
+    Py_ssize_t index = fl - (struct _Py_freelist *)_Py_freelists_GET();
+    if (index < 0 || (size_t)index >= _Py_LITE_STATS_FREELISTS) {
+        return;
+    }
+    _PyLiteStats *stats = _Py_LiteStats_Get();
+    if (stats != NULL) {
+        stats->freelist_misses[index]++;
+    }
+}
+
+static int
+lite_stats_set_count(PyObject *dict, const char *name, uint64_t count)
+{
+    PyObject *value = PyLong_FromUnsignedLongLong(count);
+    if (value == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItemString(dict, name, value);
+    Py_DECREF(value);
+    return err;
+}
+
+static int
+lite_stats_set_dict(PyObject *dict, const char *name, PyObject *value)
+{
+    if (value == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItemString(dict, name, value);
+    Py_DECREF(value);
+    return err;
+}
+
+static PyObject *
+lite_stats_deopts(_PyLiteStats *stats)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    for (int opcode = 0; opcode < 256; opcode++) {
+        uint64_t count = stats->deopts[opcode];
+        if (count && lite_stats_set_count(res, _PyOpcode_OpName[opcode], count) < 0) {
+            Py_DECREF(res);
+            return NULL;
+        }
+    }
+    return res;
+}
+
+static PyObject *
+lite_stats_failures(_PyLiteStats *stats)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(lite_stats_families); i++) {
+        PyObject *kinds = NULL;
+        for (int kind = 0; kind < _Py_LITE_STATS_FAILURE_KINDS; kind++) {
+            uint64_t count = stats->specialization_failures[i][kind];
+            if (count == 0) {
+                continue;
+            }
+            if (kinds == NULL) {
+                kinds = PyDict_New();
+                if (kinds == NULL) {
+                    goto error;
+                }
+                const char *name = _PyOpcode_OpName[lite_stats_families[i]];
+                if (PyDict_SetItemString(res, name, kinds) < 0) {
+                    Py_DECREF(kinds);
+                    goto error;
+                }
+                Py_DECREF(kinds);
+            }
+            PyObject *key = PyLong_FromLong(kind);
+            if (key == NULL) {
+                goto error;
+            }
+            PyObject *value = PyLong_FromUnsignedLongLong(count);
+            if (value == NULL) {
+                Py_DECREF(key);
+                goto error;
+            }
+            int err = PyDict_SetItem(kinds, key, value);
+            Py_DECREF(key);
+            Py_DECREF(value);
+            if (err < 0) {
+                goto error;
+            }
+        }
+    }
+    return res;
+
+error:
+    Py_DECREF(res);
+    return NULL;
+}
+
+static PyObject *
+lite_stats_freelists_dict(_PyLiteStats *stats)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    size_t n = Py_ARRAY_LENGTH(lite_stats_freelists);
+    for (size_t i = 0; i < n; i++) {
+        size_t start = lite_stats_freelists[i].offset / sizeof(struct _Py_freelist);
+        size_t end = (i + 1 < n
+                      ? lite_stats_freelists[i + 1].offset / sizeof(struct _Py_freelist)
+                      : _Py_LITE_STATS_FREELISTS);
+        uint64_t misses = 0;
+        for (size_t index = start; index < end; index++) {
+            misses += stats->freelist_misses[index];
+        }
+        if (misses && lite_stats_set_count(res, lite_stats_freelists[i].name,
+                                           misses) < 0)
+        {
+            goto error;
+        }
+    }
+    return res;
+
+error:
+    Py_DECREF(res);
+    return NULL;
+}
+
+static PyObject *
+lite_stats_type_cache(_PyLiteStats *stats)
+{
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    if (lite_stats_set_count(res, "misses", stats->type_cache_misses) < 0 ||
+        lite_stats_set_count(res, "evictions", stats->type_cache_evictions) < 0)
+    {
+        Py_DECREF(res);
+        return NULL;
+    }
+    return res;
+}
+
+PyObject *
+_Py_GetLiteStats(void)
+{
+    // Sum the counters of the deleted and of the current thread states
+    _PyLiteStats *total = PyMem_RawCalloc(1, sizeof(_PyLiteStats));
+    if (total == NULL) {
+        return PyErr_NoMemory();
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    // Other threads update their counters without atomics
+    _PyEval_StopTheWorld(interp);
+    HEAD_LOCK(interp->runtime);
+    if (interp->lite_stats != NULL) {
+        lite_stats_add(total, interp->lite_stats);
+    }
+    _Py_FOR_EACH_TSTATE_UNLOCKED(interp, p) {
+        _PyLiteStats *stats = ((_PyThreadStateImpl *)p)->lite_stats;
+        if (stats != NULL) {
+            lite_stats_add(total, stats);
+        }
+    }
+    HEAD_UNLOCK(interp->runtime);
+    _PyEval_StartTheWorld(interp);
+
+    PyObject *res = PyDict_New();
+    if (res == NULL
+        || lite_stats_set_dict(res, "deopts", lite_stats_deopts(total)) < 0
+        || lite_stats_set_dict(res, "specialization_failures",
+                               lite_stats_failures(total)) < 0
+        || lite_stats_set_count(res, "executors_invalidated",
+                                total->executors_invalidated) < 0
+        || lite_stats_set_dict(res, "freelists",
+                               lite_stats_freelists_dict(total)) < 0
+        || lite_stats_set_dict(res, "type_cache",
+                               lite_stats_type_cache(total)) < 0)
+    {
+        Py_XDECREF(res);
+        res = NULL;
+    }
+    PyMem_RawFree(total);
+    return res;
+}
 
 // Initialize warmup counters and optimize instructions. This cannot fail.
 void
@@ -734,10 +1110,25 @@ load_counter(_Py_BackoffCounter *counter)
     return result;
 }
 
+// Count the deoptimization of a specialized instruction whose misses have
+// made it respecialize. This is done here rather than in the specialized
+// instructions so that the lite stats cost nothing on their fast path.
+static inline void
+lite_stats_deopt(_Py_CODEUNIT *instr)
+{
+    if (LITE_STATS_ON()) {
+        uint8_t opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code);
+        if (_PyOpcode_Deopt[opcode] != opcode) {
+            LITE_STAT_INC(deopts[opcode]);
+        }
+    }
+}
+
 static inline void
 specialize(_Py_CODEUNIT *instr, uint8_t specialized_opcode)
 {
     assert(!PyErr_Occurred());
+    lite_stats_deopt(instr);
     if (!set_opcode(instr, specialized_opcode)) {
         STAT_INC(_PyOpcode_Deopt[specialized_opcode], failure);
         SPECIALIZATION_FAIL(_PyOpcode_Deopt[specialized_opcode],
@@ -755,6 +1146,7 @@ unspecialize(_Py_CODEUNIT *instr)
     uint8_t opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code);
     uint8_t generic_opcode = _PyOpcode_Deopt[opcode];
     STAT_INC(generic_opcode, failure);
+    lite_stats_deopt(instr);
     if (!set_opcode(instr, generic_opcode)) {
         SPECIALIZATION_FAIL(generic_opcode, SPEC_FAIL_OTHER);
         return;
@@ -988,6 +1380,46 @@ analyze_descriptor_store(PyTypeObject *type, PyObject *name, PyObject **descr, u
     return classify_descriptor(descriptor, false);
 }
 
+/* If the instruction is being re-specialized because an instance of
+ * another type reached a LOAD_ATTR_INSTANCE_VALUE(_POLY), keep the most
+ * recently cached type around and use the two-entry polymorphic form.
+ * Returns 1 if the instruction was specialized. */
+static int
+specialize_load_attr_instance_value_poly(_Py_CODEUNIT *instr,
+                                         uint32_t tp_version, uint16_t offset)
+{
+    uint32_t prev_version;
+    uint16_t prev_offset;
+    uint8_t opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code);
+    if (opcode == LOAD_ATTR_INSTANCE_VALUE) {
+        _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+        prev_version = read_u32(cache->version);
+        prev_offset = cache->index;
+    }
+    else if (opcode == LOAD_ATTR_INSTANCE_VALUE_POLY) {
+        _PyAttrPolyCache *cache = (_PyAttrPolyCache *)(instr + 1);
+        uint32_t offsets = read_u32(cache->offsets);
+        prev_version = read_u32(cache->type_version);
+        prev_offset = (uint16_t)offsets;
+        if (prev_version == tp_version) {
+            prev_version = read_u32(cache->type_version2);
+            prev_offset = (uint16_t)(offsets >> 16);
+        }
+    }
+    else {
+        return 0;
+    }
+    if (prev_version == 0 || prev_version == tp_version) {
+        return 0;
+    }
+    _PyAttrPolyCache *cache = (_PyAttrPolyCache *)(instr + 1);
+    write_u32(cache->type_version, tp_version);
+    write_u32(cache->type_version2, prev_version);
+    write_u32(cache->offsets, (uint32_t)offset | ((uint32_t)prev_offset << 16));
+    specialize(instr, LOAD_ATTR_INSTANCE_VALUE_POLY);
+    return 1;
+}
+
 static int
 specialize_dict_access_inline(
     PyObject *owner, _Py_CODEUNIT *instr, PyTypeObject *type,
@@ -1012,6 +1444,12 @@ specialize_dict_access_inline(
         SPECIALIZATION_FAIL(base_op, SPEC_FAIL_OUT_OF_RANGE);
         return 0;
     }
+    if (values_op == LOAD_ATTR_INSTANCE_VALUE &&
+        specialize_load_attr_instance_value_poly(instr, tp_version,
+                                                 (uint16_t)offset))
+    {
+        return 1;
+    }
     cache->index = (uint16_t)offset;
     write_u32(cache->version, tp_version);
     specialize(instr, values_op);
@@ -1478,7 +1916,6 @@ _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *na
     return;
 }
 
-#ifdef Py_STATS
 static int
 load_attr_fail_kind(DescriptorClassification kind)
 {
@@ -1513,7 +1950,6 @@ load_attr_fail_kind(DescriptorClassification kind)
     }
     Py_UNREACHABLE();
 }
-#endif   // Py_STATS
 
 static int
 specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
@@ -1581,12 +2017,10 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
             }
             Py_XDECREF(descr);
             return 0;
-#ifdef Py_STATS
         case ABSENT:
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_EXPECTED_ERROR);
             Py_XDECREF(descr);
             return -1;
-#endif
         default:
             SPECIALIZATION_FAIL(LOAD_ATTR, load_attr_fail_kind(kind));
             Py_XDECREF(descr);
@@ -1832,7 +2266,6 @@ function_get_version(PyObject *o, int opcode)
     return version;
 }
 
-#ifdef Py_STATS
 static int
 store_subscr_fail_kind(PyObject *container, PyObject *sub)
 {
@@ -1895,7 +2328,6 @@ store_subscr_fail_kind(PyObject *container, PyObject *sub)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 Py_NO_INLINE void
 _Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_CODEUNIT *instr)
@@ -1934,6 +2366,19 @@ _Py_Specialize_StoreSubscr(_PyStackRef container_st, _PyStackRef sub_st, _Py_COD
         specialize(instr, STORE_SUBSCR_DICT);
         return;
     }
+    if (container_type->tp_flags & Py_TPFLAGS_HEAPTYPE) {
+        unsigned int tp_version;
+        PyObject *descriptor = _PyType_LookupRefAndVersion(container_type, &_Py_ID(__setitem__), &tp_version);
+        if (descriptor && Py_TYPE(descriptor) == &PyFunction_Type &&
+            _PyType_CacheSetItemForSpecialization((PyHeapTypeObject *)container_type,
+                                                  descriptor, (uint32_t)tp_version))
+        {
+            Py_DECREF(descriptor);
+            specialize(instr, STORE_SUBSCR_PY_SETITEM);
+            return;
+        }
+        Py_XDECREF(descriptor);
+    }
     SPECIALIZATION_FAIL(STORE_SUBSCR, store_subscr_fail_kind(container, sub));
     unspecialize(instr);
 }
@@ -2239,6 +2684,19 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
             fail = -1;
         }
     }
+    else if (PyCFunction_CheckExact(callable) &&
+             PyCFunction_GET_FLAGS(callable) == (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_BUILTIN_FAST_WITH_KEYWORDS);
+        fail = 0;
+    }
+    else if (Py_IS_TYPE(callable, &PyMethodDescr_Type) &&
+             ((PyMethodDescrObject *)callable)->d_method->ml_flags ==
+                (METH_FASTCALL | METH_KEYWORDS))
+    {
+        specialize(instr, CALL_KW_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS);
+        fail = 0;
+    }
     else {
         specialize(instr, CALL_KW_NON_PY);
         fail = 0;
@@ -2248,7 +2706,6 @@ _Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
     }
 }
 
-#ifdef Py_STATS
 static int
 binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
 {
@@ -2433,7 +2890,6 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
     }
     Py_UNREACHABLE();
 }
-#endif
 
 /** Binary Op Specialization Extensions */
 
@@ -2699,7 +3155,6 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
 }
 
 
-#ifdef Py_STATS
 static int
 compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
 {
@@ -2732,7 +3187,6 @@ compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 Py_NO_INLINE void
 _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *instr,
@@ -2783,7 +3237,6 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
     specialize(instr, specialized_op);
 }
 
-#ifdef Py_STATS
 static int
 unpack_sequence_fail_kind(PyObject *seq)
 {
@@ -2795,7 +3248,6 @@ unpack_sequence_fail_kind(PyObject *seq)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 Py_NO_INLINE void
 _Py_Specialize_UnpackSequence(_PyStackRef seq_st, _Py_CODEUNIT *instr, int oparg)
@@ -2831,7 +3283,6 @@ _Py_Specialize_UnpackSequence(_PyStackRef seq_st, _Py_CODEUNIT *instr, int oparg
     unspecialize(instr);
 }
 
-#ifdef Py_STATS
 int
  _PySpecialization_ClassifyIterator(PyObject *iter)
 {
@@ -2902,7 +3353,6 @@ int
     }
     return SPEC_FAIL_OTHER;
 }
-#endif   // Py_STATS
 
 Py_NO_INLINE void
 _Py_Specialize_ForIter(_PyStackRef iter, _PyStackRef null_or_index, _Py_CODEUNIT *instr, int oparg)
@@ -2986,7 +3436,6 @@ _Py_Specialize_Send(_PyStackRef receiver_st, _Py_CODEUNIT *instr)
     unspecialize(instr);
 }
 
-#ifdef Py_STATS
 static int
 to_bool_fail_kind(PyObject *value)
 {
@@ -3013,7 +3462,6 @@ to_bool_fail_kind(PyObject *value)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif  // Py_STATS
 
 static int
 check_type_always_true(PyTypeObject *ty)
@@ -3088,7 +3536,6 @@ _Py_Specialize_ToBool(_PyStackRef value_o, _Py_CODEUNIT *instr)
     specialize(instr, specialized_op);
 }
 
-#ifdef Py_STATS
 static int
 containsop_fail_kind(PyObject *value) {
     if (PyUnicode_CheckExact(value)) {
@@ -3105,7 +3552,6 @@ containsop_fail_kind(PyObject *value) {
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 Py_NO_INLINE void
 _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
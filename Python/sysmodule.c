@@ -2264,7 +2264,6 @@ sys_is_finalizing_impl(PyObject *module)
 }
 
 
-#ifdef Py_STATS
 /*[clinic input]
 sys._stats_on
 
@@ -2275,7 +2274,10 @@ static PyObject *
 sys__stats_on_impl(PyObject *module)
 /*[clinic end generated code: output=aca53eafcbb4d9fe input=43b5bfe145299e55]*/
 {
+#ifdef Py_STATS
     _Py_StatsOn();
+#endif
+    _Py_LiteStatsOn();
     Py_RETURN_NONE;
 }
 
@@ -2289,7 +2291,10 @@ static PyObject *
 sys__stats_off_impl(PyObject *module)
 /*[clinic end generated code: output=1534c1ee63812214 input=d1a84c60c56cbce2]*/
 {
+#ifdef Py_STATS
     _Py_StatsOff();
+#endif
+    _Py_LiteStatsOff();
     Py_RETURN_NONE;
 }
 
@@ -2303,10 +2308,30 @@ static PyObject *
 sys__stats_clear_impl(PyObject *module)
 /*[clinic end generated code: output=fb65a2525ee50604 input=3e03f2654f44da96]*/
 {
+#ifdef Py_STATS
     _Py_StatsClear();
+#endif
+    _Py_LiteStatsClear();
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+sys._stats_get
+
+Return the lightweight stats of the current interpreter as a dict.
+
+The stats are available in all builds. They are gathered between
+calls to sys._stats_on() and sys._stats_off().
+[clinic start generated code]*/
+
+static PyObject *
+sys__stats_get_impl(PyObject *module)
+/*[clinic end generated code: output=468db877178107cc input=5100ac8680810940]*/
+{
+    return _Py_GetLiteStats();
+}
+
+#ifdef Py_STATS
 /*[clinic input]
 sys._stats_dump -> bool
 
@@ -2830,10 +2855,11 @@ static PyMethodDef sys_methods[] = {
     SYS_GET_INT_MAX_STR_DIGITS_METHODDEF
     SYS_SET_INT_MAX_STR_DIGITS_METHODDEF
     SYS__BASEREPL_METHODDEF
-#ifdef Py_STATS
     SYS__STATS_ON_METHODDEF
     SYS__STATS_OFF_METHODDEF
     SYS__STATS_CLEAR_METHODDEF
+    SYS__STATS_GET_METHODDEF
+#ifdef Py_STATS
     SYS__STATS_DUMP_METHODDEF
 #endif
     SYS__GET_CPU_COUNT_CONFIG_METHODDEF
@@ -4055,10 +4081,41 @@ _jit_is_active_impl(PyObject *module)
     return _PyThreadState_GET()->current_executor != NULL;
 }
 
+/*[clinic input]
+_jit.get_executors
+
+    code: object(subclass_of="&PyCode_Type")
+    /
+
+Return a list of dicts describing the executors attached to a code object.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_executors_impl(PyObject *module, PyObject *code)
+/*[clinic end generated code: output=d08cfd816513260a input=f2823963528cfa7e]*/
+{
+    return _Py_GetExecutorsInfo((PyCodeObject *)code);
+}
+
+/*[clinic input]
+_jit.get_invalidations
+
+Return a dict mapping reasons to the number of executors that stopped being valid for that reason.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_invalidations_impl(PyObject *module)
+/*[clinic end generated code: output=90efced6a4729dbb input=2d5e5f8992cdb0f3]*/
+{
+    return _Py_GetExecutorInvalidations(_PyInterpreterState_GET());
+}
+
 static PyMethodDef _jit_methods[] = {
     _JIT_IS_AVAILABLE_METHODDEF
     _JIT_IS_ENABLED_METHODDEF
     _JIT_IS_ACTIVE_METHODDEF
+    _JIT_GET_EXECUTORS_METHODDEF
+    _JIT_GET_INVALIDATIONS_METHODDEF
     {NULL}
 };
 
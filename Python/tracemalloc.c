@@ -10,6 +10,7 @@
 #include "pycore_runtime.h"       // _Py_ID()
 #include "pycore_traceback.h"     // _Py_DumpASCII()
 
+#include <math.h>                 // log()
 #include <stdlib.h>               // malloc()
 
 #define tracemalloc_config _PyRuntime.tracemalloc.config
@@ -125,6 +126,69 @@ set_reentrant(int reentrant)
 }
 
 
+/* Sampling of allocations: with a sample rate of R bytes, the allocated
+   bytes are sampled by a Poisson process of mean R, as in the heap profilers
+   of Go and jemalloc. An allocation of size bytes is traced if it contains
+   at least one sampled byte, with probability p = 1 - exp(-size/R), and its
+   trace records the size divided by p. The sum of the sizes of the traces is
+   then an unbiased estimate of the size of the allocated memory.
+
+   The state of the process is per thread, so that allocations which are not
+   sampled take neither the GIL nor the tables lock. */
+static _Py_thread_local uint64_t tracemalloc_sample_rng = 0;
+static _Py_thread_local uint64_t tracemalloc_bytes_until_sample = 0;
+/* Sample rate of tracemalloc_bytes_until_sample */
+static _Py_thread_local size_t tracemalloc_thread_sample_rate = 0;
+
+static uint64_t
+sample_next_interval(size_t sample_rate)
+{
+    if (tracemalloc_sample_rng == 0) {
+        PyTime_t now = 0;
+        (void)PyTime_MonotonicRaw(&now);
+        tracemalloc_sample_rng = ((uint64_t)now
+                                  ^ (uint64_t)(uintptr_t)&tracemalloc_sample_rng);
+    }
+    /* splitmix64 */
+    uint64_t z = (tracemalloc_sample_rng += 0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    z ^= z >> 31;
+
+    /* u is uniform in (0; 1] */
+    double u = (double)((z >> 11) + 1) * (1.0 / 9007199254740992.0);
+    double interval = -log(u) * (double)sample_rate;
+    return interval < 1.0 ? 1 : (uint64_t)interval;
+}
+
+/* Return 1 if an allocation of *size bytes must be traced, and set *size to
+   the size to record. Return 0 if the allocation is not sampled. */
+static int
+tracemalloc_sample(size_t *size)
+{
+    size_t sample_rate = tracemalloc_config.sample_rate;
+    if (sample_rate == 0) {
+        return 1;
+    }
+    if (tracemalloc_thread_sample_rate != sample_rate) {
+        tracemalloc_thread_sample_rate = sample_rate;
+        tracemalloc_bytes_until_sample = sample_next_interval(sample_rate);
+    }
+    if ((uint64_t)*size < tracemalloc_bytes_until_sample) {
+        tracemalloc_bytes_until_sample -= *size;
+        return 0;
+    }
+    tracemalloc_bytes_until_sample = sample_next_interval(sample_rate);
+
+    double p = -expm1(-(double)*size / (double)sample_rate);
+    double scaled = (double)*size / p;
+    if (scaled < (double)(SIZE_MAX / 2)) {
+        *size = (size_t)(scaled + 0.5);
+    }
+    return 1;
+}
+
+
 static Py_uhash_t
 hashtable_hash_pyobject(const void *key)
 {
@@ -523,6 +587,10 @@ tracemalloc_alloc(int need_gil, int use_calloc,
     if (reentrant) {
         goto done;
     }
+    size_t size = nelem * elsize;
+    if (!tracemalloc_sample(&size)) {
+        goto done;
+    }
 
     PyGILState_STATE gil_state;
     if (need_gil) {
@@ -531,7 +599,7 @@ tracemalloc_alloc(int need_gil, int use_calloc,
     TABLES_LOCK();
 
     if (tracemalloc_config.tracing) {
-        if (ADD_TRACE(ptr, nelem * elsize) < 0) {
+        if (ADD_TRACE(ptr, size) < 0) {
             // Failed to allocate a trace for the new memory block
             alloc->free(alloc->ctx, ptr);
             ptr = NULL;
@@ -573,6 +641,11 @@ tracemalloc_realloc(int need_gil, void *ctx, void *ptr, size_t new_size)
     if (reentrant) {
         goto done;
     }
+    size_t size = new_size;
+    int sampled = tracemalloc_sample(&size);
+    if (!sampled && ptr == NULL) {
+        goto done;
+    }
 
     PyGILState_STATE gil_state;
     if (need_gil) {
@@ -585,7 +658,11 @@ tracemalloc_realloc(int need_gil, void *ctx, void *ptr, size_t new_size)
         goto unlock;
     }
 
-    if (ptr != NULL) {
+    if (!sampled) {
+        // The resized memory block is not sampled: forget its old trace
+        REMOVE_TRACE(ptr);
+    }
+    else if (ptr != NULL) {
         // An existing memory block has been resized
 
         // tracemalloc_add_trace_unlocked() updates the trace if there is
@@ -594,7 +671,7 @@ tracemalloc_realloc(int need_gil, void *ctx, void *ptr, size_t new_size)
             REMOVE_TRACE(ptr);
         }
 
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (ADD_TRACE(ptr2, size) < 0) {
             // Memory allocation failed. The error cannot be reported to the
             // caller, because realloc() already have shrunk the memory block
             // and so removed bytes.
@@ -610,7 +687,7 @@ tracemalloc_realloc(int need_gil, void *ctx, void *ptr, size_t new_size)
     else {
         // New allocation
 
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (ADD_TRACE(ptr2, size) < 0) {
             // Failed to allocate a trace for the new memory block
             alloc->free(alloc->ctx, ptr2);
             ptr2 = NULL;
@@ -786,7 +863,7 @@ tracemalloc_deinit(void)
 
 
 int
-_PyTraceMalloc_Start(int max_nframe)
+_PyTraceMalloc_Start(int max_nframe, size_t sample_rate)
 {
     if (max_nframe < 1 || max_nframe > MAX_NFRAME) {
         PyErr_Format(PyExc_ValueError,
@@ -801,6 +878,7 @@ _PyTraceMalloc_Start(int max_nframe)
     }
 
     tracemalloc_config.max_nframe = max_nframe;
+    tracemalloc_config.sample_rate = sample_rate;
 
     /* allocate a buffer to store a new traceback */
     size_t size = TRACEBACK_SIZE(max_nframe);
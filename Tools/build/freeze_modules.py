@@ -33,6 +33,14 @@
 # If you're debugging new bytecode instructions,
 # you can delete all sections except 'import system'.
 # This also speeds up building somewhat.
+#
+# The list is deliberately limited to what startup needs.  Frozen modules
+# are still unmarshalled and executed at import time (there is no
+# deep-freezing into static objects any more), so freezing only saves the
+# path lookup and the .pyc read.  For re, enum, functools, collections,
+# typing, dataclasses, json and logging that is about 1 ms of a 25 ms
+# import; executing the module bodies dominates.  A larger frozen set is
+# not worth the bigger binary and the regen churn.
 TESTS_SECTION = 'Test module'
 FROZEN = [
     # See parse_frozen_spec() for the format.
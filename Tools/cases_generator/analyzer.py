@@ -227,9 +227,10 @@ def is_super(self) -> bool:
 
 class Label:
 
-    def __init__(self, name: str, spilled: bool, body: BlockStmt, properties: Properties):
+    def __init__(self, name: str, spilled: bool, cold: bool, body: BlockStmt, properties: Properties):
         self.name = name
         self.spilled = spilled
+        self.cold = cold
         self.body = body
         self.properties = properties
 
@@ -1048,7 +1049,7 @@ def add_label(
     labels: dict[str, Label],
 ) -> None:
     properties = compute_properties(label)
-    labels[label.name] = Label(label.name, label.spilled, label.block, properties)
+    labels[label.name] = Label(label.name, label.spilled, label.cold, label.block, properties)
 
 
 def assign_opcodes(
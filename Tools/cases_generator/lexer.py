@@ -221,6 +221,8 @@ def choice(*opts: str) -> str:
 kwds.append(LABEL)
 SPILLED = "SPILLED"
 kwds.append(SPILLED)
+COLD = "COLD"
+kwds.append(COLD)
 keywords = {name.lower(): name for name in kwds}
 
 ANNOTATION = "ANNOTATION"
@@ -323,6 +323,7 @@ class Pseudo(Node):
 class LabelDef(Node):
     name: str
     spilled: bool
+    cold: bool
     block: BlockStmt
 
 
@@ -346,6 +347,9 @@ def definition(self) -> AstNode | None:
 
     @contextual
     def label_def(self) -> LabelDef | None:
+        cold = False
+        if self.expect(lx.COLD):
+            cold = True
         spilled = False
         if self.expect(lx.SPILLED):
             spilled = True
@@ -354,7 +358,7 @@ def label_def(self) -> LabelDef | None:
                 if tkn := self.expect(lx.IDENTIFIER):
                     if self.expect(lx.RPAREN):
                         block = self.block()
-                        return LabelDef(tkn.text, spilled, block)
+                        return LabelDef(tkn.text, spilled, cold, block)
         return None
 
     @contextual
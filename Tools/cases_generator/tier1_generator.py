@@ -203,7 +203,10 @@ def generate_tier1_labels(
     emitter.emit("\n")
     # Emit tail-callable labels as function defintions
     for name, label in analysis.labels.items():
-        emitter.emit(f"LABEL({name})\n")
+        if label.cold:
+            emitter.emit(f"COLD_LABEL({name})\n")
+        else:
+            emitter.emit(f"LABEL({name})\n")
         storage = Storage(Stack(), [], [], 0, False)
         if label.spilled:
             storage.spilled = 1
@@ -21,9 +21,12 @@
 # > echo "0" | sudo tee /sys/devices/system/cpu/cpufreq/boost
 #
 
+import asyncio
+import json
 import math
 import os
 import queue
+import re
 import sys
 import threading
 import time
@@ -202,6 +205,96 @@ def method_caller():
     for i in range(1000 * WORK_SCALE):
         mc(obj)
 
+def _drop_objects(q):
+    while q.get() is not None:
+        pass
+
+@register_benchmark
+def cross_thread_decref():
+    # Objects are created by this thread and freed by a helper thread, so
+    # each of them is queued back to this thread for its refcount fields to
+    # be merged (biased reference counting).
+    q = queue.SimpleQueue()
+    t = threading.Thread(target=_drop_objects, args=(q,))
+    t.start()
+    for i in range(1000 * WORK_SCALE):
+        q.put(MyObject())
+    q.put(None)
+    t.join()
+
+_executor = None
+_executor_lock = threading.Lock()
+
+@register_benchmark
+def thread_pool_executor():
+    # All benchmark threads submit to the same executor, so this measures
+    # contention on its shared work queue and the per-task Future overhead.
+    global _executor
+    with _executor_lock:
+        if _executor is None:
+            from concurrent.futures import ThreadPoolExecutor
+            _executor = ThreadPoolExecutor(max_workers=os.cpu_count())
+    futures = [_executor.submit(double, i) for i in range(10 * WORK_SCALE)]
+    for f in futures:
+        f.result()
+
+@register_benchmark
+def dict_ops():
+    d = {}
+    for i in range(100 * WORK_SCALE):
+        key = f"key{i % 100}"
+        d[key] = i
+        d.get(key)
+        if key in d:
+            del d[key]
+
+@register_benchmark
+def create_tuples():
+    for i in range(50 * WORK_SCALE):
+        lst = [(j, i) for j in range(20)]
+
+WORD_RE = re.compile(r"[a-z]+(?:_[a-z]+)*")
+
+@register_benchmark
+def regex_match():
+    # The compiled pattern is shared by all threads.
+    text = "spam_eggs ham 123 bacon_and_spam"
+    for i in range(100 * WORK_SCALE):
+        WORD_RE.findall(text)
+
+JSON_DOC = {"name": "spam", "values": list(range(10)), "nested": {"a": 1.5}}
+
+@register_benchmark
+def json_roundtrip():
+    for i in range(20 * WORK_SCALE):
+        json.loads(json.dumps(JSON_DOC))
+
+async def _async_step(i):
+    await asyncio.sleep(0)
+    return i
+
+async def _async_main(n):
+    for i in range(n):
+        await asyncio.gather(_async_step(i), _async_step(i))
+
+@register_benchmark
+def asyncio_per_thread():
+    # Each thread runs its own event loop.
+    asyncio.run(_async_main(10 * WORK_SCALE))
+
+@register_benchmark
+def pipe_io():
+    # The thread state is detached in each os.read() and os.write() call.
+    r, w = os.pipe()
+    try:
+        data = b"x" * 64
+        for i in range(10 * WORK_SCALE):
+            os.write(w, data)
+            os.read(r, 64)
+    finally:
+        os.close(r)
+        os.close(w)
+
 def bench_one_thread(func):
     t0 = time.perf_counter_ns()
     func()
@@ -209,11 +302,13 @@ def bench_one_thread(func):
     return t1 - t0
 
 
-def bench_parallel(func):
+def bench_parallel(func, nthreads=None):
+    if nthreads is None:
+        nthreads = len(threads)
     t0 = time.perf_counter_ns()
-    for inq in in_queues:
+    for inq in in_queues[:nthreads]:
         inq.put(func)
-    for outq in out_queues:
+    for outq in out_queues[:nthreads]:
         outq.get()
     t1 = time.perf_counter_ns()
     return t1 - t0
@@ -242,6 +337,63 @@ def benchmark(func):
 
     print(f"{color}{func.__name__:<25} {round(factor, 1):>4}x {direction}{reset_color}")
 
+def thread_counts():
+    # 1, 2, 4, ... up to and including the number of threads
+    counts = []
+    n = 1
+    while n < len(threads):
+        counts.append(n)
+        n *= 2
+    counts.append(len(threads))
+    return counts
+
+def benchmark_curve(func):
+    # Speedup with n threads relative to running the work serially n times;
+    # perfect scaling gives n.
+    delta_one_thread = bench_one_thread(func)
+    row = []
+    for n in thread_counts():
+        delta = bench_parallel(func, n)
+        row.append(delta_one_thread * n / delta)
+    print(f"{func.__name__:<25}", " ".join(f"{s:>6.1f}" for s in row))
+
+# Counters from a --enable-pystats build that point at the usual causes
+# of poor scaling in the free-threaded build.
+CONTENTION_STATS = {
+    "Lock stats (slow_path)": "lock slow",
+    "Lock stats (park_ns)": "lock park ms",
+    "Object refcount merges queued": "brc queued",
+    "Object frees deferred by QSBR": "qsbr deferred",
+}
+
+def stats_dir():
+    if sys.platform == "win32":
+        return "c:\\temp\\py_stats"
+    return "/tmp/py_stats"
+
+def bench_parallel_with_stats(func):
+    # Collect stats for the parallel run only, then report the counters
+    # in CONTENTION_STATS for this benchmark.
+    before = set(os.listdir(stats_dir()))
+    sys._stats_clear()
+    sys._stats_on()
+    bench_parallel(func)
+    sys._stats_off()
+    sys._stats_dump()
+    new = set(os.listdir(stats_dir())) - before
+    values = dict.fromkeys(CONTENTION_STATS.values(), 0)
+    for filename in new:
+        path = os.path.join(stats_dir(), filename)
+        with open(path) as f:
+            for line in f:
+                key, _, value = line.rpartition(":")
+                if key in CONTENTION_STATS:
+                    values[CONTENTION_STATS[key]] += int(value)
+        os.remove(path)
+    values["lock park ms"] //= 1_000_000
+    report = ", ".join(f"{name} {value}" for name, value in values.items())
+    print(f"{'':<25} {report}")
+
 def determine_num_threads_and_affinity():
     if sys.platform != "linux":
         return [None] * os.cpu_count()
@@ -321,14 +473,29 @@ def main(opts):
 
     WORK_SCALE = opts.scale
 
+    if opts.stats and not hasattr(sys, "_stats_dump"):
+        sys.stderr.write("--stats requires a build configured with --enable-pystats\n")
+        sys.exit(1)
+    if opts.stats:
+        os.makedirs(stats_dir(), exist_ok=True)
+
     if not opts.baseline_only:
         initialize_threads(opts)
 
+    if opts.curve:
+        counts = " ".join(f"{n:>6}" for n in thread_counts())
+        print(f"{'speedup with N threads':<25} {counts}")
+
     do_bench = not opts.baseline_only and not opts.parallel_only
     for name in benchmark_names:
         func = ALL_BENCHMARKS[name]
         if do_bench:
-            benchmark(func)
+            if opts.curve:
+                benchmark_curve(func)
+            else:
+                benchmark(func)
+            if opts.stats:
+                bench_parallel_with_stats(func)
             continue
 
         if opts.parallel_only:
@@ -352,6 +519,11 @@ def main(opts):
                         help="only run the baseline benchmarks (single thread)")
     parser.add_argument("--parallel-only", default=False, action="store_true",
                         help="only run the parallel benchmark (many threads)")
+    parser.add_argument("--curve", default=False, action="store_true",
+                        help="report the speedup for 1, 2, 4, ... threads")
+    parser.add_argument("--stats", default=False, action="store_true",
+                        help="report lock, BRC and QSBR counters for each "
+                             "benchmark (requires --enable-pystats)")
     parser.add_argument("benchmarks", nargs="*",
                         help="benchmarks to run")
     options = parser.parse_args()
@@ -0,0 +1,214 @@
+"""Measure imports from a generated, realistically shaped site-packages.
+
+importbench.py times single imports of one module.  This script instead
+generates a throwaway site directory that looks like an application's
+dependencies:
+
+* regular packages nested a few levels deep, whose __init__ modules import
+  their submodules;
+* namespace packages split over several path entries;
+* .pth files, each adding a path entry that every later import must search;
+* a zip archive of packages on sys.path.
+
+Everything is imported in a fresh interpreter under -X importtime, both
+"cold" (no cached bytecode, with -B so none is written) and "warm" (after a
+run that wrote the __pycache__ directories).  The report shows the best wall
+time over interpreter start-up, and the self time summed by kind of module.
+The OS page cache stays warm in both cases; only the bytecode cache differs.
+
+Usage:
+
+    python3 Tools/importbench/sitebench.py [--packages N] [--modules N]
+        [--depth N] [--namespaces N] [--pth N] [--repeat N] [--keep DIR]
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+import zipfile
+
+MODULE_SOURCE = '''\
+"""Generated module {name}."""
+import os
+import sys
+
+CONSTANT = {index}
+TABLE = {{str(i): i * {index} for i in range(20)}}
+
+
+class Thing{index}:
+    """A class with a few methods."""
+
+    def __init__(self, value=CONSTANT):
+        self.value = value
+
+    def double(self):
+        return self.value * 2
+
+    def __repr__(self):
+        return f"Thing{index}({{self.value!r}})"
+
+
+def helper(x, y=1, *args, **kwargs):
+    if x > y:
+        return [x + a for a in args]
+    return {{k: v for k, v in kwargs.items() if v}}
+'''
+
+
+def write_package(path, name, modules, depth):
+    """Write a regular package with *modules* modules and *depth* levels of
+    subpackages below it; return the number of modules written."""
+    os.makedirs(path)
+    imports = [f'from . import mod{i}' for i in range(modules)]
+    count = 1 + modules
+    if depth > 1:
+        imports.append('from . import sub')
+        count += write_package(os.path.join(path, 'sub'), f'{name}.sub',
+                               modules, depth - 1)
+    with open(os.path.join(path, '__init__.py'), 'w') as f:
+        f.write('\n'.join(imports) + '\n')
+    for i in range(modules):
+        with open(os.path.join(path, f'mod{i}.py'), 'w') as f:
+            f.write(MODULE_SOURCE.format(name=f'{name}.mod{i}', index=i))
+    return count
+
+
+def generate(root, options):
+    """Generate the site directory and the main module; return the names of
+    the top-level imports."""
+    site = os.path.join(root, 'site-packages')
+    os.makedirs(site)
+    names = []
+    for p in range(options.packages):
+        name = f'pkg{p}'
+        write_package(os.path.join(site, name), name, options.modules,
+                      options.depth)
+        names.append(name)
+
+    # Path entries added by .pth files.  Namespace packages are split over
+    # all of them, so each lookup has to scan every entry.
+    entries = []
+    for i in range(options.pth):
+        entry = os.path.join(root, f'entry{i}')
+        os.makedirs(entry)
+        entries.append(entry)
+        with open(os.path.join(site, f'entry{i}.pth'), 'w') as f:
+            f.write(entry + '\n')
+    for n in range(options.namespaces):
+        for i, entry in enumerate(entries or [site]):
+            portion = os.path.join(entry, f'ns{n}', f'part{i}')
+            write_package(portion, f'ns{n}.part{i}', options.modules, 1)
+            names.append(f'ns{n}.part{i}')
+
+    archive = os.path.join(root, 'packages.zip')
+    with zipfile.ZipFile(archive, 'w') as zf:
+        for p in range(max(1, options.packages // 4)):
+            name = f'zpkg{p}'
+            tmp = os.path.join(root, 'zip-src', name)
+            write_package(tmp, name, options.modules, options.depth)
+            for dirpath, _, filenames in os.walk(tmp):
+                for filename in filenames:
+                    full = os.path.join(dirpath, filename)
+                    zf.write(full, os.path.relpath(full, os.path.dirname(tmp)))
+            names.append(name)
+    shutil.rmtree(os.path.join(root, 'zip-src'))
+    with open(os.path.join(site, 'zipped.pth'), 'w') as f:
+        f.write(archive + '\n')
+    return site, names
+
+
+def run(site, names, cold):
+    """Import everything in a new interpreter; return the wall time and the
+    -X importtime output."""
+    code = (f'import site; site.addsitedir({site!r}); '
+            + '; '.join(f'import {name}' for name in names))
+    args = [sys.executable, '-I', '-S', '-X', 'importtime']
+    if cold:
+        args.append('-B')
+    start = time.perf_counter()
+    proc = subprocess.run(args + ['-c', code], capture_output=True,
+                          text=True, check=True)
+    return time.perf_counter() - start, proc.stderr
+
+
+def remove_bytecode(root):
+    for dirpath, dirnames, _ in os.walk(root):
+        if '__pycache__' in dirnames:
+            shutil.rmtree(os.path.join(dirpath, '__pycache__'))
+            dirnames.remove('__pycache__')
+
+
+def self_times(importtime):
+    """Sum the -X importtime self times (in us) by kind of module."""
+    kinds = {}
+    for line in importtime.splitlines():
+        if not line.startswith('import time:') or '|' not in line:
+            continue
+        fields = line[len('import time:'):].split('|')
+        if not fields[0].strip().isdigit():
+            continue  # the header line
+        name = fields[2].strip()
+        if name.startswith('zpkg'):
+            kind = 'zip'
+        elif name.startswith('ns'):
+            kind = 'namespace'
+        elif name.startswith('pkg'):
+            kind = 'regular'
+        else:
+            kind = 'stdlib'
+        total, count = kinds.get(kind, (0, 0))
+        kinds[kind] = (total + int(fields[0]), count + 1)
+    return kinds
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--packages', type=int, default=40)
+    parser.add_argument('--modules', type=int, default=8,
+                        help='modules per package level')
+    parser.add_argument('--depth', type=int, default=3)
+    parser.add_argument('--namespaces', type=int, default=10)
+    parser.add_argument('--pth', type=int, default=5)
+    parser.add_argument('--repeat', type=int, default=5)
+    parser.add_argument('--keep', metavar='DIR',
+                        help='generate into DIR and keep it')
+    options = parser.parse_args()
+
+    root = options.keep or tempfile.mkdtemp(prefix='sitebench-')
+    try:
+        site, names = generate(root, options)
+        baseline = min(run(site, [], cold=False)[0]
+                       for _ in range(options.repeat))
+        print(f'{len(names)} top-level imports; interpreter start-up '
+              f'{baseline * 1e3:.1f} ms is subtracted from wall times\n')
+        print('{:6}{:>12}'.format('', 'wall ms') +
+              ''.join('{:>20}'.format(f'{k} ms (n)')
+                      for k in ('regular', 'namespace', 'zip', 'stdlib')))
+        for label, cold in ('cold', True), ('warm', False):
+            best = None
+            for _ in range(options.repeat):
+                if cold:
+                    remove_bytecode(root)
+                else:
+                    run(site, names, cold=False)  # write the bytecode
+                wall, importtime = run(site, names, cold)
+                if best is None or wall < best[0]:
+                    best = wall, self_times(importtime)
+            wall, kinds = best
+            row = ''.join('{:>20}'.format('{:.1f} ({})'.format(
+                              kinds.get(k, (0, 0))[0] / 1e3,
+                              kinds.get(k, (0, 0))[1]))
+                          for k in ('regular', 'namespace', 'zip', 'stdlib'))
+            print('{:6}{:12.1f}'.format(label, (wall - baseline) * 1e3) + row)
+    finally:
+        if not options.keep:
+            shutil.rmtree(root)
+
+
+if __name__ == '__main__':
+    main()
@@ -1,7 +1,14 @@
 # Measure the performance of PyMutex and PyThread_type_lock locks
 # with short critical sections.
 #
-# Usage: python Tools/lockbench/lockbench.py [CRITICAL_SECTION_LENGTH]
+# Usage: python Tools/lockbench/lockbench.py [CRITICAL_SECTION_LENGTH ...]
+#            [--threads N [N ...]] [--time-ms MS] [--lock-type TYPE]
+#
+# Passing several critical section lengths (and thread counts) runs the
+# whole matrix, which is useful when tuning the spinning in
+# _PyMutex_LockTimed(): short critical sections favour spinning, long
+# ones and oversubscribed machines (more threads than cores) favour
+# parking early.
 #
 # How to interpret the results:
 #
@@ -18,8 +25,8 @@
 # lock.
 # See https://en.wikipedia.org/wiki/Fairness_measure#Jain's_fairness_index
 
+import argparse
 from _testinternalcapi import benchmark_locks
-import sys
 
 # Max number of threads to test
 MAX_THREADS = 10
@@ -27,27 +34,46 @@
 # How much "work" to do while holding the lock
 CRITICAL_SECTION_LENGTH = 1
 
+LOCK_TYPES = ["PyMutex", "PyThread_type_lock"]
+
 
 def jains_fairness(values):
     # Jain's fairness index
     # See https://en.wikipedia.org/wiki/Fairness_measure
     return (sum(values) ** 2) / (len(values) * sum(x ** 2 for x in values))
 
-def main():
-    print("Lock Type           Threads           Acquisitions (kHz)   Fairness")
-    for lock_type in ["PyMutex", "PyThread_type_lock"]:
+def main(lengths=(CRITICAL_SECTION_LENGTH,), threads=None, lock_types=LOCK_TYPES,
+         time_ms=1000):
+    if threads is None:
+        threads = range(1, MAX_THREADS + 1)
+    print("Lock Type           Length    Threads           Acquisitions (kHz)   Fairness")
+    for lock_type in lock_types:
         use_pymutex = (lock_type == "PyMutex")
-        for num_threads in range(1, MAX_THREADS + 1):
-            acquisitions, thread_iters = benchmark_locks(
-                num_threads, use_pymutex, CRITICAL_SECTION_LENGTH)
+        for length in lengths:
+            for num_threads in threads:
+                acquisitions, thread_iters = benchmark_locks(
+                    num_threads, use_pymutex, length, time_ms)
+
+                acquisitions /= 1000  # report in kHz for readability
+                fairness = jains_fairness(thread_iters)
+
+                print(f"{lock_type: <20}{length: <10}{num_threads: <18}{acquisitions: >5.0f}{fairness: >20.2f}")
 
-            acquisitions /= 1000  # report in kHz for readability
-            fairness = jains_fairness(thread_iters)
 
-            print(f"{lock_type: <20}{num_threads: <18}{acquisitions: >5.0f}{fairness: >20.2f}")
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("lengths", metavar="CRITICAL_SECTION_LENGTH", type=int,
+                        nargs="*", default=[CRITICAL_SECTION_LENGTH],
+                        help="work done while holding the lock")
+    parser.add_argument("--threads", type=int, nargs="+",
+                        help=f"thread counts to test (default: 1..{MAX_THREADS})")
+    parser.add_argument("--lock-type", choices=LOCK_TYPES, action="append",
+                        help="lock type to test (default: all)")
+    parser.add_argument("--time-ms", type=int, default=1000,
+                        help="duration of each run in milliseconds")
+    return parser.parse_args()
 
 
 if __name__ == "__main__":
-    if len(sys.argv) > 1:
-        CRITICAL_SECTION_LENGTH = int(sys.argv[1])
-    main()
+    args = parse_args()
+    main(args.lengths, args.threads, args.lock_type or LOCK_TYPES, args.time_ms)
@@ -0,0 +1,260 @@
+# Compare the same small workloads across the ways CPython can run code in
+# parallel: threads (sharing the GIL, or free-threaded on a --disable-gil
+# build), subinterpreters that each have their own GIL, and processes.
+#
+# Usage: python Tools/lockbench/modebench.py [WORKLOAD ...]
+#            [--mode MODE] [--workers N [N ...]] [--ops N]
+#
+# Workloads:
+#
+#   counter   Every worker increments one shared counter under a lock.
+#             Interpreters share no objects, so they skip this workload.
+#   sharded   Every worker increments its own counter; the totals are summed
+#             at the end.  The contention-free version of "counter".
+#   cache     Lookups in a 10,000 entry dict with 1% updates.  Threads share
+#             one dict; interpreters and processes each build their own copy.
+#   handoff   The main thread sends timestamped items to every worker through
+#             a queue (queue.Queue, an interpreters queue or a
+#             multiprocessing.Queue).
+#
+# How to interpret the results:
+#
+# kops/s: thousands of operations per second of wall time, all workers
+# together, measured from the first worker starting its loop to the last one
+# finishing.  Start-up (spawning processes, creating interpreters, importing
+# this module) is excluded.
+#
+# kops/cpu-s: thousands of operations per second of CPU time used by the
+# workers (and by the sending thread for handoff).  It shows how much CPU a
+# mode burns for the same work, e.g. on lock contention or serialization.
+#
+# p50/p99 (us): for handoff, the time from putting an item in a queue until
+# a worker has taken it out.  The sender does not wait for the workers, so
+# this includes the time items spend waiting in the queue behind others.
+
+import argparse
+import array
+import multiprocessing
+import os
+import queue
+import random
+import sys
+import threading
+import time
+
+try:
+    from concurrent import interpreters
+except ImportError:
+    interpreters = None
+
+MODES = ["threads", "interpreters", "processes"]
+WORKLOADS = ["counter", "sharded", "cache", "handoff"]
+CACHE_SIZE = 10_000
+STOP = -1
+
+
+class Counter:
+    # The subset of the multiprocessing.Value API that the counter workload
+    # uses, for threads.
+    def __init__(self):
+        self.value = 0
+        self._lock = threading.Lock()
+
+    def get_lock(self):
+        return self._lock
+
+
+def make_cache():
+    return {f"key{i}": i for i in range(CACHE_SIZE)}
+
+
+def worker(workload, ops, seed, work_q, ready_q, result_q, shared=None):
+    # The same worker runs in a thread, a subinterpreter or a child process.
+    # It reports (start_ns, end_ns, cpu_seconds, ops, latencies) where
+    # latencies is an array('q') in bytes, so that every mode can send it.
+    if workload == "cache":
+        cache = shared if shared is not None else make_cache()
+        rng = random.Random(seed)
+        keys = [f"key{rng.randrange(CACHE_SIZE)}" for _ in range(1000)]
+    latencies = array.array("q")
+    ready_q.put(seed)
+
+    start_cpu = time.thread_time()
+    start = time.perf_counter_ns()
+    if workload == "counter":
+        lock = shared.get_lock()
+        for _ in range(ops):
+            with lock:
+                shared.value += 1
+    elif workload == "sharded":
+        count = 0
+        for _ in range(ops):
+            count += 1
+    elif workload == "cache":
+        for i in range(ops):
+            key = keys[i % 1000]
+            if i % 100 == 0:
+                cache[key] = i
+            else:
+                cache.get(key)
+    elif workload == "handoff":
+        ops = 0
+        while (sent := work_q.get()) != STOP:
+            latencies.append(time.perf_counter_ns() - sent)
+            ops += 1
+    else:
+        raise ValueError(f"unknown workload {workload!r}")
+    end = time.perf_counter_ns()
+    result_q.put((start, end, time.thread_time() - start_cpu, ops,
+                  latencies.tobytes()))
+
+
+INTERPRETER_SCRIPT = """\
+import sys
+sys.path.insert(0, {path!r})
+import modebench
+modebench.worker({workload!r}, {ops}, {seed}, work_q, ready_q, result_q)
+"""
+
+
+def start_threads(workload, nworkers, ops):
+    make_queue = queue.Queue
+    shared = None
+    if workload == "counter":
+        shared = Counter()
+    elif workload == "cache":
+        shared = make_cache()
+    ready_q, result_q = make_queue(), make_queue()
+    work_qs = [make_queue() for _ in range(nworkers)]
+    workers = [threading.Thread(target=worker,
+                                args=(workload, ops, seed, work_qs[seed],
+                                      ready_q, result_q, shared))
+               for seed in range(nworkers)]
+    for t in workers:
+        t.start()
+    return workers, work_qs, ready_q, result_q, shared
+
+
+def start_interpreters(workload, nworkers, ops):
+    ready_q, result_q = interpreters.create_queue(), interpreters.create_queue()
+    work_qs = [interpreters.create_queue() for _ in range(nworkers)]
+    path = os.path.dirname(os.path.abspath(__file__))
+    workers, interps = [], []
+    for seed in range(nworkers):
+        interp = interpreters.create()
+        interps.append(interp)
+        interp.prepare_main(work_q=work_qs[seed], ready_q=ready_q,
+                            result_q=result_q)
+        script = INTERPRETER_SCRIPT.format(path=path, workload=workload,
+                                           ops=ops, seed=seed)
+        workers.append(threading.Thread(target=interp.exec, args=(script,)))
+    for t in workers:
+        t.start()
+    return workers, work_qs, ready_q, result_q, interps
+
+
+def start_processes(workload, nworkers, ops):
+    make_queue = multiprocessing.Queue
+    shared = multiprocessing.Value("q", 0) if workload == "counter" else None
+    ready_q, result_q = make_queue(), make_queue()
+    work_qs = [make_queue() for _ in range(nworkers)]
+    workers = [multiprocessing.Process(target=worker,
+                                       args=(workload, ops, seed, work_qs[seed],
+                                             ready_q, result_q, shared))
+               for seed in range(nworkers)]
+    for p in workers:
+        p.start()
+    return workers, work_qs, ready_q, result_q, shared
+
+
+STARTERS = {
+    "threads": start_threads,
+    "interpreters": start_interpreters,
+    "processes": start_processes,
+}
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return float("nan")
+    index = min(len(sorted_values) - 1, int(len(sorted_values) * fraction))
+    return sorted_values[index]
+
+
+def run(mode, workload, nworkers, ops):
+    # Keep a reference to the shared object until the results are in: a child
+    # process may only attach to a multiprocessing.Value's memory after
+    # start() has returned, and the items an interpreter put in a queue
+    # become unbound when the interpreter is destroyed.
+    workers, work_qs, ready_q, result_q, shared = STARTERS[mode](
+        workload, nworkers, ops)
+    for _ in range(nworkers):
+        ready_q.get()
+
+    sender_cpu = 0.0
+    if workload == "handoff":
+        start_cpu = time.thread_time()
+        for _ in range(ops):
+            for q in work_qs:
+                q.put(time.perf_counter_ns())
+        for q in work_qs:
+            q.put(STOP)
+        sender_cpu = time.thread_time() - start_cpu
+
+    results = [result_q.get() for _ in range(nworkers)]
+    for w in workers:
+        w.join()
+
+    start = min(r[0] for r in results)
+    end = max(r[1] for r in results)
+    cpu = sum(r[2] for r in results) + sender_cpu
+    total = sum(r[3] for r in results)
+    latencies = array.array("q")
+    for r in results:
+        latencies.frombytes(r[4])
+    latencies = sorted(latencies)
+    wall = (end - start) / 1e9
+    return (total / wall / 1e3, total / cpu / 1e3 if cpu else float("nan"),
+            percentile(latencies, 0.50) / 1e3,
+            percentile(latencies, 0.99) / 1e3)
+
+
+def main(workloads=WORKLOADS, modes=MODES, workers=(1, 2, 4), ops=200_000):
+    gil = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"threads run {'with the GIL' if gil else 'free-threaded'}; "
+          f"{os.cpu_count()} CPUs; {ops} ops per worker")
+    print(f"{'Workload':<10}{'Mode':<14}{'Workers':>8}{'kops/s':>12}"
+          f"{'kops/cpu-s':>12}{'p50 (us)':>10}{'p99 (us)':>10}")
+    for workload in workloads:
+        for mode in modes:
+            if mode == "interpreters" and (interpreters is None
+                                           or workload == "counter"):
+                continue
+            for nworkers in workers:
+                # Queue handoffs are far slower than the loops above.
+                n = ops // 20 if workload == "handoff" else ops
+                rate, efficiency, p50, p99 = run(mode, workload, nworkers, n)
+                latency = (f"{p50:>10.1f}{p99:>10.1f}" if p50 == p50
+                           else f"{'-':>10}{'-':>10}")
+                print(f"{workload:<10}{mode:<14}{nworkers:>8}{rate:>12.0f}"
+                      f"{efficiency:>12.0f}{latency}")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("workloads", metavar="WORKLOAD", nargs="*",
+                        choices=WORKLOADS, default=WORKLOADS,
+                        help=f"workloads to run (default: all of "
+                             f"{', '.join(WORKLOADS)})")
+    parser.add_argument("--mode", choices=MODES, action="append",
+                        help="mode to test (default: all)")
+    parser.add_argument("--workers", type=int, nargs="+", default=[1, 2, 4],
+                        help="worker counts to test (default: 1 2 4)")
+    parser.add_argument("--ops", type=int, default=200_000,
+                        help="operations per worker")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    main(args.workloads, args.mode or MODES, args.workers, args.ops)
@@ -0,0 +1,100 @@
+"""Show encode and decode throughput of the CJK codecs.
+
+For each codec, the text is built from the characters of the codec's own
+mapping tables (sampled from the CJK, kana and Hangul blocks) mixed with runs
+of ASCII, so the numbers cover both the table lookups and the single-byte
+paths.  --ascii sets the share of ASCII characters.  Incremental coding feeds
+the data in chunks of --chunk bytes or characters, as a stream reader or a
+network protocol would.
+
+Usage:
+
+    python3 Tools/scripts/cjkcodecs_benchmark.py [--ascii R] [--chunk N] [codec ...]
+"""
+
+import argparse
+import codecs
+import random
+import time
+
+CODECS = (
+    'gb2312', 'gbk', 'gb18030', 'hz',
+    'big5', 'cp950', 'big5hkscs',
+    'shift_jis', 'cp932', 'euc_jp', 'shift_jis_2004', 'euc_jis_2004',
+    'iso2022_jp', 'iso2022_jp_2', 'iso2022_jp_2004',
+    'euc_kr', 'cp949', 'johab', 'iso2022_kr',
+)
+BLOCKS = ((0x3041, 0x30FF), (0x4E00, 0x9FFF), (0xAC00, 0xD7A3))
+NCHARS = 200_000
+ASCII_WORDS = ('the ', 'data ', 'id=42 ', 'OK ', 'value: ', '\r\n')
+
+
+def sample_text(codec, ascii_ratio, rng):
+    chars = []
+    for first, last in BLOCKS:
+        for cp in range(first, last + 1):
+            ch = chr(cp)
+            try:
+                ch.encode(codec)
+            except UnicodeEncodeError:
+                continue
+            chars.append(ch)
+    parts = []
+    length = 0
+    while length < NCHARS:
+        if rng.random() < ascii_ratio:
+            part = rng.choice(ASCII_WORDS)
+        else:
+            part = ''.join(rng.choices(chars, k=rng.randint(2, 8)))
+        parts.append(part)
+        length += len(part)
+    return ''.join(parts)
+
+
+def best(func, repeat=5):
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        times.append(time.perf_counter() - start)
+    return min(times)
+
+
+def incremental(method, data, chunk):
+    def run():
+        for i in range(0, len(data), chunk):
+            method(data[i:i + chunk])
+        method(data[:0], True)
+    return run
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--ascii', type=float, default=0.3)
+    parser.add_argument('--chunk', type=int, default=4096)
+    parser.add_argument('codecs', nargs='*', default=CODECS)
+    args = parser.parse_args()
+
+    rng = random.Random(0)
+    print('{:18}{:>12}{:>12}{:>12}{:>12}'.format(
+        'codec (MB/s)', 'decode', 'encode', 'inc decode', 'inc encode'))
+    for name in args.codecs:
+        text = sample_text(name, args.ascii, rng)
+        data = text.encode(name)
+        info = codecs.lookup(name)
+        assert data.decode(name) == text
+        mb = len(data) / 1e6
+        row = [
+            best(lambda: data.decode(name)),
+            best(lambda: text.encode(name)),
+            best(incremental(info.incrementaldecoder().decode, data,
+                             args.chunk)),
+            best(incremental(info.incrementalencoder().encode, text,
+                             args.chunk)),
+        ]
+        print('{:18}'.format(name) +
+              ''.join('{:12.0f}'.format(mb / t) for t in row))
+
+
+if __name__ == '__main__':
+    main()
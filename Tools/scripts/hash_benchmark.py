@@ -0,0 +1,88 @@
+"""Show hashlib throughput when hashing many independent messages.
+
+Each algorithm is timed through hashlib.new(), which uses OpenSSL when it
+provides the algorithm, and through the builtin HACL* module when one
+exists.  Short messages show the per-call overhead of creating a hash object
+and finalizing it, long ones the speed of the underlying implementation.
+With --threads, the messages are split between threads; the GIL is only
+released for messages larger than hashlib's internal threshold (2047 bytes).
+
+Usage:
+
+    python3 Tools/scripts/hash_benchmark.py [--threads N] [algorithm ...]
+"""
+
+import argparse
+import hashlib
+import os
+import threading
+import time
+
+SIZES = (64, 1024, 4096, 65536)
+TOTAL = 8 * 1024 * 1024
+BUILTINS = {
+    'md5': '_md5', 'sha1': '_sha1',
+    'sha224': '_sha2', 'sha256': '_sha2', 'sha384': '_sha2', 'sha512': '_sha2',
+    'sha3_256': '_sha3', 'sha3_512': '_sha3',
+    'blake2b': '_blake2', 'blake2s': '_blake2',
+}
+
+
+def constructors(name):
+    try:
+        hashlib.new(name)
+    except ValueError:
+        pass
+    else:
+        yield 'hashlib', lambda data: hashlib.new(name, data)
+    modname = BUILTINS.get(name)
+    if modname is not None:
+        try:
+            module = __import__(modname)
+        except ImportError:
+            return
+        yield 'builtin', getattr(module, name)
+
+
+def run(func, messages, nthreads):
+    def work(part):
+        for data in part:
+            func(data).digest()
+
+    if nthreads == 1:
+        start = time.perf_counter()
+        work(messages)
+        return time.perf_counter() - start
+    threads = [threading.Thread(target=work, args=(messages[i::nthreads],))
+               for i in range(nthreads)]
+    start = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--threads', type=int, default=1)
+    parser.add_argument('algorithms', nargs='*',
+                        default=['md5', 'sha1', 'sha256', 'sha512',
+                                 'sha3_256', 'blake2b', 'blake2s'])
+    args = parser.parse_args()
+
+    print('{:10} {:8}'.format('algorithm', 'backend') +
+          ''.join('{:>12}'.format('%d B' % size) for size in SIZES))
+    for name in args.algorithms:
+        for backend, func in constructors(name):
+            row = []
+            for size in SIZES:
+                messages = [os.urandom(size)] * (TOTAL // size)
+                elapsed = min(run(func, messages, args.threads)
+                              for _ in range(3))
+                row.append('{:>7.0f} MB/s'.format(TOTAL / elapsed / 1e6))
+            print('{:10} {:8}'.format(name, backend) + ''.join(row))
+
+
+if __name__ == '__main__':
+    main()
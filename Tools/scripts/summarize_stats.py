@@ -71,6 +71,14 @@ def get_defines(filepath: Path, prefix: str = "SPEC_FAIL"):
         "_specialized_instructions": [
             op for op in opcode._specialized_opmap.keys() if "__" not in op  # type: ignore
         ],
+        # Instructions that could be combined into a superinstruction with
+        # super(): no inline cache entries and no jumps.
+        "_fusable_instructions": [
+            name
+            for name, op in opcode.opmap.items()
+            if op not in opcode.hasjump
+            and not opcode._inline_cache_entries.get(name, 0)  # type: ignore
+        ],
         "_stats_defines": get_defines(
             Path("Include") / "cpython" / "pystats.h", "EVAL_CALL"
         ),
@@ -370,6 +378,10 @@ def __init__(self, data: RawData):
     def get(self, key: str) -> int:
         return self._data.get(key, 0)
 
+    def get_fusable_instructions(self) -> set[str]:
+        # Not present in data saved by older versions of this script
+        return set(self._data.get("_fusable_instructions", ()))
+
     @functools.cache
     def get_opcode_stats(self, prefix: str) -> OpcodeStats:
         opcode_stats = collections.defaultdict[str, dict](dict)
@@ -611,6 +623,22 @@ def get_rare_events(self) -> list[tuple[str, int]]:
             if key.startswith(prefix)
         ]
 
+    def get_lock_stats(self) -> list[tuple[str, int]]:
+        prefix = "Lock stats "
+        return [
+            (key[len(prefix) + 1 : -1].replace("_", " "), val)
+            for key, val in self._data.items()
+            if key.startswith(prefix)
+        ]
+
+    def get_gil_stats(self) -> list[tuple[str, int]]:
+        prefix = "GIL stats "
+        return [
+            (key[len(prefix) + 1 : -1].replace("_", " "), val)
+            for key, val in self._data.items()
+            if key.startswith(prefix)
+        ]
+
 
 class JoinMode(enum.Enum):
     # Join using the first column as a key
@@ -829,6 +857,57 @@ def calc_pair_count_table(stats: Stats) -> Rows:
     )
 
 
+def superinstruction_candidates_section() -> Section:
+    def calc_superinstruction_table(stats: Stats) -> Rows:
+        fusable = stats.get_fusable_instructions()
+        opcode_stats = stats.get_opcode_stats("opcode")
+        pair_counts = opcode_stats.get_pair_counts()
+        total = opcode_stats.get_total_execution_count()
+
+        candidates = [
+            (pair, count)
+            for pair, count in pair_counts.items()
+            if pair[0] in fusable
+            and pair[1] in fusable
+            # Superinstructions are cacheless themselves:
+            and f"{pair[0]}_{pair[1]}" not in fusable
+        ]
+        cumulative = 0
+        rows: Rows = []
+        for (opcode_i, opcode_j), count in itertools.islice(
+            sorted(candidates, key=itemgetter(1), reverse=True), 20
+        ):
+            cumulative += count
+            rows.append(
+                (
+                    f"{opcode_i} {opcode_j}",
+                    Count(count),
+                    Ratio(count, total),
+                    Ratio(cumulative, total),
+                )
+            )
+        return rows
+
+    return Section(
+        "Superinstruction candidates",
+        "Top 20 pairs of cacheless, non-jumping instructions",
+        [
+            Table(
+                ("Pair", "Count:", "Self:", "Cumulative:"),
+                calc_superinstruction_table,
+            )
+        ],
+        comparative=False,
+        doc="""
+        Frequent pairs that could be fused with super() in Python/bytecodes.c,
+        excluding pairs that already have a superinstruction. Fusing also
+        requires both opargs to fit in 4 bits, which these counts do not show,
+        and the compiler's peephole pass in Python/flowgraph.c to emit the
+        new instruction.
+        """,
+    )
+
+
 def pre_succ_pairs_section() -> Section:
     def iter_pre_succ_pairs_tables(base_stats: Stats, head_stats: Stats | None = None):
         assert head_stats is None
@@ -1384,6 +1463,42 @@ def calc_rare_event_table(stats: Stats) -> Table:
     )
 
 
+def lock_stats_section() -> Section:
+    def calc_lock_stats_table(stats: Stats) -> Table:
+        DOCS = {
+            "slow path": "`PyMutex` acquisitions that found the mutex locked",
+            "spins": "Spin iterations before parking",
+            "parks": "Times a waiting thread was parked",
+            "handoffs": "Times the lock was handed off directly to a waiter",
+            "park ns": "Total time spent parked, in nanoseconds",
+        }
+        return [(Doc(x, DOCS[x]), Count(y)) for x, y in stats.get_lock_stats()]
+
+    return Section(
+        "Lock stats",
+        "Contention on `PyMutex` (slow-path acquisitions)",
+        [Table(("Event", "Count:"), calc_lock_stats_table, JoinMode.CHANGE)],
+    )
+
+
+def gil_stats_section() -> Section:
+    def calc_gil_stats_table(stats: Stats) -> Table:
+        DOCS = {
+            "contended": "`take_gil()` calls that found the GIL held",
+            "wait ns": "Total time spent waiting for the GIL, in nanoseconds",
+            "drop requests": "Drop requests sent after a full switch interval",
+            "switches": "Times the GIL changed hands to a different thread",
+            "forced switches": "Times `drop_gil()` waited for another thread to take the GIL",
+        }
+        return [(Doc(x, DOCS[x]), Count(y)) for x, y in stats.get_gil_stats()]
+
+    return Section(
+        "GIL stats",
+        "GIL contention and switching",
+        [Table(("Event", "Count:"), calc_gil_stats_table, JoinMode.CHANGE)],
+    )
+
+
 def meta_stats_section() -> Section:
     def calc_rows(stats: Stats) -> Rows:
         return [("Number of data files", Count(stats.get("__nfiles__")))]
@@ -1398,6 +1513,7 @@ def calc_rows(stats: Stats) -> Rows:
 LAYOUT = [
     execution_count_section(),
     pair_count_section("opcode"),
+    superinstruction_candidates_section(),
     pre_succ_pairs_section(),
     specialization_section(),
     specialization_effectiveness_section(),
@@ -1406,6 +1522,8 @@ def calc_rows(stats: Stats) -> Rows:
     gc_stats_section(),
     optimization_section(),
     rare_event_section(),
+    lock_stats_section(),
+    gil_stats_section(),
     meta_stats_section(),
 ]
 